@@ -40,5 +40,20 @@ set(PRETTY_FUNCTION_CODE
      }")
 check_cxx_source_compiles("${PRETTY_FUNCTION_CODE}" EL_HAVE_PRETTY_FUNCTION)
 
+# POSIX file mapping support (for file-backed matrices)
+set(MMAP_CODE
+    "#include <fcntl.h>
+     #include <sys/mman.h>
+     #include <unistd.h>
+     int main()
+     {
+         void* p = mmap(0, 4096, PROT_READ, MAP_SHARED, 0, 0);
+         madvise(p, 4096, MADV_SEQUENTIAL);
+         msync(p, 4096, MS_SYNC);
+         munmap(p, 4096);
+         return (int)sysconf(_SC_PAGESIZE);
+     }")
+check_cxx_source_compiles("${MMAP_CODE}" HYDROGEN_HAVE_MMAP)
+
 unset(CMAKE_REQUIRED_FLAGS)
 unset(CMAKE_REQUIRED_DEFINITIONS)
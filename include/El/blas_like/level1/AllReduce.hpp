@@ -83,6 +83,127 @@ void AllReduce(AbstractDistMatrix<T>& A, mpi::Comm const& comm, mpi::Op op)
     AllReduce(A.Matrix(), comm, op);
 }
 
+template<typename T>
+CoalescedAllReduce<T>::CoalescedAllReduce(size_t bucketBytes)
+{
+    SetBucketBytes(bucketBytes);
+}
+
+template<typename T>
+void CoalescedAllReduce<T>::SetBucketBytes(size_t bucketBytes)
+{
+    if(bucketBytes < sizeof(T))
+        LogicError("Buckets must hold at least one entry");
+    bucketBytes_ = bucketBytes;
+}
+
+template<typename T>
+void CoalescedAllReduce<T>::Execute(
+    const vector<AbstractMatrix<T>*>& matrices,
+    mpi::Comm const& comm, mpi::Op op)
+{
+    EL_DEBUG_CSE
+    if(mpi::Size(comm) == 1)
+        return;
+
+    vector<Matrix<T,Device::CPU>*> cpuMatrices;
+    cpuMatrices.reserve(matrices.size());
+    Int numEntries = 0;
+    for(auto* A : matrices)
+    {
+        if(A->GetDevice() == Device::CPU)
+        {
+            cpuMatrices.push_back(static_cast<Matrix<T,Device::CPU>*>(A));
+            numEntries += A->Height()*A->Width();
+        }
+        else
+            AllReduce(*A, comm, op);
+    }
+    if(numEntries == 0)
+        return;
+
+    const Int bucketSize =
+        Min(Int(bucketBytes_/sizeof(T)), Int(std::numeric_limits<int>::max()));
+    const Int numBuckets = (numEntries+bucketSize-1) / bucketSize;
+    buffer_.allocate(numEntries);
+    requests_.resize(numBuckets);
+    T* buf = buffer_.data();
+    SyncInfo<Device::CPU> syncInfo;
+
+    // Pack, starting the reduction of each bucket once it has been filled
+    Int offset = 0, numStarted = 0;
+    for(auto* A : cpuMatrices)
+    {
+        const Int height = A->Height();
+        const Int width = A->Width();
+        copy::util::InterleaveMatrix(
+            height, width,
+            A->LockedBuffer(), 1, A->LDim(),
+            &buf[offset],      1, height, syncInfo);
+        offset += height*width;
+        for(; numStarted<numBuckets; ++numStarted)
+        {
+            const Int bucketBeg = numStarted*bucketSize;
+            const Int bucketEnd = Min(bucketBeg+bucketSize, numEntries);
+            if(bucketEnd > offset)
+                break;
+            mpi::IAllReduce(
+                &buf[bucketBeg], int(bucketEnd-bucketBeg), op, comm,
+                requests_[numStarted]);
+        }
+    }
+
+    // Unpack each matrix once the buckets which it spans have been reduced
+    offset = 0;
+    Int numFinished = 0;
+    for(auto* A : cpuMatrices)
+    {
+        const Int height = A->Height();
+        const Int width = A->Width();
+        for(; numFinished*bucketSize<offset+height*width; ++numFinished)
+            mpi::Wait(requests_[numFinished]);
+        copy::util::InterleaveMatrix(
+            height, width,
+            &buf[offset], 1, height,
+            A->Buffer(),  1, A->LDim(), syncInfo);
+        offset += height*width;
+    }
+}
+
+template<typename T>
+void CoalescedAllReduce<T>::Execute(
+    const vector<AbstractDistMatrix<T>*>& matrices,
+    mpi::Comm const& comm, mpi::Op op)
+{
+    EL_DEBUG_CSE
+    vector<AbstractMatrix<T>*> localMatrices;
+    localMatrices.reserve(matrices.size());
+    for(auto* A : matrices)
+        if(A->Participating())
+            localMatrices.push_back(&A->Matrix());
+    Execute(localMatrices, comm, op);
+}
+
+template<typename T>
+void AllReduce(
+    const vector<AbstractMatrix<T>*>& matrices,
+    mpi::Comm const& comm, mpi::Op op)
+{
+    EL_DEBUG_CSE
+    CoalescedAllReduce<T> reduce;
+    reduce.Execute(matrices, comm, op);
+}
+
+template<typename T>
+void AllReduce(
+    const vector<AbstractDistMatrix<T>*>& matrices,
+    mpi::Comm const& comm, mpi::Op op)
+{
+    EL_DEBUG_CSE
+    CoalescedAllReduce<T> reduce;
+    reduce.Execute(matrices, comm, op);
+}
+
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
 #else
@@ -93,7 +214,14 @@ void AllReduce(AbstractDistMatrix<T>& A, mpi::Comm const& comm, mpi::Op op)
   EL_EXTERN template void AllReduce \
   (AbstractMatrix<T>& A, mpi::Comm const& comm, mpi::Op op); \
   EL_EXTERN template void AllReduce \
-  (AbstractDistMatrix<T>& A, mpi::Comm const& comm, mpi::Op op);
+  (AbstractDistMatrix<T>& A, mpi::Comm const& comm, mpi::Op op); \
+  EL_EXTERN template class CoalescedAllReduce<T>; \
+  EL_EXTERN template void AllReduce \
+  (const vector<AbstractMatrix<T>*>& matrices, \
+   mpi::Comm const& comm, mpi::Op op); \
+  EL_EXTERN template void AllReduce \
+  (const vector<AbstractDistMatrix<T>*>& matrices, \
+   mpi::Comm const& comm, mpi::Op op);
 
 #define EL_ENABLE_HALF
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -31,11 +31,14 @@ void AllGather
 
     auto syncHelper = MakeMultiSync(syncInfoB, syncInfoA);
 
+    // With node-shared storage, one process per node writes the result
+    B.NodeSharedBarrier();
     if( A.Participating() )
     {
         if( A.DistSize() == 1 )
         {
-            Copy( A.LockedMatrix(), B.Matrix() );
+            if( B.NodeSharedWriter() )
+                Copy( A.LockedMatrix(), B.Matrix() );
         }
         else
         {
@@ -68,16 +71,18 @@ void AllGather
                 syncInfoB);
 
             // Unpack
-            util::StridedUnpack(
-                height, width,
-                A.ColAlign(), colStride,
-                A.RowAlign(), rowStride,
-                recvBuf, portionSize,
-                B.Buffer(), B.LDim(), syncInfoB);
+            if( B.NodeSharedWriter() )
+                util::StridedUnpack(
+                    height, width,
+                    A.ColAlign(), colStride,
+                    A.RowAlign(), rowStride,
+                    recvBuf, portionSize,
+                    B.Buffer(), B.LDim(), syncInfoB);
         }
     }
     if (A.Grid().InGrid() && (!CongruentToCommSelf(A.CrossComm())))
         El::Broadcast( B, A.CrossComm(), A.Root() );
+    B.NodeSharedBarrier();
 }
 
 template<typename T,Dist U,Dist V>
@@ -49,7 +49,8 @@ void ColAllGather_impl(const ElementalMatrix<T>& A, ElementalMatrix<T>& B)
         {
             if (A.ColStride() == 1)
             {
-                Copy(A.LockedMatrix(), B.Matrix());
+                if (B.NodeSharedWriter())
+                    Copy(A.LockedMatrix(), B.Matrix());
             }
             else if (height == 1)
             {
@@ -80,10 +81,11 @@ void ColAllGather_impl(const ElementalMatrix<T>& A, ElementalMatrix<T>& B)
                     syncInfoB);
 
                 // Unpack
-                util::ColStridedUnpack(
-                    height, localWidth, A.ColAlign(), colStride,
-                    recvBuf,    portionSize,
-                    B.Buffer(), B.LDim(), syncInfoB);
+                if (B.NodeSharedWriter())
+                    util::ColStridedUnpack(
+                        height, localWidth, A.ColAlign(), colStride,
+                        recvBuf,    portionSize,
+                        B.Buffer(), B.LDim(), syncInfoB);
             }
         }
         else
@@ -166,10 +168,11 @@ void ColAllGather_impl(const ElementalMatrix<T>& A, ElementalMatrix<T>& B)
                     secondBuf, portionSize, A.ColComm(), syncInfoB);
 
                 // Unpack the contents of each member of the column team
-                util::ColStridedUnpack(
-                    height, B.LocalWidth(), A.ColAlign(), colStride,
-                    secondBuf,  portionSize,
-                    B.Buffer(), B.LDim(), syncInfoB);
+                if (B.NodeSharedWriter())
+                    util::ColStridedUnpack(
+                        height, B.LocalWidth(), A.ColAlign(), colStride,
+                        secondBuf,  portionSize,
+                        B.Buffer(), B.LDim(), syncInfoB);
             }
         }
     }
@@ -192,7 +195,10 @@ void ColAllGather
     switch (A.GetLocalDevice())
     {
     case Device::CPU:
+        // Node-shared storage of B is written by one process per node
+        B.NodeSharedBarrier();
         ColAllGather_impl<Device::CPU>(A,B);
+        B.NodeSharedBarrier();
         break;
 #ifdef HYDROGEN_HAVE_GPU
     case Device::GPU:
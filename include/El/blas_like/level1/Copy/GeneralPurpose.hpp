@@ -21,8 +21,9 @@ void Helper
 {
     EL_DEBUG_CSE
 
-    // TODO: Decide whether S or T should be used as the transmission type
-    //       based upon which is smaller. Transmit S by default.
+    // Transmit whichever of S and T is smaller
+    typedef typename std::conditional<(sizeof(T) < sizeof(S)),T,S>::type W;
+
     const Int height = A.Height();
     const Int width = A.Width();
     const Grid& g = B.Grid();
@@ -32,141 +33,216 @@ void Helper
     const int BRoot = B.Root();
 
     const bool includeViewers = (A.Grid() != B.Grid());
+    if (!includeViewers && !g.InGrid())
+        return;
+    mpi::Comm const& comm = (includeViewers ? g.ViewingComm() : g.VCComm());
+    const int commSize = mpi::Size(comm);
 
-    const Int localHeight = A.LocalHeight();
-    const Int localWidth = A.LocalWidth();
+    // We will first push to redundant rank 0 of B
+    const int redundantRootB = 0;
 
-    // TODO: Break into smaller pieces to avoid excessive memory usage?
-    vector<Entry<S>> remoteEntries;
-    vector<int> distOwners;
-    if (A.RedundantRank() == 0)
+    // Map the ranks of B's distribution onto the communicator
+    const int distBSize = B.DistSize();
+    vector<int> distBToComm(distBSize);
+    for(int distBRank=0; distBRank<distBSize; ++distBRank)
     {
-        const bool noRedundant = B.RedundantSize() == 1;
-        const int colStride = B.ColStride();
-        const int rowRank = B.RowRank();
-        const int colRank = B.ColRank();
-
-        vector<Int> globalRows(localHeight), localRows(localHeight);
-        vector<int> ownerRows(localHeight);
-        for(Int iLoc=0; iLoc<localHeight; ++iLoc)
-        {
-            const Int i = A.GlobalRow(iLoc);
-            const int ownerRow = B.RowOwner(i);
-            globalRows[iLoc] = i;
-            ownerRows[iLoc] = ownerRow;
-            localRows[iLoc] = B.LocalRow(i,ownerRow);
-        }
+        const int vcOwner =
+          g.CoordsToVC
+          (B.ColDist(),B.RowDist(),distBRank,BRoot,redundantRootB);
+        distBToComm[distBRank] =
+          (includeViewers ? g.VCToViewing(vcOwner) : vcOwner);
+    }
+
+    // The packing and unpacking is performed on host copies of
+    // device-resident local matrices
+    Matrix<S,Device::CPU> ALocHost;
+    if (A.GetLocalDevice() != Device::CPU)
+        Copy(A.LockedMatrix(), ALocHost);
+    auto const& ALoc =
+      (A.GetLocalDevice() == Device::CPU ?
+       static_cast<Matrix<S,Device::CPU> const&>(A.LockedMatrix()) :
+       ALocHost);
+    const S* ABuf = ALoc.LockedBuffer();
+    const Int ALDim = ALoc.LDim();
+
+    Matrix<T,Device::CPU> BLocHost;
+    if (B.GetLocalDevice() != Device::CPU)
+    {
+        BLocHost.Resize(B.LocalHeight(), B.LocalWidth());
+        Zero(BLocHost);
+    }
+    auto& BLoc =
+      (B.GetLocalDevice() == Device::CPU ?
+       static_cast<Matrix<T,Device::CPU>&>(B.Matrix()) :
+       BLocHost);
+    T* BBuf = BLoc.Buffer();
+    const Int BLDim = BLoc.LDim();
+
+    const bool sending = (A.RedundantRank() == 0);
+    const Int localHeight = (sending ? A.LocalHeight() : 0);
+    const Int localWidth = (sending ? A.LocalWidth() : 0);
+    const bool noRedundant = B.RedundantSize() == 1;
+    const int colStride = B.ColStride();
+    const int rowRank = B.RowRank();
+    const int colRank = B.ColRank();
 
-        remoteEntries.reserve(localHeight*localWidth);
-        distOwners.reserve(localHeight*localWidth);
-        for(Int jLoc=0; jLoc<localWidth; ++jLoc)
+    // Group the local rows of A by the process row of B which owns them and
+    // compress the local rows of B they map to into arithmetic runs. For
+    // elemental distributions, each group forms a single run, so that the
+    // only metadata shipped is one (row, column, length, stride) tuple per
+    // local column and destination rather than two indices per entry.
+    vector<vector<Int>> ownedRows(colStride);
+    vector<vector<Int>> rowRuns(colStride);
+    for(Int iLoc=0; iLoc<localHeight; ++iLoc)
+    {
+        const Int i = A.GlobalRow(iLoc);
+        const int ownerRow = B.RowOwner(i);
+        const Int localRow = B.LocalRow(i,ownerRow);
+        ownedRows[ownerRow].push_back(iLoc);
+
+        // Each run is stored as (first local row, length, stride)
+        auto& runs = rowRuns[ownerRow];
+        if (!runs.empty())
         {
-            const Int j = A.GlobalCol(jLoc);
-            const int ownerCol = B.ColOwner(j);
-            const Int localCol = B.LocalCol(j,ownerCol);
-            const bool isLocalCol = (BPartic && ownerCol == rowRank);
-            for(Int iLoc=0; iLoc<localHeight; ++iLoc)
+            const Int runSize = runs.size();
+            const Int first = runs[runSize-3];
+            Int& length = runs[runSize-2];
+            Int& stride = runs[runSize-1];
+            if (length == 1 && localRow > first)
             {
-                const int ownerRow = ownerRows[iLoc];
-                const Int localRow = localRows[iLoc];
-                const bool isLocalRow = (BPartic && ownerRow == colRank);
-                const S& alpha = A.GetLocal(iLoc,jLoc);
-                if (noRedundant && isLocalRow && isLocalCol)
-                {
-                    B.SetLocal(localRow,localCol,Caster<S,T>::Cast(alpha));
-                }
-                else
-                {
-                    remoteEntries.push_back
-                    (Entry<S>{localRow,localCol,alpha});
-                    distOwners.push_back(ownerRow + colStride*ownerCol);
-                }
+                stride = localRow - first;
+                ++length;
+                continue;
+            }
+            if (length > 1 && localRow == first + length*stride)
+            {
+                ++length;
+                continue;
             }
         }
+        runs.push_back(localRow);
+        runs.push_back(1);
+        runs.push_back(1);
     }
 
-    // We will first push to redundant rank 0 of B
-    const int redundantRootB = 0;
-
-    // Compute the metadata
-    // ====================
-    const Int totalSend = remoteEntries.size();
-    vector<int> sendCounts, owners(totalSend);
-    if (includeViewers)
+    vector<int> ownerCols(localWidth);
+    vector<Int> localCols(localWidth);
+    for(Int jLoc=0; jLoc<localWidth; ++jLoc)
     {
-        const int viewingSize = mpi::Size(g.ViewingComm());
-        const int distBSize = mpi::Size(B.DistComm());
+        const Int j = A.GlobalCol(jLoc);
+        ownerCols[jLoc] = B.ColOwner(j);
+        localCols[jLoc] = B.LocalCol(j,ownerCols[jLoc]);
+    }
+    auto isLocal = [&](int ownerRow, int ownerCol)
+    {
+        return noRedundant && BPartic &&
+               ownerRow == colRank && ownerCol == rowRank;
+    };
 
-        vector<int> distBToViewing(distBSize);
-        for(int distBRank=0; distBRank<distBSize; ++distBRank)
-        {
-            const int vcOwner =
-              g.CoordsToVC
-              (B.ColDist(),B.RowDist(),distBRank,BRoot,redundantRootB);
-            distBToViewing[distBRank] = g.VCToViewing(vcOwner);
-        }
+    // Bound the number of entries sent per round by whole local columns
+    const Int colsPerChunk =
+      Max(RedistChunkSize()/Max(localHeight,Int(1)), Int(1));
+    Int numChunks =
+      (localHeight > 0 ? (localWidth+colsPerChunk-1)/colsPerChunk : 0);
+    numChunks =
+      mpi::AllReduce(numChunks, mpi::MAX, comm, SyncInfo<Device::CPU>());
+
+    vector<int> valueCounts(commSize), valueOffs;
+    vector<int> runCounts(commSize), runOffs;
+    vector<W> sendValues;
+    vector<Int> sendRuns;
+    for(Int chunk=0; chunk<numChunks; ++chunk)
+    {
+        const Int jLocBeg = Min(chunk*colsPerChunk, localWidth);
+        const Int jLocEnd = Min(jLocBeg+colsPerChunk, localWidth);
 
-        sendCounts.resize(viewingSize,0);
-        for(Int k=0; k<totalSend; ++k)
+        // Compute the metadata
+        // ====================
+        std::fill(valueCounts.begin(), valueCounts.end(), 0);
+        std::fill(runCounts.begin(), runCounts.end(), 0);
+        for(Int jLoc=jLocBeg; jLoc<jLocEnd; ++jLoc)
         {
-            owners[k] = distBToViewing[distOwners[k]];
-            ++sendCounts[owners[k]];
+            const int ownerCol = ownerCols[jLoc];
+            for(int ownerRow=0; ownerRow<colStride; ++ownerRow)
+            {
+                if (ownedRows[ownerRow].empty() ||
+                    isLocal(ownerRow,ownerCol))
+                    continue;
+                const int owner =
+                  distBToComm[ownerRow+colStride*ownerCol];
+                valueCounts[owner] += ownedRows[ownerRow].size();
+                runCounts[owner] += 4*(rowRuns[ownerRow].size()/3);
+            }
         }
-    }
-    else
-    {
-        if (!g.InGrid())
-            return;
+        const int totalValues = Scan(valueCounts, valueOffs);
+        const int totalRuns = Scan(runCounts, runOffs);
 
-        const int distBSize = mpi::Size(B.DistComm());
-        vector<int> distBToVC(distBSize);
-        for(int distBRank=0; distBRank<distBSize; ++distBRank)
+        // Pack the data
+        // =============
+        FastResize(sendValues, totalValues);
+        FastResize(sendRuns, totalRuns);
+        auto valueOffsCopy = valueOffs;
+        auto runOffsCopy = runOffs;
+        for(Int jLoc=jLocBeg; jLoc<jLocEnd; ++jLoc)
         {
-            distBToVC[distBRank] =
-              g.CoordsToVC
-              (B.ColDist(),B.RowDist(),distBRank,BRoot,redundantRootB);
+            const int ownerCol = ownerCols[jLoc];
+            const Int localCol = localCols[jLoc];
+            const S* ACol = &ABuf[jLoc*ALDim];
+            for(int ownerRow=0; ownerRow<colStride; ++ownerRow)
+            {
+                const auto& rows = ownedRows[ownerRow];
+                const auto& runs = rowRuns[ownerRow];
+                if (rows.empty())
+                    continue;
+                if (isLocal(ownerRow,ownerCol))
+                {
+                    T* BCol = &BBuf[localCol*BLDim];
+                    Int k = 0;
+                    for(std::size_t r=0; r<runs.size(); r+=3)
+                        for(Int t=0; t<runs[r+1]; ++t, ++k)
+                            BCol[runs[r]+t*runs[r+2]] =
+                              Caster<S,T>::Cast(ACol[rows[k]]);
+                    continue;
+                }
+                const int owner =
+                  distBToComm[ownerRow+colStride*ownerCol];
+                int& runOff = runOffsCopy[owner];
+                for(std::size_t r=0; r<runs.size(); r+=3)
+                {
+                    sendRuns[runOff++] = runs[r];
+                    sendRuns[runOff++] = localCol;
+                    sendRuns[runOff++] = runs[r+1];
+                    sendRuns[runOff++] = runs[r+2];
+                }
+                int& valueOff = valueOffsCopy[owner];
+                for(const Int iLoc : rows)
+                    sendValues[valueOff++] = Caster<S,W>::Cast(ACol[iLoc]);
+            }
         }
 
-        const int vcSize = mpi::Size(g.VCComm());
-        sendCounts.resize(vcSize,0);
-        for(Int k=0; k<totalSend; ++k)
+        // Exchange and unpack the data
+        // ============================
+        auto recvRuns = mpi::AllToAll(sendRuns, runCounts, runOffs, comm);
+        auto recvValues =
+          mpi::AllToAll(sendValues, valueCounts, valueOffs, comm);
+        Int k = 0;
+        const Int recvRunsSize = recvRuns.size();
+        for(Int r=0; r<recvRunsSize; r+=4)
         {
-            owners[k] = distBToVC[distOwners[k]];
-            ++sendCounts[owners[k]];
+            const Int localRow = recvRuns[r];
+            const Int localCol = recvRuns[r+1];
+            const Int length = recvRuns[r+2];
+            const Int stride = recvRuns[r+3];
+            T* BCol = &BBuf[localRow+localCol*BLDim];
+            for(Int t=0; t<length; ++t, ++k)
+                BCol[t*stride] = Caster<W,T>::Cast(recvValues[k]);
         }
     }
-    SwapClear(distOwners);
-
-    // Pack the data
-    // =============
-    vector<int> sendOffs;
-    Scan(sendCounts, sendOffs);
-    vector<Entry<S>> sendBuf;
-    FastResize(sendBuf, totalSend);
-    auto offs = sendOffs;
-    for(Int k=0; k<totalSend; ++k)
-        sendBuf[offs[owners[k]]++] = remoteEntries[k];
-    SwapClear(remoteEntries);
-    SwapClear(owners);
-
-    // Exchange and unpack the data
-    // ============================
-    auto recvBuf = mpi::AllToAll(
-        sendBuf, sendCounts, sendOffs,
-        includeViewers ? g.ViewingComm(): g.VCComm());
+
+    if (B.GetLocalDevice() != Device::CPU)
+        Copy(BLocHost, B.Matrix());
     if (BPartic)
-    {
-        if (B.RedundantRank() == redundantRootB)
-        {
-            Int recvBufSize = recvBuf.size();
-            for(Int k=0; k<recvBufSize; ++k)
-            {
-                const auto& entry = recvBuf[k];
-                B.SetLocal(entry.i,entry.j,Caster<S,T>::Cast(entry.value));
-            }
-        }
         El::Broadcast(B, B.RedundantComm(), redundantRootB);
-    }
 }
 
 template<typename S,typename T,typename>
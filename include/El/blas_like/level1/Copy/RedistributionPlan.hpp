@@ -0,0 +1,360 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_COPY_REDISTRIBUTIONPLAN_HPP
+#define EL_BLAS_COPY_REDISTRIBUTIONPLAN_HPP
+
+#include <climits>
+#include <memory>
+#include <type_traits>
+
+namespace El
+{
+
+/** @class RedistributionPlan
+ *  @brief A precomputed redistribution between two elemental
+ *         distributions of a matrix of fixed size.
+ *
+ *  Building the plan determines, once and for all, which local entries
+ *  are exchanged with which processes and in what order; Execute() then
+ *  only packs, communicates, and unpacks. No indices are transmitted,
+ *  since both sides of every message enumerate its entries in the same
+ *  (column-major) order. For trivially-copyable types, each message is
+ *  a persistent point-to-point request over a private communicator.
+ *
+ *  The plan is collective over the viewing communicator of the target
+ *  grid (or its VC communicator if both matrices share a grid), and so is
+ *  each call to Execute().
+ */
+template<typename T>
+class RedistributionPlan
+{
+public:
+    RedistributionPlan
+    (const DistData& AData, const DistData& BData, Int height, Int width);
+    ~RedistributionPlan();
+
+    RedistributionPlan(const RedistributionPlan&) = delete;
+    RedistributionPlan& operator=(const RedistributionPlan&) = delete;
+
+    Int Height() const EL_NO_EXCEPT { return height_; }
+    Int Width() const EL_NO_EXCEPT { return width_; }
+
+    /** @brief Overwrite B with A. A must match the source distribution
+     *         and size of the plan and B must match the target
+     *         distribution (B is resized as needed).
+     */
+    void Execute(const ElementalMatrix<T>& A, ElementalMatrix<T>& B);
+
+private:
+    // A message with one peer: the entries in the given groups of local
+    // rows and columns, stored at 'offset' in the send/receive buffer
+    struct Message
+    {
+        int peer;
+        int rowGroup, colGroup;
+        Int offset, size;
+    };
+
+    static std::unique_ptr<ElementalMatrix<T>>
+    Prototype(const DistData& data);
+    static bool Matches(const DistData& data, const DistData& expected);
+
+    DistData AData_, BData_;
+    Int height_, width_;
+    Int BRedundantSize_;
+    mpi::Comm comm_;
+
+    // Local rows (columns) of A grouped by the process row (column) of B
+    // which owns them, and vice versa
+    vector<vector<Int>> sendRows_, sendCols_;
+    vector<vector<Int>> recvRows_, recvCols_;
+    vector<Message> sends_, recvs_;
+
+    vector<T> sendBuf_, recvBuf_;
+    bool persistent_;
+    vector<MPI_Request> requests_;
+    vector<int> sendCounts_, sendDispls_, recvCounts_, recvDispls_;
+};
+
+template<typename T>
+std::unique_ptr<ElementalMatrix<T>>
+RedistributionPlan<T>::Prototype(const DistData& data)
+{
+    EL_DEBUG_CSE
+    std::unique_ptr<ElementalMatrix<T>> A;
+    #define GUARD(CDIST,RDIST,WRAP) \
+      data.colDist == CDIST && data.rowDist == RDIST && WRAP == ELEMENT
+    #define PAYLOAD(CDIST,RDIST,WRAP) \
+      A.reset(new DistMatrix<T,CDIST,RDIST>(*data.grid, data.root));
+    #include <El/macros/GuardAndPayload.h>
+    if (!A)
+        LogicError("RedistributionPlan: Unsupported distribution");
+    A->Align(data.colAlign, data.rowAlign);
+    return A;
+}
+
+template<typename T>
+bool RedistributionPlan<T>::Matches
+(const DistData& data, const DistData& expected)
+{
+    return data.colDist == expected.colDist &&
+           data.rowDist == expected.rowDist &&
+           data.colAlign == expected.colAlign &&
+           data.rowAlign == expected.rowAlign &&
+           data.root == expected.root &&
+           data.grid == expected.grid;
+}
+
+template<typename T>
+RedistributionPlan<T>::RedistributionPlan
+(const DistData& AData, const DistData& BData, Int height, Int width)
+: AData_(AData), BData_(BData), height_(height), width_(width),
+  persistent_(false)
+{
+    EL_DEBUG_CSE
+    if (AData.blockHeight != 1 || AData.blockWidth != 1 ||
+        BData.blockHeight != 1 || BData.blockWidth != 1)
+        LogicError("RedistributionPlan: Only elemental distributions");
+    auto A = Prototype(AData);
+    auto B = Prototype(BData);
+    BRedundantSize_ = B->RedundantSize();
+
+    const Grid& g = *BData.grid;
+    const bool includeViewers = (AData.grid != BData.grid);
+    if (!includeViewers && !g.InGrid())
+        return;
+    mpi::Dup(includeViewers ? g.ViewingComm() : g.VCComm(), comm_);
+    const int commSize = mpi::Size(comm_);
+
+    // Find the process holding each piece of A and of B
+    const bool sending = A->Participating() && A->RedundantRank() == 0;
+    const bool receiving = B->Participating() && B->RedundantRank() == 0;
+    const int myCoords[4] =
+      { sending ? A->ColRank() : -1, sending ? A->RowRank() : -1,
+        receiving ? B->ColRank() : -1, receiving ? B->RowRank() : -1 };
+    vector<int> coords(4*commSize);
+    mpi::AllGather
+    (myCoords, 4, coords.data(), 4, comm_, SyncInfo<Device::CPU>());
+    const int colStrideA = A->ColStride(), rowStrideA = A->RowStride();
+    const int colStrideB = B->ColStride(), rowStrideB = B->RowStride();
+    vector<int> ownerA(colStrideA*rowStrideA,-1);
+    vector<int> ownerB(colStrideB*rowStrideB,-1);
+    for (int q=0; q<commSize; ++q)
+    {
+        if (coords[4*q] >= 0)
+            ownerA[coords[4*q]+colStrideA*coords[4*q+1]] = q;
+        if (coords[4*q+2] >= 0)
+            ownerB[coords[4*q+2]+colStrideB*coords[4*q+3]] = q;
+    }
+
+    // Group the local entries of A by their owners in B...
+    sendRows_.resize(colStrideB);
+    sendCols_.resize(rowStrideB);
+    if (sending)
+    {
+        const Int localHeight = Length(height, A->ColShift(), colStrideA);
+        const Int localWidth = Length(width, A->RowShift(), rowStrideA);
+        for (Int iLoc=0; iLoc<localHeight; ++iLoc)
+            sendRows_[B->RowOwner(A->GlobalRow(iLoc))].push_back(iLoc);
+        for (Int jLoc=0; jLoc<localWidth; ++jLoc)
+            sendCols_[B->ColOwner(A->GlobalCol(jLoc))].push_back(jLoc);
+    }
+    // ...and the local entries of B by their owners in A
+    recvRows_.resize(colStrideA);
+    recvCols_.resize(rowStrideA);
+    if (receiving)
+    {
+        const Int localHeight = Length(height, B->ColShift(), colStrideB);
+        const Int localWidth = Length(width, B->RowShift(), rowStrideB);
+        for (Int iLoc=0; iLoc<localHeight; ++iLoc)
+            recvRows_[A->RowOwner(B->GlobalRow(iLoc))].push_back(iLoc);
+        for (Int jLoc=0; jLoc<localWidth; ++jLoc)
+            recvCols_[A->ColOwner(B->GlobalCol(jLoc))].push_back(jLoc);
+    }
+
+    auto buildMessages =
+      [](const vector<vector<Int>>& rows, const vector<vector<Int>>& cols,
+         const vector<int>& owner, vector<Message>& messages)
+      {
+          const int colStride = rows.size();
+          Int offset = 0;
+          for (int colGroup=0; colGroup<int(cols.size()); ++colGroup)
+              for (int rowGroup=0; rowGroup<colStride; ++rowGroup)
+              {
+                  const Int size =
+                    rows[rowGroup].size()*cols[colGroup].size();
+                  if (size == 0)
+                      continue;
+                  messages.push_back(Message{
+                    owner[rowGroup+colStride*colGroup],
+                    rowGroup, colGroup, offset, size});
+                  offset += size;
+              }
+          return offset;
+      };
+    sendBuf_.resize(buildMessages(sendRows_, sendCols_, ownerB, sends_));
+    recvBuf_.resize(buildMessages(recvRows_, recvCols_, ownerA, recvs_));
+
+    // Persistent requests require a fixed-size byte representation
+    Int maxBytes = 0;
+    for (const auto& message : sends_)
+        maxBytes = Max(maxBytes, message.size*Int(sizeof(T)));
+    for (const auto& message : recvs_)
+        maxBytes = Max(maxBytes, message.size*Int(sizeof(T)));
+    persistent_ =
+      std::is_trivially_copyable<T>::value && maxBytes <= INT_MAX;
+    if (persistent_)
+    {
+        MPI_Comm mpiComm = comm_.GetMPIComm();
+        requests_.resize(recvs_.size()+sends_.size());
+        MPI_Request* request = requests_.data();
+        for (const auto& message : recvs_)
+            EL_CHECK_MPI_CALL(
+              MPI_Recv_init
+              (&recvBuf_[message.offset], message.size*sizeof(T), MPI_BYTE,
+               message.peer, 0, mpiComm, request++));
+        for (const auto& message : sends_)
+            EL_CHECK_MPI_CALL(
+              MPI_Send_init
+              (&sendBuf_[message.offset], message.size*sizeof(T), MPI_BYTE,
+               message.peer, 0, mpiComm, request++));
+    }
+    else
+    {
+        sendCounts_.assign(commSize, 0);
+        sendDispls_.assign(commSize, 0);
+        recvCounts_.assign(commSize, 0);
+        recvDispls_.assign(commSize, 0);
+        for (const auto& message : sends_)
+            sendCounts_[message.peer] += message.size;
+        for (const auto& message : recvs_)
+            recvCounts_[message.peer] += message.size;
+        Scan(sendCounts_, sendDispls_);
+        Scan(recvCounts_, recvDispls_);
+
+        // The collective path requires the messages to be ordered by peer
+        auto byPeer = [](const Message& a, const Message& b)
+          { return a.peer < b.peer; };
+        std::stable_sort(sends_.begin(), sends_.end(), byPeer);
+        std::stable_sort(recvs_.begin(), recvs_.end(), byPeer);
+        Int offset = 0;
+        for (auto& message : sends_)
+        {
+            message.offset = offset;
+            offset += message.size;
+        }
+        offset = 0;
+        for (auto& message : recvs_)
+        {
+            message.offset = offset;
+            offset += message.size;
+        }
+    }
+}
+
+template<typename T>
+RedistributionPlan<T>::~RedistributionPlan()
+{
+    if (!mpi::Finalized())
+        for (auto& request : requests_)
+            MPI_Request_free(&request);
+}
+
+template<typename T>
+void RedistributionPlan<T>::Execute
+(const ElementalMatrix<T>& A, ElementalMatrix<T>& B)
+{
+    EL_DEBUG_CSE
+    if (A.Height() != height_ || A.Width() != width_)
+        LogicError
+        ("RedistributionPlan: Expected a ",height_," x ",width_,
+         " matrix but got ",A.Height()," x ",A.Width());
+    if (!Matches(A.DistData(), AData_))
+        LogicError("RedistributionPlan: Source distribution does not match");
+    if (!Matches(B.DistData(), BData_))
+        LogicError("RedistributionPlan: Target distribution does not match");
+    B.Resize(height_, width_);
+    if (comm_.GetMPIComm() == MPI_COMM_NULL)
+        return;
+
+    // The packing and unpacking is performed on host copies of
+    // device-resident local matrices
+    Matrix<T,Device::CPU> ALocHost, BLocHost;
+    if (A.GetLocalDevice() != Device::CPU)
+        Copy(A.LockedMatrix(), ALocHost);
+    auto const& ALoc =
+      (A.GetLocalDevice() == Device::CPU ?
+       static_cast<Matrix<T,Device::CPU> const&>(A.LockedMatrix()) :
+       ALocHost);
+    if (B.GetLocalDevice() != Device::CPU)
+        BLocHost.Resize(B.LocalHeight(), B.LocalWidth());
+    auto& BLoc =
+      (B.GetLocalDevice() == Device::CPU ?
+       static_cast<Matrix<T,Device::CPU>&>(B.Matrix()) :
+       BLocHost);
+
+    // Pack
+    const T* ABuf = ALoc.LockedBuffer();
+    const Int ALDim = ALoc.LDim();
+    for (const auto& message : sends_)
+    {
+        T* buf = &sendBuf_[message.offset];
+        const auto& rows = sendRows_[message.rowGroup];
+        for (const Int jLoc : sendCols_[message.colGroup])
+        {
+            const T* ACol = &ABuf[jLoc*ALDim];
+            for (const Int iLoc : rows)
+                *buf++ = ACol[iLoc];
+        }
+    }
+
+    // Communicate
+    if (persistent_)
+    {
+        if (!requests_.empty())
+        {
+            EL_CHECK_MPI_CALL(
+              MPI_Startall(requests_.size(), requests_.data()));
+            EL_CHECK_MPI_CALL(
+              MPI_Waitall
+              (requests_.size(), requests_.data(), MPI_STATUSES_IGNORE));
+        }
+    }
+    else
+    {
+        mpi::AllToAll
+        (sendBuf_.data(), sendCounts_.data(), sendDispls_.data(),
+         recvBuf_.data(), recvCounts_.data(), recvDispls_.data(),
+         comm_, SyncInfo<Device::CPU>());
+    }
+
+    // Unpack
+    T* BBuf = BLoc.Buffer();
+    const Int BLDim = BLoc.LDim();
+    for (const auto& message : recvs_)
+    {
+        const T* buf = &recvBuf_[message.offset];
+        const auto& rows = recvRows_[message.rowGroup];
+        for (const Int jLoc : recvCols_[message.colGroup])
+        {
+            T* BCol = &BBuf[jLoc*BLDim];
+            for (const Int iLoc : rows)
+                BCol[iLoc] = *buf++;
+        }
+    }
+
+    if (B.GetLocalDevice() != Device::CPU)
+        Copy(BLocHost, B.Matrix());
+    if (BRedundantSize_ > 1 && B.Participating())
+        El::Broadcast(B, B.RedundantComm(), 0);
+}
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_COPY_REDISTRIBUTIONPLAN_HPP
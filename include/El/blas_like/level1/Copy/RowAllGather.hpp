@@ -34,7 +34,8 @@ void RowAllGather_impl(const ElementalMatrix<T>& A, ElementalMatrix<T>& B)
         {
             if (A.RowStride() == 1)
             {
-                Copy(A.LockedMatrix(), B.Matrix());
+                if (B.NodeSharedWriter())
+                    Copy(A.LockedMatrix(), B.Matrix());
             }
             else if (width == 1)
             {
@@ -68,11 +69,12 @@ void RowAllGather_impl(const ElementalMatrix<T>& A, ElementalMatrix<T>& B)
                     syncInfoB);
 
                 // Unpack
-                util::RowStridedUnpack(
-                    localHeight, width, A.RowAlign(), rowStride,
-                    recvBuf, portionSize,
-                    B.Buffer(), B.LDim(),
-                    syncInfoB);
+                if (B.NodeSharedWriter())
+                    util::RowStridedUnpack(
+                        localHeight, width, A.RowAlign(), rowStride,
+                        recvBuf, portionSize,
+                        B.Buffer(), B.LDim(),
+                        syncInfoB);
             }
         }
         else
@@ -130,10 +132,11 @@ void RowAllGather_impl(const ElementalMatrix<T>& A, ElementalMatrix<T>& B)
                     secondBuf, portionSize, A.RowComm(), syncInfoB);
 
                 // Unpack
-                util::RowStridedUnpack(
-                    localHeightB, width, A.RowAlign(), rowStride,
-                    secondBuf, portionSize,
-                    B.Buffer(), B.LDim(), syncInfoB);
+                if (B.NodeSharedWriter())
+                    util::RowStridedUnpack(
+                        localHeightB, width, A.RowAlign(), rowStride,
+                        secondBuf, portionSize,
+                        B.Buffer(), B.LDim(), syncInfoB);
             }
         }
     }
@@ -162,7 +165,10 @@ void RowAllGather
     switch (A.GetLocalDevice())
     {
     case Device::CPU:
+        // Node-shared storage of B is written by one process per node
+        B.NodeSharedBarrier();
         RowAllGather_impl<Device::CPU>(A,B);
+        B.NodeSharedBarrier();
         break;
 #ifdef HYDROGEN_HAVE_GPU
     case Device::GPU:
@@ -20,88 +20,59 @@ void TranslateBetweenGrids(
   DistMatrix<T,U,V,ELEMENT,D1> const& A,
   DistMatrix<T,U,V,ELEMENT,D2>& B)
 {
-    EL_DEBUG_CSE
-    DistMatrix<T,CIRC,CIRC,ELEMENT,D2> ACirc(A.Grid(), A.Root()), BCirc(B.Grid(), B.Root());
-    ACirc.Resize(A.Height(), A.Width());
-    BCirc.Resize(A.Height(), A.Width());
-    B.Resize(A.Height(), A.Width());
-    if (A.Participating()) {
-      El::Copy(A, ACirc);
-    }
-    TranslateBetweenGrids(ACirc, BCirc);
-    if (B.Participating()) {
-      El::Copy(BCirc, B);
-    }
-}
-
-template<typename T, Device D>
-void TranslateBetweenGrids(
-  DistMatrix<T,CIRC,CIRC,ELEMENT,D> const& A,
-  DistMatrix<T,CIRC,CIRC,ELEMENT,D>& B)
-{
+  EL_DEBUG_CSE
 
-  // Matrix dimensions
-  const Int m = A.Height();
-  const Int n = A.Width();
-  B.Resize(m, n);
-  if (m <= 0 || n <= 0) {
-    return;
-  }
-
-  const bool amRootA = A.IsLocalCol(0);
-  const bool amRootB = B.IsLocalCol(0);
-  mpi::Comm const& viewingCommB = B.Grid().ViewingComm();
-  if (amRootA && amRootB) {
-    El::Copy(A.LockedMatrix(), B.Matrix());
-  }
-  else if (amRootA) {
-    const Int recvViewingRank = B.Grid().VCToViewing(B.Root());
-    El::Send(A.LockedMatrix(), viewingCommB, recvViewingRank);
-  }
-  else if (amRootB) {
-    mpi::Group owningGroupA = A.Grid().OwningGroup();
-    const Int sendViewingRank = mpi::Translate(
-      owningGroupA,
-      A.Root(),
-      viewingCommB);
-    if (sendViewingRank < 0 || sendViewingRank >= viewingCommB.Size()) {
-      LogicError(
-        "TranslateBetweenGrids: Owning group for matrix A "
-        "is not a subset of viewing communicator for matrix B");
-    }
-    El::Recv(B.Matrix(), viewingCommB, sendViewingRank);
-  }
-
-}
-
-template<typename T, Device D>
-void TranslateBetweenGrids(
-  DistMatrix<T,MC,MR,ELEMENT,D> const& A,
-  DistMatrix<T,MC,MR,ELEMENT,D>& B)
-{
-  EL_DEBUG_CSE;
-
-  // See TranslateBetweenGrids implementation for [STAR,VC] matrices
-  // for a description of the algorithm. The [MC,MR] matrix
-  // implementation is similar, except it is 2D.
+  /* Overview
+     Each process only exchanges the entries it owns with the processes
+     that own them in the other grid, so that no process ever holds more
+     than its own local matrices.
+
+     Since A's local rows are spaced colStrideA apart, the owners in B of
+     local rows iLocA and iLocA+colStrideB/GCD(colStrideA,colStrideB)
+     coincide. The local rows of A therefore split into numColSends
+     interleaved sets, each of which is owned by a single process row of
+     B, where it forms one of numColRecvs interleaved sets of B's local
+     rows; likewise for the columns. Every pair of processes thus
+     exchanges at most one interleaved submatrix, and they can be routed
+     with a single AllToAll over B's viewing communicator without any
+     metadata. Only the first member of each redundant group of A sends,
+     only the first member of each redundant group of B receives, and the
+     result is then broadcast within B's redundant groups. Every process
+     in B's viewing communicator must call this routine.
+  */
 
   // Matrix dimensions
   const Int m = A.Height();
   const Int n = A.Width();
   B.Resize(m, n);
-  const Int mLocA = A.LocalHeight();
-  const Int nLocA = A.LocalWidth();
-  const Int mLocB = B.LocalHeight();
-  const Int nLocB = B.LocalWidth();
-
-  // Return immediately if there is no local data
   const bool inAGrid = A.Participating();
   const bool inBGrid = B.Participating();
-  if (!inAGrid && !inBGrid) {
-    return;
+  const bool sending = inAGrid && A.RedundantRank() == 0;
+  const bool receiving = inBGrid && B.RedundantRank() == 0;
+
+  // Work with a copy of A's local matrix on B's device if they differ
+  Matrix<T,D2> ALocCopy;
+  if (D1 != D2 && sending) {
+    Copy(A.LockedMatrix(), ALocCopy);
   }
+  auto const& ALoc =
+    (D1 == D2 ?
+     static_cast<Matrix<T,D2> const&>(
+       static_cast<AbstractMatrix<T> const&>(A.LockedMatrix())) :
+     ALocCopy);
+  auto& BLoc = B.Matrix();
+  const Int mLocA = (sending ? A.LocalHeight() : 0);
+  const Int nLocA = (sending ? A.LocalWidth() : 0);
+  const Int mLocB = (receiving ? B.LocalHeight() : 0);
+  const Int nLocB = (receiving ? B.LocalWidth() : 0);
 
-  // Compute the number of messages to send/recv
+  // Synchronize compute streams
+  SyncInfo<D2> syncInfoA = SyncInfoFromMatrix(ALoc);
+  SyncInfo<D2> syncInfoB = SyncInfoFromMatrix(BLoc);
+  auto syncHelper = MakeMultiSync(syncInfoB, syncInfoA);
+  const SyncInfo<D2>& syncInfo = syncHelper;
+
+  // Compute the number of interleaved sets of rows and columns
   const Int colStrideA = A.ColStride();
   const Int rowStrideA = A.RowStride();
   const Int colStrideB = B.ColStride();
@@ -113,157 +84,169 @@ void TranslateBetweenGrids(
   const Int numColRecvs = Min(colStrideA/colStrideGCD, mLocB);
   const Int numRowRecvs = Min(rowStrideA/rowStrideGCD, nLocB);
 
-  // Synchronize compute streams
-  SyncInfo<D> syncInfoA = SyncInfoFromMatrix(A.LockedMatrix());
-  SyncInfo<D> syncInfoB = SyncInfoFromMatrix(B.Matrix());
-  auto syncHelper = MakeMultiSync(syncInfoB, syncInfoA);
-  const SyncInfo<D>& syncInfo = syncHelper;
-
-  // Translate the ranks from A's VC communicator to B's viewing so
-  // that we can match send/recv communicators. Since A's VC
-  // communicator is not necessarily defined on every process, we
-  // instead work with A's owning group.
+  // Map the first member of each redundant group of A and B onto B's
+  // viewing communicator. Since A's VC communicator is not necessarily
+  // defined on every process, A's ranks are translated through its
+  // owning group, which is ordered like its VR communicator when the
+  // grid is row-major.
   mpi::Comm const& viewingCommB = B.Grid().ViewingComm();
-  mpi::Group owningGroupA = A.Grid().OwningGroup();
-  const int sizeA = A.Grid().Size();
-  vector<int> viewingRanksA(sizeA), owningRanksA(sizeA);
-  if(A.Grid().Order() == COLUMN_MAJOR) {
-    std::iota(owningRanksA.begin(), owningRanksA.end(), 0);
-  }
-  else {
-    // The (i,j) = i + j*colStrideA rank in the column-major ordering is
-    // equal to the j + i*rowStrideA rank in a row-major ordering.
-    // Since we desire rankMap[i+j*colStrideA] to correspond to process
-    // (i,j) in A's grid's rank in this viewing group, ranks[i+j*colStrideA]
-    // should correspond to process (i,j) in A's owning group. Since the
-    // owning group is ordered row-major in this case, its rank is
-    // j+i*rowStrideA. Note that setting
-    // ranks[j+i*rowStrideA] = i+j*colStrideA is *NOT* valid.
-    for (int i=0; i<colStrideA; ++i) {
-      for (int j=0; j<rowStrideA; ++j) {
-        owningRanksA[i+j*colStrideA] = j+i*rowStrideA;
-      }
-    }
+  const int viewingRank = viewingCommB.Rank();
+  const int viewingSize = viewingCommB.Size();
+  const Grid& gridA = A.Grid();
+  const Grid& gridB = B.Grid();
+  const int distSizeA = A.DistSize();
+  const int distSizeB = B.DistSize();
+  vector<int> distAToViewing(distSizeA), owningRanksA(distSizeA);
+  for (int distRank=0; distRank<distSizeA; ++distRank) {
+    const int vcRank =
+      gridA.CoordsToVC(A.ColDist(), A.RowDist(), distRank, A.Root());
+    owningRanksA[distRank] =
+      (gridA.Order() == COLUMN_MAJOR ? vcRank : gridA.VCToVR(vcRank));
   }
   mpi::Translate(
-    owningGroupA, sizeA, owningRanksA.data(),
-    viewingCommB, viewingRanksA.data());
-  const Int colRankA = A.ColRank();
-  const Int rowRankA = A.RowRank();
-  const Int colRankB = B.ColRank();
-  const Int rowRankB = B.RowRank();
-  const Int viewingRank = viewingCommB.Rank();
-  if (viewingRank < 0 || viewingRank >= viewingCommB.Size()) {
+    gridA.OwningGroup(), distSizeA, owningRanksA.data(),
+    viewingCommB, distAToViewing.data());
+  vector<int> distBToViewing(distSizeB);
+  for (int distRank=0; distRank<distSizeB; ++distRank) {
+    distBToViewing[distRank] = gridB.VCToViewing(
+      gridB.CoordsToVC(B.ColDist(), B.RowDist(), distRank, B.Root()));
+  }
+  if (sending &&
+      distAToViewing[A.ColRank()+colStrideA*A.RowRank()] != viewingRank) {
     LogicError(
       "TranslateBetweenGrids: Owning group for matrix A "
       "is not a subset of viewing communicator for matrix B");
   }
 
-  // Workspace buffer to pack/unpack data
-  Int messageBufSize = 0;
-  if (inAGrid && numColSends > 0 && numRowSends > 0) {
-    messageBufSize = Max(
-      MaxLength(mLocA,numColSends)*MaxLength(nLocA,numRowSends),
-      messageBufSize);
+  // Count the entries of each message, copying the block this process
+  // sends to itself directly
+  vector<int> sendCounts(viewingSize,0), recvCounts(viewingSize,0);
+  for (Int jLocA=0; jLocA<numRowSends; ++jLocA) {
+    const Int j = A.GlobalCol(jLocA);
+    const Int width = Length(nLocA, jLocA, numRowSends);
+    for (Int iLocA=0; iLocA<numColSends; ++iLocA) {
+      const Int i = A.GlobalRow(iLocA);
+      const int recvRank =
+        distBToViewing[B.RowOwner(i)+colStrideB*B.ColOwner(j)];
+      const Int height = Length(mLocA, iLocA, numColSends);
+      if (recvRank == viewingRank) {
+        copy::util::InterleaveMatrix(
+          height, width,
+          ALoc.LockedBuffer(iLocA,jLocA),
+          numColSends, numRowSends*ALoc.LDim(),
+          BLoc.Buffer(B.LocalRow(i),B.LocalCol(j)),
+          numColRecvs, numRowRecvs*BLoc.LDim(),
+          syncInfo);
+      }
+      else {
+        sendCounts[recvRank] = height*width;
+      }
+    }
   }
-  if (inBGrid && numColRecvs > 0 && numRowRecvs > 0) {
-    messageBufSize = Max(
-      MaxLength(mLocB,numColRecvs)*MaxLength(nLocB,numRowRecvs),
-      messageBufSize);
+  for (Int jLocB=0; jLocB<numRowRecvs; ++jLocB) {
+    const Int j = B.GlobalCol(jLocB);
+    const Int width = Length(nLocB, jLocB, numRowRecvs);
+    for (Int iLocB=0; iLocB<numColRecvs; ++iLocB) {
+      const Int i = B.GlobalRow(iLocB);
+      const int sendRank =
+        distAToViewing[A.RowOwner(i)+colStrideA*A.ColOwner(j)];
+      if (sendRank != viewingRank) {
+        recvCounts[sendRank] =
+          Length(mLocB, iLocB, numColRecvs)*width;
+      }
+    }
   }
-  simple_buffer<T,D> messageBuf(messageBufSize, syncInfo);
+  vector<int> sendOffs, recvOffs;
+  const int totalSend = Scan(sendCounts, sendOffs);
+  const int totalRecv = Scan(recvCounts, recvOffs);
 
-  // Figure out which ranks to send/recv messages
-  std::map<Int,std::pair<Int,Int>> messageColRanks, messageRowRanks;
-  for (Int iLocA=0; iLocA<numColSends; ++iLocA) {
-    const Int i = A.GlobalRow(iLocA);
-    const Int recvColRank = B.RowOwner(i);
-    messageColRanks[i] = std::pair<Int,Int>(colRankA, recvColRank);
-  }
+  // Pack the messages
+  simple_buffer<T,D2> sendBuf(totalSend, syncInfo);
+  simple_buffer<T,D2> recvBuf(totalRecv, syncInfo);
   for (Int jLocA=0; jLocA<numRowSends; ++jLocA) {
     const Int j = A.GlobalCol(jLocA);
-    const Int recvRowRank = B.ColOwner(j);
-    messageRowRanks[j] = std::pair<Int,Int>(rowRankA, recvRowRank);
-  }
-  for (Int iLocB=0; iLocB<numColRecvs; ++iLocB) {
-    const Int i = B.GlobalRow(iLocB);
-    const Int sendColRank = A.RowOwner(i);
-    messageColRanks[i] = std::pair<Int,Int>(sendColRank, colRankB);
+    for (Int iLocA=0; iLocA<numColSends; ++iLocA) {
+      const Int i = A.GlobalRow(iLocA);
+      const int recvRank =
+        distBToViewing[B.RowOwner(i)+colStrideB*B.ColOwner(j)];
+      if (recvRank == viewingRank) {
+        continue;
+      }
+      const Int height = Length(mLocA, iLocA, numColSends);
+      copy::util::InterleaveMatrix(
+        height, Length(nLocA, jLocA, numRowSends),
+        ALoc.LockedBuffer(iLocA,jLocA),
+        numColSends, numRowSends*ALoc.LDim(),
+        sendBuf.data()+sendOffs[recvRank], 1, height,
+        syncInfo);
+    }
   }
+
+  // Exchange and unpack the messages
+  mpi::AllToAll(
+    sendBuf.data(), sendCounts.data(), sendOffs.data(),
+    recvBuf.data(), recvCounts.data(), recvOffs.data(),
+    viewingCommB, syncInfo);
   for (Int jLocB=0; jLocB<numRowRecvs; ++jLocB) {
     const Int j = B.GlobalCol(jLocB);
-    const Int sendRowRank = A.ColOwner(j);
-    messageRowRanks[j] = std::pair<Int,Int>(sendRowRank, rowRankB);
+    for (Int iLocB=0; iLocB<numColRecvs; ++iLocB) {
+      const Int i = B.GlobalRow(iLocB);
+      const int sendRank =
+        distAToViewing[A.RowOwner(i)+colStrideA*A.ColOwner(j)];
+      if (sendRank == viewingRank) {
+        continue;
+      }
+      const Int height = Length(mLocB, iLocB, numColRecvs);
+      copy::util::InterleaveMatrix(
+        height, Length(nLocB, jLocB, numRowRecvs),
+        recvBuf.data()+recvOffs[sendRank], 1, height,
+        BLoc.Buffer(iLocB,jLocB),
+        numColRecvs, numRowRecvs*BLoc.LDim(),
+        syncInfo);
+    }
   }
 
-  // Send/recv messages
-  for (auto const& rowInfo : messageRowRanks) {
-    for (auto const& colInfo : messageColRanks) {
-      const Int i = colInfo.first;
-      const Int j = rowInfo.first;
-      const Int sendColRank = colInfo.second.first;
-      const Int sendRowRank = rowInfo.second.first;
-      const Int recvColRank = colInfo.second.second;
-      const Int recvRowRank = rowInfo.second.second;
-
-      // Figure out source and target ranks
-      const Int sendVCRank = sendColRank + sendRowRank*colStrideA;
-      const Int recvVCRank = recvColRank + recvRowRank*colStrideB;
-      const Int sendViewingRank = viewingRanksA[sendVCRank];
-      const Int recvViewingRank = B.Grid().VCToViewing(recvVCRank);
-
-      // Figure out message size and offset
-      Int iLocA = -1;
-      Int jLocA = -1;
-      Int iLocB = -1;
-      Int jLocB = -1;
-      Int messageHeight = 0;
-      Int messageWidth = 0;
-      if (viewingRank == sendViewingRank) {
-        iLocA = A.LocalRow(i);
-        jLocA = A.LocalCol(j);
-        messageHeight = Length(mLocA, iLocA, numColSends);
-        messageWidth = Length(nLocA, jLocA, numRowSends);
-      }
-      if (viewingRank == recvViewingRank) {
-        iLocB = B.LocalRow(i);
-        jLocB = B.LocalCol(j);
-        messageHeight = Length(mLocB, iLocB, numColRecvs);
-        messageWidth = Length(nLocB, jLocB, numRowRecvs);
-      }
+  if (inBGrid && B.RedundantSize() > 1) {
+    El::Broadcast(BLoc, B.RedundantComm(), 0);
+  }
+}
 
-      if (viewingRank == sendViewingRank && viewingRank == recvViewingRank) {
-        // Copy data locally
-        copy::util::InterleaveMatrix(
-          messageHeight, messageWidth,
-          A.LockedBuffer(iLocA,jLocA), numColSends, numRowSends*A.LDim(),
-          B.Buffer(iLocB,jLocB), numColRecvs, numRowRecvs*B.LDim(),
-          syncInfo);
-      }
-      else if (viewingRank == sendViewingRank) {
-        // Send data to other rank
-        copy::util::InterleaveMatrix(
-          messageHeight, messageWidth,
-          A.LockedBuffer(iLocA,jLocA), numColSends, numRowSends*A.LDim(),
-          messageBuf.data(), 1, messageHeight,
-          syncInfo);
-        mpi::Send(
-          messageBuf.data(), messageHeight*messageWidth,
-          recvViewingRank, viewingCommB, syncInfo);
-      }
-      else if (viewingRank == recvViewingRank) {
-        // Receive data from other rank
-        mpi::Recv(
-          messageBuf.data(), messageHeight*messageWidth,
-          sendViewingRank, viewingCommB, syncInfo);
-        copy::util::InterleaveMatrix(
-          messageHeight, messageWidth,
-          messageBuf.data(), 1, messageHeight,
-          B.Buffer(iLocB,jLocB), numColRecvs, numRowRecvs*B.LDim(),
-          syncInfo);
-      }
+template<typename T, Device D>
+void TranslateBetweenGrids(
+  DistMatrix<T,CIRC,CIRC,ELEMENT,D> const& A,
+  DistMatrix<T,CIRC,CIRC,ELEMENT,D>& B)
+{
+
+  // Matrix dimensions
+  const Int m = A.Height();
+  const Int n = A.Width();
+  B.Resize(m, n);
+  if (m <= 0 || n <= 0) {
+    return;
+  }
 
+  const bool amRootA = A.IsLocalCol(0);
+  const bool amRootB = B.IsLocalCol(0);
+  mpi::Comm const& viewingCommB = B.Grid().ViewingComm();
+  if (amRootA && amRootB) {
+    El::Copy(A.LockedMatrix(), B.Matrix());
+  }
+  else if (amRootA) {
+    const Int recvViewingRank = B.Grid().VCToViewing(B.Root());
+    El::Send(A.LockedMatrix(), viewingCommB, recvViewingRank);
+  }
+  else if (amRootB) {
+    mpi::Group owningGroupA = A.Grid().OwningGroup();
+    const Int sendViewingRank = mpi::Translate(
+      owningGroupA,
+      A.Root(),
+      viewingCommB);
+    if (sendViewingRank < 0 || sendViewingRank >= viewingCommB.Size()) {
+      LogicError(
+        "TranslateBetweenGrids: Owning group for matrix A "
+        "is not a subset of viewing communicator for matrix B");
     }
+    El::Recv(B.Matrix(), viewingCommB, sendViewingRank);
   }
 
 }
@@ -3945,11 +3928,16 @@ void TranslateBetweenGrids(
   // Translate the ranks from A's VC communicator to B's viewing so
   // that we can match send/recv communicators. Since A's VC
   // communicator is not necessarily defined on every process, we
-  // instead work with A's owning group.
+  // instead work with A's owning group, which is ordered like A's VR
+  // communicator when A's grid is row-major.
   mpi::Group owningGroupA = A.Grid().OwningGroup();
   const int sizeA = A.Grid().Size();
   vector<int> viewingRanksA(sizeA), owningRanksA(sizeA);
-  std::iota(owningRanksA.begin(), owningRanksA.end(), 0);
+  for (int vcRank=0; vcRank<sizeA; ++vcRank) {
+    owningRanksA[vcRank] =
+      (A.Grid().Order() == COLUMN_MAJOR ?
+       vcRank : A.Grid().VCToVR(vcRank));
+  }
   mpi::Translate(
     owningGroupA, sizeA, owningRanksA.data(),
     viewingCommB, viewingRanksA.data());
@@ -40,9 +40,6 @@ void TranslateBetweenGrids
 ( const DistMatrix<T,CIRC,CIRC,ELEMENT,D>& A, DistMatrix<T,CIRC,CIRC,ELEMENT,D>& B );
 template<typename T,Device D>
 void TranslateBetweenGrids
-( const DistMatrix<T,MC,MR,ELEMENT,D>& A, DistMatrix<T,MC,MR,ELEMENT,D>& B );
-template<typename T,Device D>
-void TranslateBetweenGrids
 ( const DistMatrix<T,STAR,VC,ELEMENT,D>& A, DistMatrix<T,STAR,VC,ELEMENT,D>& B );
 
 template<typename T, Device D1, Device D2>
@@ -109,6 +109,222 @@ void ColStridedUnpack(
 
 // End of DisableIf overload set
 
+// CPU kernels
+// ===========
+// The redistributions spend most of their local time in the pack and unpack
+// routines below, which are built from these kernels. Copies of fewer than
+// PackParallelCutoff entries are left to a single thread, as waking a team
+// of threads would cost more than the copy itself.
+namespace details
+{
+
+constexpr Int PackParallelCutoff = 16384;
+
+// A square tile of this many rows and columns of both the source and the
+// destination fits comfortably within the L1 cache
+constexpr Int PackTileSize = 32;
+
+// Run func(0), ..., func(numIterations-1), in parallel if the loop touches
+// at least PackParallelCutoff entries in total
+template <typename Function>
+void PackFor(Int numIterations, Int numEntries, Function const& func)
+{
+    if (numEntries < PackParallelCutoff)
+    {
+        for (Int iter=0; iter<numIterations; ++iter)
+            func(iter);
+    }
+    else
+    {
+        EL_PARALLEL_FOR
+        for (Int iter=0; iter<numIterations; ++iter)
+            func(iter);
+    }
+}
+
+// B := A for column-major matrices
+template <typename T>
+void CopyColumns(
+    Int height, Int width,
+    T const* A, Int ALDim,
+    T* B, Int BLDim)
+{
+    if (height <= 0 || width <= 0)
+        return;
+    if (ALDim == height && BLDim == height)
+    {
+        // Split the single contiguous range into chunks
+        const Int numEntries = height*width;
+        const Int numChunks =
+            (numEntries+PackParallelCutoff-1) / PackParallelCutoff;
+        PackFor(numChunks, numEntries, [&](Int chunk)
+        {
+            const Int offset = chunk*PackParallelCutoff;
+            MemCopy(
+                B+offset, A+offset,
+                Min(PackParallelCutoff, numEntries-offset));
+        });
+    }
+    else
+    {
+        PackFor(width, height*width, [&](Int j)
+        {
+            MemCopy(B+j*BLDim, A+j*ALDim, height);
+        });
+    }
+}
+
+// B := A where the entries of each matrix have arbitrary row and column
+// strides. If the two matrices are traversed fastest in different
+// directions (i.e., the copy transposes the storage order), the copy is
+// performed one cache-sized tile at a time.
+template <typename T>
+void StridedCopy(
+    Int height, Int width,
+    T const* A, Int colStrideA, Int rowStrideA,
+    T* B, Int colStrideB, Int rowStrideB)
+{
+    if (height <= 0 || width <= 0)
+        return;
+    const bool colMajorA = (colStrideA <= rowStrideA);
+    const bool colMajorB = (colStrideB <= rowStrideB);
+    Int tileHeight, tileWidth;
+    if (colMajorA && colMajorB)
+    {
+        tileHeight = height;
+        tileWidth = 1;
+    }
+    else if (!colMajorA && !colMajorB)
+    {
+        tileHeight = 1;
+        tileWidth = width;
+    }
+    else
+    {
+        tileHeight = PackTileSize;
+        tileWidth = PackTileSize;
+    }
+    const Int numRowTiles = (height+tileHeight-1) / tileHeight;
+    const Int numColTiles = (width+tileWidth-1) / tileWidth;
+    PackFor(numRowTiles*numColTiles, height*width, [&](Int tile)
+    {
+        const Int iBeg = (tile % numRowTiles)*tileHeight;
+        const Int jBeg = (tile / numRowTiles)*tileWidth;
+        const Int iEnd = Min(iBeg+tileHeight, height);
+        const Int jEnd = Min(jBeg+tileWidth, width);
+        // Write the destination in its storage order
+        if (colMajorB)
+        {
+            for (Int j=jBeg; j<jEnd; ++j)
+            {
+                EL_SIMD
+                for (Int i=iBeg; i<iEnd; ++i)
+                    B[i*colStrideB+j*rowStrideB] =
+                        A[i*colStrideA+j*rowStrideA];
+            }
+        }
+        else
+        {
+            for (Int i=iBeg; i<iEnd; ++i)
+            {
+                EL_SIMD
+                for (Int j=jBeg; j<jEnd; ++j)
+                    B[i*colStrideB+j*rowStrideB] =
+                        A[i*colStrideA+j*rowStrideA];
+            }
+        }
+    });
+}
+
+// The generic column-strided pack and unpack interleave each portion in
+// turn. On the CPU, each column is instead visited once (while it is in
+// cache) and scattered amongst (or gathered from) all of the portions.
+template <typename T, Device D>
+void ColStridedPack(
+    Int height, Int width,
+    Int colAlign, Int colStride,
+    const T* A,         Int ALDim,
+    T* BPortions, Int portionSize,
+    SyncInfo<D> syncInfo)
+{
+    for (Int k=0; k<colStride; ++k)
+    {
+        const Int colShift = Shift_(k, colAlign, colStride);
+        const Int localHeight = Length_(height, colShift, colStride);
+        InterleaveMatrix(
+            localHeight, width,
+            &A[colShift],              colStride, ALDim,
+            &BPortions[k*portionSize], 1,         localHeight,
+            syncInfo);
+    }
+}
+
+template <typename T>
+void ColStridedPack(
+    Int height, Int width,
+    Int colAlign, Int colStride,
+    const T* A,         Int ALDim,
+    T* BPortions, Int portionSize,
+    SyncInfo<Device::CPU>)
+{
+    PackFor(width, height*width, [&](Int j)
+    {
+        for (Int k=0; k<colStride; ++k)
+        {
+            const Int colShift = Shift_(k, colAlign, colStride);
+            const Int localHeight = Length_(height, colShift, colStride);
+            StridedMemCopy(
+                &BPortions[k*portionSize+j*localHeight], 1,
+                &A[colShift+j*ALDim],                   colStride,
+                localHeight);
+        }
+    });
+}
+
+template <typename T, Device D>
+void ColStridedUnpack(
+    Int height, Int width,
+    Int colAlign, Int colStride,
+    const T* APortions, Int portionSize,
+    T* B,         Int BLDim,
+    SyncInfo<D> syncInfo)
+{
+    for (Int k=0; k<colStride; ++k)
+    {
+        const Int colShift = Shift_(k, colAlign, colStride);
+        const Int localHeight = Length_(height, colShift, colStride);
+        InterleaveMatrix(
+            localHeight, width,
+            &APortions[k*portionSize], 1,         localHeight,
+            &B[colShift],              colStride, BLDim,
+            syncInfo);
+    }
+}
+
+template <typename T>
+void ColStridedUnpack(
+    Int height, Int width,
+    Int colAlign, Int colStride,
+    const T* APortions, Int portionSize,
+    T* B,         Int BLDim,
+    SyncInfo<Device::CPU>)
+{
+    PackFor(width, height*width, [&](Int j)
+    {
+        for (Int k=0; k<colStride; ++k)
+        {
+            const Int colShift = Shift_(k, colAlign, colStride);
+            const Int localHeight = Length_(height, colShift, colStride);
+            StridedMemCopy(
+                &B[colShift+j*BLDim],                    colStride,
+                &APortions[k*portionSize+j*localHeight], 1,
+                localHeight);
+        }
+    });
+}
+
+} // namespace details
+
 template <typename T,
           typename=EnableIf<IsStorageType<T,Device::CPU>>>
 void DeviceStridedMemCopy(
@@ -127,7 +343,7 @@ void InterleaveMatrix(
 {
     if (colStrideA == 1 && colStrideB == 1)
     {
-        lapack::Copy('F', height, width, A, rowStrideA, B, rowStrideB);
+        details::CopyColumns(height, width, A, rowStrideA, B, rowStrideB);
     }
     else
     {
@@ -137,10 +353,10 @@ void InterleaveMatrix(
             A, rowStrideA, colStrideA,
             B, rowStrideB, colStrideB);
 #else
-        for(Int j=0; j<width; ++j)
-            StridedMemCopy(
-                &B[j*rowStrideB], colStrideB,
-                &A[j*rowStrideA], colStrideA, height);
+        details::StridedCopy(
+            height, width,
+            A, colStrideA, rowStrideA,
+            B, colStrideB, rowStrideB);
 #endif
     }
 }
@@ -157,8 +373,8 @@ void RowStridedPack(
     {
         const Int rowShift = Shift_(k, rowAlign, rowStride);
         const Int localWidth = Length_(width, rowShift, rowStride);
-        lapack::Copy(
-            'F', height, localWidth,
+        details::CopyColumns(
+            height, localWidth,
             &A[rowShift*ALDim],        rowStride*ALDim,
             &BPortions[k*portionSize], height);
     }
@@ -176,8 +392,8 @@ void RowStridedUnpack(
     {
         const Int rowShift = Shift_(k, rowAlign, rowStride);
         const Int localWidth = Length_(width, rowShift, rowStride);
-        lapack::Copy(
-            'F', height, localWidth,
+        details::CopyColumns(
+            height, localWidth,
             &APortions[k*portionSize], height,
             &B[rowShift*BLDim],        rowStride*BLDim);
     }
@@ -199,8 +415,8 @@ void PartialRowStridedPack(
             Shift_(rowRankPart+k*rowStridePart, rowAlign, rowStride);
         const Int rowOffset = (rowShift-rowShiftA) / rowStridePart;
         const Int localWidth = Length_(width, rowShift, rowStride);
-        lapack::Copy(
-            'F', height, localWidth,
+        details::CopyColumns(
+            height, localWidth,
             &A[rowOffset*ALDim],       rowStrideUnion*ALDim,
             &BPortions[k*portionSize], height);
     }
@@ -222,8 +438,8 @@ void PartialRowStridedUnpack(
             Shift_(rowRankPart+k*rowStridePart, rowAlign, rowStride);
         const Int rowOffset = (rowShift-rowShiftB) / rowStridePart;
         const Int localWidth = Length_(width, rowShift, rowStride);
-        lapack::Copy(
-            'F', height, localWidth,
+        details::CopyColumns(
+            height, localWidth,
             &APortions[k*portionSize], height,
             &B[rowOffset*BLDim],       rowStrideUnion*BLDim);
     }
@@ -364,16 +580,9 @@ void ColStridedPack(
     T* BPortions, Int portionSize,
     SyncInfo<D> syncInfo)
 {
-    for (Int k=0; k<colStride; ++k)
-    {
-        const Int colShift = Shift_(k, colAlign, colStride);
-        const Int localHeight = Length_(height, colShift, colStride);
-        InterleaveMatrix(
-            localHeight, width,
-            &A[colShift],              colStride, ALDim,
-            &BPortions[k*portionSize], 1,         localHeight,
-            syncInfo);
-    }
+    details::ColStridedPack(
+        height, width, colAlign, colStride,
+        A, ALDim, BPortions, portionSize, syncInfo);
 }
 
 // TODO(poulson): Use this routine
@@ -404,16 +613,9 @@ void ColStridedUnpack(
     T* B,         Int BLDim,
     SyncInfo<D> syncInfo)
 {
-    for (Int k=0; k<colStride; ++k)
-    {
-        const Int colShift = Shift_(k, colAlign, colStride);
-        const Int localHeight = Length_(height, colShift, colStride);
-        InterleaveMatrix(
-            localHeight, width,
-            &APortions[k*portionSize], 1,         localHeight,
-            &B[colShift],              colStride, BLDim,
-            syncInfo);
-    }
+    details::ColStridedUnpack(
+        height, width, colAlign, colStride,
+        APortions, portionSize, B, BLDim, syncInfo);
 }
 
 // FIXME: GPU IMPL
@@ -445,10 +647,10 @@ void BlockedColStridedUnpack(
                  firstBlockHeight :
                  Min(blockHeight,height-rowIndex));
 
-            lapack::Copy
-                ('F', thisBlockHeight, width,
-                 &APortion[packedRowIndex], localHeight,
-                 &B[rowIndex],              BLDim);
+            details::CopyColumns(
+                thisBlockHeight, width,
+                &APortion[packedRowIndex], localHeight,
+                &B[rowIndex],              BLDim);
 
             blockRow += colStride;
             rowIndex += thisBlockHeight + (colStride-1)*blockHeight;
@@ -578,10 +780,10 @@ void BlockedRowStridedUnpack(
                  firstBlockWidth :
                  Min(blockWidth,width-colIndex));
 
-            lapack::Copy
-                ('F', height, thisBlockWidth,
-                 &APortion[packedColIndex*height], height,
-                 &B[colIndex*BLDim],               BLDim);
+            details::CopyColumns(
+                height, thisBlockWidth,
+                &APortion[packedColIndex*height], height,
+                &B[colIndex*BLDim],               BLDim);
 
             blockCol += rowStride;
             colIndex += thisBlockWidth + (rowStride-1)*blockWidth;
@@ -615,10 +817,10 @@ void BlockedRowFilter(
              firstBlockWidth :
              Min(blockWidth,width-colIndex));
 
-        lapack::Copy
-            ('F', height, thisBlockWidth,
-             &A[colIndex      *ALDim], ALDim,
-             &B[packedColIndex*BLDim], BLDim);
+        details::CopyColumns(
+            height, thisBlockWidth,
+            &A[colIndex      *ALDim], ALDim,
+            &B[packedColIndex*BLDim], BLDim);
 
         blockCol += rowStride;
         colIndex += thisBlockWidth + (rowStride-1)*blockWidth;
@@ -651,10 +853,10 @@ void BlockedColFilter(
              firstBlockHeight :
              Min(blockHeight,height-rowIndex));
 
-        lapack::Copy
-            ('F', thisBlockHeight, width,
-             &A[rowIndex],       ALDim,
-             &B[packedRowIndex], BLDim);
+        details::CopyColumns(
+            thisBlockHeight, width,
+            &A[rowIndex],       ALDim,
+            &B[packedRowIndex], BLDim);
 
         blockRow += colStride;
         rowIndex += thisBlockHeight + (colStride-1)*blockHeight;
@@ -0,0 +1,354 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_ENTRYWISEEXPRESSION_HPP
+#define EL_BLAS_ENTRYWISEEXPRESSION_HPP
+
+#include <type_traits>
+#include <utility>
+
+// Lazily-evaluated entrywise expressions. A chain such as
+//
+//   using expr::Ref;
+//   Evaluate( Map( alpha*Ref(X) + Hadamard(Ref(Y),Ref(Z)), func ), W );
+//
+// is recorded as a tree of lightweight nodes and then computed in a single
+// pass over the local data, rather than with one pass for each of the
+// Scale, Axpy, Hadamard and EntrywiseMap calls that it replaces. Since every
+// entry of the result only depends upon the same entry of each operand, the
+// result may overwrite any of the operands.
+
+namespace El {
+namespace expr {
+
+/** @brief The base of every entrywise expression.
+ *
+ *  Derived classes provide the local dimensions, the value of each local
+ *  entry, and a traversal of the matrices at the leaves of the tree.
+ */
+template<typename Derived>
+struct Expression
+{
+    const Derived& Self() const { return static_cast<const Derived&>(*this); }
+};
+
+/** @brief A reference to the local data of a (CPU) matrix. */
+template<typename T>
+class MatrixRef : public Expression<MatrixRef<T>>
+{
+public:
+    typedef T value_type;
+
+    explicit MatrixRef(const Matrix<T,Device::CPU>& A)
+    : buffer_(A.LockedBuffer()), height_(A.Height()), width_(A.Width()),
+      ldim_(A.LDim())
+    { }
+
+    explicit MatrixRef(const AbstractDistMatrix<T>& A)
+    : MatrixRef(LocalMatrix(A))
+    { dist_ = &A; }
+
+    Int Height() const EL_NO_EXCEPT { return height_; }
+    Int Width() const EL_NO_EXCEPT { return width_; }
+    T operator()(Int i, Int j) const { return buffer_[i+j*ldim_]; }
+
+    template<typename Visitor>
+    void VisitLeaves(Visitor& visit) const { visit(height_, width_, dist_); }
+
+private:
+    static const Matrix<T,Device::CPU>&
+    LocalMatrix(const AbstractDistMatrix<T>& A)
+    {
+        if (A.GetLocalDevice() != Device::CPU)
+            LogicError("Entrywise expressions require CPU matrices");
+        return static_cast<const Matrix<T,Device::CPU>&>(A.LockedMatrix());
+    }
+
+    const T* buffer_;
+    Int height_, width_, ldim_;
+    const BaseDistMatrix* dist_=nullptr;
+};
+
+template<typename Arg,typename FunctorT>
+class UnaryNode : public Expression<UnaryNode<Arg,FunctorT>>
+{
+public:
+    typedef typename std::decay<
+      decltype(std::declval<FunctorT>()(
+        std::declval<typename Arg::value_type>()))>::type value_type;
+
+    UnaryNode(const Arg& arg, FunctorT func)
+    : arg_(arg), func_(std::move(func))
+    { }
+
+    Int Height() const EL_NO_EXCEPT { return arg_.Height(); }
+    Int Width() const EL_NO_EXCEPT { return arg_.Width(); }
+    value_type operator()(Int i, Int j) const { return func_(arg_(i,j)); }
+
+    template<typename Visitor>
+    void VisitLeaves(Visitor& visit) const { arg_.VisitLeaves(visit); }
+
+private:
+    Arg arg_;
+    FunctorT func_;
+};
+
+template<typename Left,typename Right,typename FunctorT>
+class BinaryNode : public Expression<BinaryNode<Left,Right,FunctorT>>
+{
+public:
+    typedef typename std::decay<
+      decltype(std::declval<FunctorT>()(
+        std::declval<typename Left::value_type>(),
+        std::declval<typename Right::value_type>()))>::type value_type;
+
+    BinaryNode(const Left& left, const Right& right, FunctorT func)
+    : left_(left), right_(right), func_(std::move(func))
+    { }
+
+    Int Height() const EL_NO_EXCEPT { return left_.Height(); }
+    Int Width() const EL_NO_EXCEPT { return left_.Width(); }
+    value_type operator()(Int i, Int j) const
+    { return func_(left_(i,j), right_(i,j)); }
+
+    template<typename Visitor>
+    void VisitLeaves(Visitor& visit) const
+    {
+        left_.VisitLeaves(visit);
+        right_.VisitLeaves(visit);
+    }
+
+private:
+    Left left_;
+    Right right_;
+    FunctorT func_;
+};
+
+// Building expressions
+// ====================
+
+/** @brief A leaf referring to a matrix, which must outlive the expression. */
+template<typename T>
+MatrixRef<T> Ref(const Matrix<T,Device::CPU>& A)
+{ return MatrixRef<T>(A); }
+
+/** @brief A leaf referring to the local data of a distributed matrix, which
+ *         must outlive the expression.
+ */
+template<typename T>
+MatrixRef<T> Ref(const AbstractDistMatrix<T>& A)
+{ return MatrixRef<T>(A); }
+
+// The functors behind the arithmetic operators
+// ============================================
+struct Plus
+{
+    template<typename S,typename T>
+    auto operator()(const S& alpha, const T& beta) const
+    -> decltype(alpha+beta) { return alpha + beta; }
+};
+
+struct Minus
+{
+    template<typename S,typename T>
+    auto operator()(const S& alpha, const T& beta) const
+    -> decltype(alpha-beta) { return alpha - beta; }
+};
+
+struct Times
+{
+    template<typename S,typename T>
+    auto operator()(const S& alpha, const T& beta) const
+    -> decltype(alpha*beta) { return alpha * beta; }
+};
+
+struct Negate
+{
+    template<typename T>
+    T operator()(const T& alpha) const { return -alpha; }
+};
+
+template<typename S>
+struct ScaleBy
+{
+    S scale;
+    template<typename T>
+    auto operator()(const T& alpha) const
+    -> decltype(scale*alpha) { return scale*alpha; }
+};
+
+/** @brief The entrywise application of func to an expression. */
+template<typename Arg,typename FunctorT>
+UnaryNode<Arg,FunctorT>
+Map(const Expression<Arg>& arg, FunctorT func)
+{ return UnaryNode<Arg,FunctorT>(arg.Self(), std::move(func)); }
+
+/** @brief The entrywise application of the binary func to two expressions
+ *         of the same dimensions.
+ */
+template<typename Left,typename Right,typename FunctorT>
+BinaryNode<Left,Right,FunctorT>
+Map(const Expression<Left>& left, const Expression<Right>& right,
+    FunctorT func)
+{
+    return BinaryNode<Left,Right,FunctorT>
+      (left.Self(), right.Self(), std::move(func));
+}
+
+/** @brief The entrywise product of two expressions. */
+template<typename Left,typename Right>
+BinaryNode<Left,Right,Times>
+Hadamard(const Expression<Left>& left, const Expression<Right>& right)
+{ return Map(left, right, Times()); }
+
+template<typename Left,typename Right>
+BinaryNode<Left,Right,Plus>
+operator+(const Expression<Left>& left, const Expression<Right>& right)
+{ return Map(left, right, Plus()); }
+
+template<typename Left,typename Right>
+BinaryNode<Left,Right,Minus>
+operator-(const Expression<Left>& left, const Expression<Right>& right)
+{ return Map(left, right, Minus()); }
+
+template<typename Arg>
+UnaryNode<Arg,Negate> operator-(const Expression<Arg>& arg)
+{ return Map(arg, Negate()); }
+
+template<typename Arg>
+UnaryNode<Arg,ScaleBy<typename Arg::value_type>>
+operator*(typename Arg::value_type alpha, const Expression<Arg>& arg)
+{ return Map(arg, ScaleBy<typename Arg::value_type>{alpha}); }
+
+template<typename Arg>
+UnaryNode<Arg,ScaleBy<typename Arg::value_type>>
+operator*(const Expression<Arg>& arg, typename Arg::value_type alpha)
+{ return Map(arg, ScaleBy<typename Arg::value_type>{alpha}); }
+
+namespace details {
+
+// Ensures that every leaf has the same local dimensions and that the leaves
+// are either all sequential or all distributed in the same manner
+class Conformity
+{
+public:
+    void operator()(Int height, Int width, const BaseDistMatrix* dist)
+    {
+        if (numLeaves_ == 0)
+        {
+            height_ = height;
+            width_ = width;
+            dist_ = dist;
+        }
+        else if ((dist_ == nullptr) != (dist == nullptr))
+            LogicError
+            ("Entrywise expressions cannot mix Matrix and DistMatrix");
+        else if (dist != nullptr && !SameLayout(*dist_, *dist))
+            LogicError
+            ("Entrywise expressions require conformally distributed "
+             "operands");
+        else if (height != height_ || width != width_)
+            LogicError
+            ("Nonconformal entrywise expression: a ",height_," x ",width_,
+             " operand was combined with a ",height," x ",width," operand");
+        ++numLeaves_;
+    }
+
+    Int Height() const EL_NO_EXCEPT { return height_; }
+    Int Width() const EL_NO_EXCEPT { return width_; }
+    const BaseDistMatrix* Dist() const EL_NO_EXCEPT { return dist_; }
+
+    // Whether A and B have the same dimensions and assign each entry to the
+    // same process (the datatypes of the entries may differ)
+    static bool SameLayout(const BaseDistMatrix& A, const BaseDistMatrix& B)
+    {
+        const El::DistData ADist = A.DistData(), BDist = B.DistData();
+        return A.Height() == B.Height() && A.Width() == B.Width() &&
+          ADist.colDist == BDist.colDist && ADist.rowDist == BDist.rowDist &&
+          ADist.blockHeight == BDist.blockHeight &&
+          ADist.blockWidth == BDist.blockWidth &&
+          ADist.colAlign == BDist.colAlign &&
+          ADist.rowAlign == BDist.rowAlign &&
+          ADist.colCut == BDist.colCut && ADist.rowCut == BDist.rowCut &&
+          ADist.root == BDist.root && *ADist.grid == *BDist.grid;
+    }
+
+private:
+    Int numLeaves_=0;
+    Int height_=0, width_=0;
+    const BaseDistMatrix* dist_=nullptr;
+};
+
+template<typename T,typename ExprT>
+void EvaluateLocal(const ExprT& expr, Matrix<T,Device::CPU>& B)
+{
+    const Int height = B.Height();
+    const Int width = B.Width();
+    T* BBuf = B.Buffer();
+    const Int BLDim = B.LDim();
+    EL_PARALLEL_FOR
+    for (Int j=0; j<width; ++j)
+    {
+        EL_SIMD
+        for (Int i=0; i<height; ++i)
+            BBuf[i+j*BLDim] = T(expr(i,j));
+    }
+}
+
+} // namespace details
+} // namespace expr
+
+/** @brief Compute an entrywise expression of sequential matrices in a single
+ *         pass, resizing B to the dimensions of the expression.
+ */
+template<typename T,typename ExprT>
+void Evaluate(const expr::Expression<ExprT>& expr, Matrix<T,Device::CPU>& B)
+{
+    EL_DEBUG_CSE
+    expr::details::Conformity conformity;
+    expr.Self().VisitLeaves(conformity);
+    if (conformity.Dist() != nullptr)
+        LogicError("Evaluate the expression into a DistMatrix instead");
+    B.Resize(conformity.Height(), conformity.Width());
+    expr::details::EvaluateLocal(expr.Self(), B);
+}
+
+/** @brief Compute an entrywise expression of conformally distributed
+ *         matrices in a single pass over the local data.
+ *
+ *  B must have the same distribution as the operands and is aligned with
+ *  them and resized as necessary.
+ */
+template<typename T,typename ExprT>
+void Evaluate(const expr::Expression<ExprT>& expr, AbstractDistMatrix<T>& B)
+{
+    EL_DEBUG_CSE
+    expr::details::Conformity conformity;
+    expr.Self().VisitLeaves(conformity);
+    const BaseDistMatrix* dist = conformity.Dist();
+    if (dist == nullptr)
+        LogicError("Evaluate the expression into a Matrix instead");
+    const El::DistData ADist = dist->DistData();
+    if (B.ColDist() != ADist.colDist || B.RowDist() != ADist.rowDist ||
+        B.Grid() != *ADist.grid)
+        LogicError
+        ("The result of an entrywise expression must be distributed like "
+         "its operands");
+    if (B.GetLocalDevice() != Device::CPU)
+        LogicError("Entrywise expressions require CPU matrices");
+    B.AlignWith(ADist);
+    B.Resize(dist->Height(), dist->Width());
+    if (!expr::details::Conformity::SameLayout(*dist, B))
+        LogicError("Could not align the result of the entrywise expression");
+    expr::details::EvaluateLocal
+    (expr.Self(), static_cast<Matrix<T,Device::CPU>&>(B.Matrix()));
+}
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_ENTRYWISEEXPRESSION_HPP
@@ -21,14 +21,15 @@
 
 namespace El {
 
-template<typename T>
-void EntrywiseMap(AbstractMatrix<T>& A, function<T(const T&)> func)
+// The functor overloads are specialized on the type of the functor so that
+// it can be inlined into, and vectorized along with, the loop over the
+// entries. The std::function overloads forward to them.
+
+template<typename T,typename FunctorT>
+void EntrywiseMap(Matrix<T,Device::CPU>& A, FunctorT func)
 {
     EL_DEBUG_CSE
 
-    if (A.GetDevice() != Device::CPU)
-        LogicError("EntrywiseMap not allowed on non-CPU matrices.");
-
     const Int m = A.Height();
     const Int n = A.Width();
     T* ABuf = A.Buffer();
@@ -58,19 +59,24 @@ void EntrywiseMap(AbstractMatrix<T>& A, function<T(const T&)> func)
     }
 }
 
-template<typename T>
-void EntrywiseMap(AbstractDistMatrix<T>& A, function<T(const T&)> func)
-{ EntrywiseMap(A.Matrix(), func); }
+template<typename T,typename FunctorT>
+void EntrywiseMap(AbstractMatrix<T>& A, FunctorT func)
+{
+    if (A.GetDevice() != Device::CPU)
+        LogicError("EntrywiseMap not allowed on non-CPU matrices.");
+    EntrywiseMap(static_cast<Matrix<T,Device::CPU>&>(A), std::move(func));
+}
 
-template<typename S,typename T>
+template<typename T,typename FunctorT>
+void EntrywiseMap(AbstractDistMatrix<T>& A, FunctorT func)
+{ EntrywiseMap(A.Matrix(), std::move(func)); }
+
+template<typename S,typename T,typename FunctorT>
 void EntrywiseMap
-(const AbstractMatrix<S>& A, AbstractMatrix<T>& B, function<T(const S&)> func)
+(Matrix<S,Device::CPU> const& A, Matrix<T,Device::CPU>& B, FunctorT func)
 {
     EL_DEBUG_CSE
 
-    if ((A.GetDevice() != Device::CPU) || (B.GetDevice() != Device::CPU))
-        LogicError("EntrywiseMap not allowed on non-CPU matrices.");
-
     const Int m = A.Height();
     const Int n = A.Width();
     B.Resize(m, n);
@@ -89,6 +95,33 @@ void EntrywiseMap
     }
 }
 
+template<typename T>
+void EntrywiseMap(AbstractMatrix<T>& A, function<T(const T&)> func)
+{
+    EL_DEBUG_CSE
+
+    if (A.GetDevice() != Device::CPU)
+        LogicError("EntrywiseMap not allowed on non-CPU matrices.");
+    EntrywiseMap(static_cast<Matrix<T,Device::CPU>&>(A), std::move(func));
+}
+
+template<typename T>
+void EntrywiseMap(AbstractDistMatrix<T>& A, function<T(const T&)> func)
+{ EntrywiseMap(A.Matrix(), std::move(func)); }
+
+template<typename S,typename T>
+void EntrywiseMap
+(const AbstractMatrix<S>& A, AbstractMatrix<T>& B, function<T(const S&)> func)
+{
+    EL_DEBUG_CSE
+
+    if ((A.GetDevice() != Device::CPU) || (B.GetDevice() != Device::CPU))
+        LogicError("EntrywiseMap not allowed on non-CPU matrices.");
+    EntrywiseMap
+    (static_cast<Matrix<S,Device::CPU> const&>(A),
+     static_cast<Matrix<T,Device::CPU>&>(B), std::move(func));
+}
+
 template <Dist U, Dist V, DistWrap W, Device D, typename S, typename T,
           typename=EnableIf<IsDeviceValidType<S,D>>>
 void EntrywiseMap_payload(
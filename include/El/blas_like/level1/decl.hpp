@@ -76,6 +76,53 @@ void AllReduce( Matrix<T,D>& A, mpi::Comm const& comm, mpi::Op op=mpi::SUM );
 template<typename T>
 void AllReduce( AbstractDistMatrix<T>& A, mpi::Comm const& comm, mpi::Op op=mpi::SUM );
 
+/** @class CoalescedAllReduce
+ *  @brief Reduces a list of matrices in place with a few large messages
+ *         rather than one message per matrix.
+ *
+ *  The local entries are packed, in order, into a stream which is divided
+ *  into buckets of at most BucketBytes() bytes, and the nonblocking
+ *  reduction of each bucket begins as soon as it has been filled. Each
+ *  matrix is unpacked once every bucket that it spans has been reduced.
+ *  The packing buffer is kept between calls to Execute().
+ *
+ *  Every process in the communicator must pass matrices of the same sizes
+ *  in the same order. Matrices which are not stored on the CPU are reduced
+ *  one at a time.
+ */
+template<typename T>
+class CoalescedAllReduce
+{
+public:
+    explicit CoalescedAllReduce( size_t bucketBytes=size_t(1)<<22 );
+
+    size_t BucketBytes() const EL_NO_EXCEPT { return bucketBytes_; }
+    void SetBucketBytes( size_t bucketBytes );
+
+    void Execute
+    ( const vector<AbstractMatrix<T>*>& matrices,
+      mpi::Comm const& comm, mpi::Op op=mpi::SUM );
+    // Reduce the local matrices of the participating processes
+    void Execute
+    ( const vector<AbstractDistMatrix<T>*>& matrices,
+      mpi::Comm const& comm, mpi::Op op=mpi::SUM );
+
+private:
+    size_t bucketBytes_;
+    simple_buffer<T,Device::CPU> buffer_;
+    vector<mpi::Request<T>> requests_;
+};
+
+// Convenience wrappers which do not keep the packing buffer
+template<typename T>
+void AllReduce
+( const vector<AbstractMatrix<T>*>& matrices,
+  mpi::Comm const& comm, mpi::Op op=mpi::SUM );
+template<typename T>
+void AllReduce
+( const vector<AbstractDistMatrix<T>*>& matrices,
+  mpi::Comm const& comm, mpi::Op op=mpi::SUM );
+
 // Axpy
 // ====
 template<typename Ring1,typename Ring2>
@@ -368,6 +415,12 @@ void Contract( const BlockMatrix<T>& A, BlockMatrix<T>& B );
 // ====
 class BaseDistMatrix;
 
+// The maximum number of entries that copy::GeneralPurpose ships from each
+// process in a single round of communication. Larger redistributions are
+// split into several rounds to bound the size of the temporary buffers.
+void SetRedistChunkSize( Int numEntries );
+Int RedistChunkSize();
+
 namespace copy {
 namespace util {
 
@@ -761,6 +814,16 @@ void EntrywiseMap
 ( const AbstractDistMatrix<S>& A, AbstractDistMatrix<T>& B,
   function<T(const S&)> func );
 
+// Specialized on the type of the functor, which allows it to be inlined
+template<typename T,typename FunctorT>
+void EntrywiseMap( Matrix<T>& A, FunctorT func );
+template<typename T,typename FunctorT>
+void EntrywiseMap( AbstractMatrix<T>& A, FunctorT func );
+template<typename T,typename FunctorT>
+void EntrywiseMap( AbstractDistMatrix<T>& A, FunctorT func );
+template<typename S,typename T,typename FunctorT>
+void EntrywiseMap( const Matrix<S>& A, Matrix<T>& B, FunctorT func );
+
 // Fill
 // ====
 template<typename T>
@@ -19,12 +19,14 @@
 #include <El/blas_like/level1/ConjugateDiagonal.hpp>
 #include <El/blas_like/level1/ConjugateSubmatrix.hpp>
 #include <El/blas_like/level1/Contract.hpp>
+#include <El/blas_like/level1/Copy/RedistributionPlan.hpp>
 #include <El/blas_like/level1/DiagonalScale.hpp>
 #include <El/blas_like/level1/DiagonalScaleTrapezoid.hpp>
 #include <El/blas_like/level1/DiagonalSolve.hpp>
 #include <El/blas_like/level1/Dot.hpp>
 #include <El/blas_like/level1/EntrywiseFill.hpp>
 #include <El/blas_like/level1/EntrywiseMap.hpp>
+#include <El/blas_like/level1/EntrywiseExpression.hpp>
 #include <El/blas_like/level1/Fill.hpp>
 #include <El/blas_like/level1/FillDiagonal.hpp>
 #include <El/blas_like/level1/GetDiagonal.hpp>
@@ -29,11 +29,19 @@ enum GemmAlgorithm {
   GEMM_SUMMA_C_MS,
   GEMM_SUMMA_C,
   GEMM_SUMMA_DOT,
-  GEMM_CANNON
+  GEMM_CANNON,
+  GEMM_SUMMA_C_PIPELINED,
+  GEMM_SUMMA_3D
 };
 }
 using namespace GemmAlgorithmNS;
 
+// Number of replication layers used by GEMM_SUMMA_3D; it must divide the
+// grid size. The default of zero picks the largest divisor c of the grid
+// size with c^3 <= p.
+void SetGemmReplicationDepth( Int depth );
+Int GemmReplicationDepth();
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
@@ -89,6 +97,70 @@ void LocalGemm
            const AbstractDistMatrix<T>& B,
                  AbstractDistMatrix<T>& C );
 
+// Gemm tuning
+// -----------
+
+// Parameters of the historical heuristic used by GEMM_DEFAULT for problems
+// without an entry in the tuning table
+struct GemmHeuristicCtrl
+{
+    double weightTowardsC=2.;
+    double weightAwayFromDot=10.;
+    Int blocksizeDot=2000;
+};
+
+void SetGemmHeuristics( const GemmHeuristicCtrl& ctrl );
+const GemmHeuristicCtrl& GemmHeuristics();
+
+// Problems are bucketed by grid shape, datatype, device, orientations, and
+// the base-2 logarithms of m, n, and k
+struct GemmTuningKey
+{
+    int gridHeight=0, gridWidth=0;
+    string typeName;
+    Device device=Device::CPU;
+    Orientation orientA=NORMAL, orientB=NORMAL;
+    int logM=0, logN=0, logK=0;
+};
+bool operator<( const GemmTuningKey& a, const GemmTuningKey& b );
+
+GemmTuningKey MakeGemmTuningKey
+( const Grid& g, const string& typeName, Device device,
+  Orientation orientA, Orientation orientB, Int m, Int n, Int k );
+
+struct GemmTuningEntry
+{
+    GemmAlgorithm alg=GEMM_DEFAULT;
+    // Blocksize pushed for the call (the panel width for GEMM_SUMMA_DOT);
+    // zero keeps the current one
+    Int blocksize=0;
+};
+
+// The tuning table consulted by GEMM_DEFAULT. It is initially read from the
+// file named by the H_GEMM_TUNING_FILE environment variable, if it exists.
+void SetGemmTuning( const GemmTuningKey& key, const GemmTuningEntry& entry );
+bool GetGemmTuning( const GemmTuningKey& key, GemmTuningEntry& entry );
+void ClearGemmTuningTable();
+void LoadGemmTuningTable( const string& filename );
+void SaveGemmTuningTable( const string& filename );
+
+// When enabled (or when H_GEMM_AUTOTUNE is set), GEMM_DEFAULT benchmarks
+// the candidate algorithms and blocksizes for buckets missing from the
+// table, records the fastest, and writes the table back to
+// H_GEMM_TUNING_FILE if it is set
+void SetGemmAutotuning( bool autotune );
+bool GemmAutotuning();
+
+// Times each candidate on random matrices of the given shape, records the
+// fastest in the tuning table, and returns it. Collective over g.Comm().
+template<typename T>
+GemmTuningEntry TuneGemm
+( Orientation orientA, Orientation orientB, Int m, Int n, Int k,
+  const Grid& g, Device device=Device::CPU );
+
+string GemmAlgorithmName( GemmAlgorithm alg );
+GemmAlgorithm GemmAlgorithmFromName( const string& name );
+
 // Hemm
 // ====
 template<typename T>
@@ -601,6 +673,109 @@ void NormalFromEVD
   const AbstractDistMatrix<Complex<Real>>& w,
   const AbstractDistMatrix<Complex<Real>>& Z );
 
+// Batched
+// =======
+// Apply the same operation to each of 'batchCount' independent (typically
+// small) matrices, with the batch divided among OpenMP threads. The member
+// matrices are addressed in one of four ways:
+//
+//  - 'Strided': member b of A begins at A + b*strideA,
+//  - pointer-array: member b of A begins at A[b],
+//  - a vector of Matrix objects, whose sizes may vary from member to member,
+//  - 'Interleaved': the batch is innermost, so that entry (i,j) of member b
+//    lives at A[(i+j*ALDim)*batchCount+b]. The kernels then vectorize across
+//    the batch, which is far faster than a BLAS call per member for matrices
+//    of dimension below a few dozen.
+
+template<typename T>
+void GemmBatched
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k,
+  T alpha, const T* const* A, Int ALDim,
+           const T* const* B, Int BLDim,
+  T beta,        T* const* C, Int CLDim,
+  Int batchCount );
+template<typename T>
+void GemmStridedBatched
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k,
+  T alpha, const T* A, Int ALDim, Int strideA,
+           const T* B, Int BLDim, Int strideB,
+  T beta,        T* C, Int CLDim, Int strideC,
+  Int batchCount );
+template<typename T>
+void GemmBatched
+( Orientation orientA, Orientation orientB,
+  T alpha, const vector<Matrix<T>>& A,
+           const vector<Matrix<T>>& B,
+  T beta,        vector<Matrix<T>>& C );
+template<typename T>
+void GemmInterleavedBatched
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k,
+  T alpha, const T* A, Int ALDim,
+           const T* B, Int BLDim,
+  T beta,        T* C, Int CLDim,
+  Int batchCount );
+
+template<typename T>
+void HerkBatched
+( UpperOrLower uplo, Orientation orientation,
+  Int n, Int k,
+  Base<T> alpha, const T* const* A, Int ALDim,
+  Base<T> beta,        T* const* C, Int CLDim,
+  Int batchCount );
+template<typename T>
+void HerkStridedBatched
+( UpperOrLower uplo, Orientation orientation,
+  Int n, Int k,
+  Base<T> alpha, const T* A, Int ALDim, Int strideA,
+  Base<T> beta,        T* C, Int CLDim, Int strideC,
+  Int batchCount );
+template<typename T>
+void HerkBatched
+( UpperOrLower uplo, Orientation orientation,
+  Base<T> alpha, const vector<Matrix<T>>& A,
+  Base<T> beta,        vector<Matrix<T>>& C );
+template<typename T>
+void HerkInterleavedBatched
+( UpperOrLower uplo, Orientation orientation,
+  Int n, Int k,
+  Base<T> alpha, const T* A, Int ALDim,
+  Base<T> beta,        T* C, Int CLDim,
+  Int batchCount );
+
+template<typename F>
+void TrsmBatched
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  Int m, Int n,
+  F alpha, const F* const* A, Int ALDim,
+                 F* const* B, Int BLDim,
+  Int batchCount );
+template<typename F>
+void TrsmStridedBatched
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  Int m, Int n,
+  F alpha, const F* A, Int ALDim, Int strideA,
+                 F* B, Int BLDim, Int strideB,
+  Int batchCount );
+template<typename F>
+void TrsmBatched
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const vector<Matrix<F>>& A,
+                 vector<Matrix<F>>& B );
+template<typename F>
+void TrsmInterleavedBatched
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  Int m, Int n,
+  F alpha, const F* A, Int ALDim,
+                 F* B, Int BLDim,
+  Int batchCount );
+
 } // namespace El
 
 #endif // ifndef EL_BLAS3_HPP
@@ -538,9 +538,9 @@ inline ElPermutationMeta CReflect( const PermutationMeta& meta )
     ElPermutationMeta metaC;
 
     metaC.align = meta.align;
-    metaC.comm = meta.comm.comm;
+    metaC.comm = meta.comm->GetMPIComm();
 
-    const Int commSize = mpi::Size( meta.comm );
+    const Int commSize = mpi::Size( *meta.comm );
     metaC.sendCounts = new int[commSize];
     metaC.sendDispls = new int[commSize];
     metaC.recvCounts = new int[commSize];
@@ -159,6 +159,11 @@ public:
 
     // Batch updating of remote entries
     // ---------------------------------
+    // For elemental distributions, QueueUpdate may be called concurrently
+    // from the threads of an OpenMP parallel region. ProcessQueues must be
+    // called by every process (of the viewing communicator if
+    // includeViewers is true) outside of any parallel region; it sums
+    // duplicate updates before sending them.
     virtual void Reserve(Int numRemoteEntries) = 0;
     virtual void QueueUpdate(const Entry<Ring>& entry) EL_NO_RELEASE_EXCEPT = 0;
     virtual void QueueUpdate(Int i, Int j, Ring value) EL_NO_RELEASE_EXCEPT = 0;
@@ -88,6 +88,29 @@ public:
     void Attach(const El::Grid& grid, El::Matrix<Ring>& A);
     void LockedAttach(const El::Grid& grid, const El::Matrix<Ring>& A);
 
+    // File-backed storage
+    // -------------------
+    // Resize to height x width and back the local matrix with a mapping of
+    // the column-major local data of this process, starting 'offset' bytes
+    // into 'filename' (see Matrix::MapFile)
+    void MapLocalFile
+    (const string& filename, Int height, Int width,
+      FileMapMode mode, size_t offset=0);
+
+    // Node-shared storage
+    // -------------------
+    // Keep a single copy of the local matrix on each node, shared by the
+    // processes of RedundantComm() on that node (which hold identical local
+    // data), while preserving the current contents. Those processes must
+    // then resize and modify the matrix collectively: redistributions into
+    // it have one process per node write the local data and then
+    // synchronize, but local updates of the shared data are unsafe unless
+    // only the writer performs them, followed by NodeSharedBarrier.
+    void SetNodeSharedStorage(bool share=true);
+    bool NodeSharedStorage() const;
+    bool NodeSharedWriter() const;
+    void NodeSharedBarrier() const;
+
     // Operator overloading
     // ====================
 
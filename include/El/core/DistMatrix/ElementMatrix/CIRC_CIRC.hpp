@@ -292,6 +292,12 @@ private:
     // Remote updates
     // --------------
     vector<Entry<Ring>> remoteUpdates_;
+#ifdef EL_HYBRID
+    // Updates queued from within OpenMP parallel regions, one queue per
+    // thread, which are merged into remoteUpdates_ by ProcessQueues
+    vector<vector<Entry<Ring>>> threadUpdates_ =
+      vector<vector<Entry<Ring>>>(omp_get_max_threads());
+#endif
 };
 
 } // namespace El
@@ -16,7 +16,8 @@ namespace El {
 struct PermutationMeta
 {
     Int align;
-    mpi::Comm comm;
+    // The communicator is owned by the Grid of the permuted matrix
+    const mpi::Comm* comm;
 
     // Will treat vector lengths as one
     vector<int> sendCounts, sendDispls,
@@ -52,7 +53,7 @@ struct PermutationMeta
     }
 
     PermutationMeta()
-        : align(0), /*comm(mpi::COMM_SELF), FIXME (trb)*/
+        : align(0), comm(nullptr),
           sendCounts(1,0), sendDispls(1,0),
           recvCounts(1,0), recvDispls(1,0)
     { }
@@ -61,13 +62,13 @@ struct PermutationMeta
     ( const DistMatrix<Int,STAR,STAR>& p,
       const DistMatrix<Int,STAR,STAR>& pInv,
             Int permAlign,
-            mpi::Comm permComm );
+            mpi::Comm const& permComm );
 
     void Update
     ( const DistMatrix<Int,STAR,STAR>& p,
       const DistMatrix<Int,STAR,STAR>& pInv,
             Int permAlign,
-            mpi::Comm permComm );
+            mpi::Comm const& permComm );
 };
 
 // TODO(poulson): Convert to accepting Grid rather than mpi::Comm
@@ -186,7 +187,7 @@ private:
     mutable bool staleInverse_=true;
 
     // Use the alignment and communicator as a key
-    typedef std::pair<Int,mpi::Comm> keyType_;
+    typedef std::pair<Int,MPI_Comm> keyType_;
     mutable std::map<keyType_,PermutationMeta> rowMeta_, colMeta_;
     mutable bool staleMeta_=false;
 };
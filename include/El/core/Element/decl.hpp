@@ -165,6 +165,21 @@ template<typename Real> struct PromoteHelper<Complex<Real>>
 
 template<typename Field> using Promote = typename PromoteHelper<Field>::type;
 
+// Decrease the precision (if possible)
+// ------------------------------------
+template<typename Field> struct DemoteHelper { typedef Field type; };
+template<> struct DemoteHelper<double> { typedef float type; };
+#ifdef HYDROGEN_HAVE_HALF
+template<> struct DemoteHelper<float> { typedef cpu_half_type type; };
+#endif
+
+template<typename Real> struct DemoteHelper<Complex<Real>>
+{ typedef Complex<typename DemoteHelper<Real>::type> type; };
+// Complex half-precision is not instantiated
+template<> struct DemoteHelper<Complex<float>> { typedef Complex<float> type; };
+
+template<typename Field> using Demote = typename DemoteHelper<Field>::type;
+
 template<typename S,typename T>
 struct CanCast
 {
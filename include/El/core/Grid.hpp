@@ -10,14 +10,35 @@
 #ifndef EL_GRID_HPP
 #define EL_GRID_HPP
 
+#include <map>
+#include <memory>
+
 namespace El {
 
+// Topology-aware grid construction: the processes are placed so that the
+// communicator 'onNode' (MC or MR) of the grid lies within a node whenever
+// possible, and the grid shape minimizes the communication volume of a
+// SUMMA-style algorithm on matrices of the given aspect ratio (height over
+// width), with words exchanged within a node costing 'intraNodeCost' times
+// as much as words sent between nodes. Nodes are the shared-memory domains
+// of the communicator, optionally split by mpi::SetMaxRanksPerNode (e.g.,
+// into sockets).
+struct GridTopologyCtrl
+{
+    Dist onNode=MC;
+    double aspectRatio=1;
+    double intraNodeCost=0.25;
+};
+
 class Grid
 {
 public:
     Grid();
     explicit Grid(mpi::Comm comm, GridOrder order=COLUMN_MAJOR);
     explicit Grid(mpi::Comm comm, int height, GridOrder order=COLUMN_MAJOR);
+    explicit Grid
+    (mpi::Comm comm, const GridTopologyCtrl& ctrl,
+     GridOrder order=COLUMN_MAJOR);
     ~Grid();
 
     // Simple interface (simpler version of distributed-based interface)
@@ -86,6 +107,15 @@ public:
     EL_NO_RELEASE_EXCEPT;
     int VCToViewing( int VCRank ) const EL_NO_EXCEPT;
 
+    // Replication layers for 2.5D/3D algorithms: the owning processes are
+    // split into 'depth' layers of Size()/depth consecutive VC ranks. Each
+    // layer is a grid viewed by every process viewing this grid, and the
+    // depth communicator connects the processes holding the same position
+    // within their layer (ranked by layer). Both are built collectively
+    // over ViewingComm() on first use and then cached.
+    const Grid& LayerGrid( int depth, int layer ) const;
+    mpi::Comm const& DepthComm( int depth ) const;
+
 #ifdef EL_HAVE_SCALAPACK
     // TODO(poulson): More distribution contexts and handles
     int BlacsVCHandle() const;
@@ -94,6 +124,11 @@ public:
 #endif
 
     static int DefaultHeight( int gridSize ) EL_NO_EXCEPT;
+    // The height chosen for a topology-aware grid when every node holds a
+    // multiple of ranksPerNode processes
+    static int TopologyAwareHeight
+    ( int gridSize, int ranksPerNode, const GridTopologyCtrl& ctrl )
+    EL_NO_EXCEPT;
 
     // To be used internally by Elemental
     static void InitializeDefault();
@@ -136,7 +171,16 @@ private:
     int blacsMCMRContext_;
 #endif
 
+    struct ReplicationLayers
+    {
+        std::vector<std::unique_ptr<Grid>> layerGrids;
+        mpi::Comm depthComm;
+    };
+    mutable std::map<int,std::unique_ptr<ReplicationLayers>>
+      replicationLayers_;
+
     void SetUpGrid();
+    const ReplicationLayers& GetReplicationLayers( int depth ) const;
 
     // Disable copying this class due to MPI_Comm/MPI_Group ownership issues
     // and potential performance loss from duplicating MPI communicators, e.g.,
@@ -182,6 +182,70 @@ public:
     void SetMemoryMode(memory_mode_type mode) override;
     memory_mode_type MemoryMode() const EL_NO_EXCEPT override;
 
+    ///@}
+    /** @name File-backed storage */
+    ///@{
+
+    /** @brief Back the matrix with a memory mapping of a binary file.
+     *
+     *  The file is read as a column-major matrix, starting @c offset
+     *  bytes into it, and pages are only read from disk when first
+     *  touched. A read-only mapping leaves the matrix locked; a
+     *  copy-on-write mapping never modifies the file; a shared mapping
+     *  writes updates back to it. The mapping is released when the
+     *  matrix is emptied or destroyed, and it cannot be grown by Resize.
+     *
+     *  @throws RuntimeError if the file is too short or cannot be mapped.
+     */
+    void MapFile(
+        std::string const& filename, size_type height, size_type width,
+        FileMapMode mode, size_t offset=0);
+    void MapFile(
+        std::string const& filename, size_type height, size_type width,
+        size_type leadingDimension, FileMapMode mode, size_t offset=0);
+
+    /** @brief Test if the matrix storage is a file mapping. */
+    bool FileBacked() const EL_NO_EXCEPT;
+
+    /** @brief Hint at how columns [firstCol,firstCol+numCols) will next
+     *         be accessed.
+     *
+     *  This is a no-op unless the matrix is file-backed, so panel
+     *  algorithms may call it unconditionally.
+     */
+    void AdviseFileAccess(
+        FileAccessHint hint, Int firstCol=0, Int numCols=END) const;
+
+    /** @brief Flush modifications of a shared file mapping to disk. */
+    void SyncFile() const;
+
+    ///@}
+    /** @name Node-shared storage */
+    ///@{
+
+    /** @brief Store the matrix in a buffer shared by the processes of a
+     *         node (or privately again if @c nodeComms is null).
+     *
+     *  The contents are discarded. Every process of the node must then
+     *  resize the matrix identically, since allocation is collective, and
+     *  the processes should modify the shared contents by having the
+     *  writer update them and then all calling NodeSharedBarrier.
+     */
+    void SetNodeShared(std::shared_ptr<mpi::NodeComms> nodeComms);
+
+    /** @brief Test if the matrix storage is shared by a node. */
+    bool NodeShared() const EL_NO_EXCEPT;
+
+    /** @brief Test if this process writes the contents shared by its
+     *         node (which is always true for private storage).
+     */
+    bool NodeSharedWriter() const EL_NO_EXCEPT;
+
+    /** @brief Wait for every process sharing the storage, making their
+     *         writes visible to all (a no-op for private storage).
+     */
+    void NodeSharedBarrier() const;
+
     ///@}
 
     // Single-entry manipulation
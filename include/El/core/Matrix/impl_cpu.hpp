@@ -195,6 +195,12 @@ Matrix<T, Device::CPU>&
 Matrix<T, Device::CPU>::operator=(Matrix<T, Device::CPU> const& A)
 {
     EL_DEBUG_CSE;
+    // Copy into node-shared storage in place so that it stays shared
+    if (memory_.NodeShared() && !this->Viewing())
+    {
+        ::El::Copy(A, *this);
+        return *this;
+    }
     Matrix<T, Device::CPU>{A}.Swap(*this);
     return *this;
 }
@@ -286,6 +292,102 @@ auto Matrix<T, Device::CPU>::MemoryMode() const EL_NO_EXCEPT
     -> memory_mode_type
 { return memory_.Mode(); }
 
+// File-backed storage
+// ===================
+
+template <typename T>
+void Matrix<T, Device::CPU>::MapFile(
+    std::string const& filename, size_type height, size_type width,
+    FileMapMode mode, size_t offset)
+{
+    EL_DEBUG_CSE;
+    MapFile(filename, height, width, Max(height, size_type{1}), mode, offset);
+}
+
+template <typename T>
+void Matrix<T, Device::CPU>::MapFile(
+    std::string const& filename, size_type height, size_type width,
+    size_type leadingDimension, FileMapMode mode, size_t offset)
+{
+    EL_DEBUG_CSE;
+    if (!std::is_trivially_copyable<T>::value)
+        LogicError("Only trivially-copyable types can be backed by a file");
+    AssertValidDimensions(height, width, leadingDimension);
+#ifndef EL_RELEASE
+    if (this->FixedSize())
+        LogicError("Cannot map a file into a fixed-size matrix");
+#endif // !EL_RELEASE
+
+    this->Empty();
+    // The final column need not be padded out to the leading dimension
+    const size_type size =
+        (width > 0 ? (width-1)*leadingDimension + height : 0);
+    data_ = memory_.MapFile(filename, size, mode, offset);
+    if (mode == FILE_MAP_READ_ONLY)
+        this->SetViewType(LOCKED_OWNER);
+    this->SetSize_(height, width, leadingDimension);
+}
+
+template <typename T>
+bool Matrix<T, Device::CPU>::FileBacked() const EL_NO_EXCEPT
+{ return memory_.FileBacked(); }
+
+template <typename T>
+void Matrix<T, Device::CPU>::AdviseFileAccess(
+    FileAccessHint hint, Int firstCol, Int numCols) const
+{
+    EL_DEBUG_CSE;
+    if (!FileBacked() || data_ == nullptr)
+        return;
+    if (numCols == END)
+        numCols = this->Width() - firstCol;
+    if (numCols <= 0)
+        return;
+    const size_t first = (data_ - memory_.Buffer()) + firstCol*this->LDim();
+    const size_t numEntries = (numCols-1)*this->LDim() + this->Height();
+    memory_.Advise(hint, first, numEntries);
+}
+
+template <typename T>
+void Matrix<T, Device::CPU>::SyncFile() const
+{
+    EL_DEBUG_CSE;
+    memory_.Sync();
+}
+
+// Node-shared storage
+// ===================
+
+template <typename T>
+void Matrix<T, Device::CPU>::SetNodeShared(
+    std::shared_ptr<mpi::NodeComms> nodeComms)
+{
+    EL_DEBUG_CSE;
+    if (nodeComms && !std::is_trivially_copyable<T>::value)
+        LogicError("Only trivially-copyable types can be shared by a node");
+#ifndef EL_RELEASE
+    if (this->Viewing())
+        LogicError("Cannot share the storage of a view");
+#endif // !EL_RELEASE
+    this->Empty();
+    memory_.SetNodeShared(std::move(nodeComms));
+}
+
+template <typename T>
+bool Matrix<T, Device::CPU>::NodeShared() const EL_NO_EXCEPT
+{ return memory_.NodeShared(); }
+
+template <typename T>
+bool Matrix<T, Device::CPU>::NodeSharedWriter() const EL_NO_EXCEPT
+{ return memory_.NodeSharedWriter(); }
+
+template <typename T>
+void Matrix<T, Device::CPU>::NodeSharedBarrier() const
+{
+    EL_DEBUG_CSE;
+    memory_.NodeSharedBarrier();
+}
+
 // Single-entry manipulation
 // =========================
 
@@ -563,7 +665,9 @@ template <typename T>
 void Matrix<T, Device::CPU>::do_empty_(bool freeMemory)
 {
     EL_DEBUG_CSE;
-    if (freeMemory)
+    // A mapping may be read-only, and the lock is cleared on emptying, so
+    // it is never kept around for reuse
+    if (freeMemory || memory_.FileBacked())
         memory_.Empty();
     data_ = nullptr;
 }
@@ -636,10 +740,19 @@ EL_NO_RELEASE_EXCEPT
 
 template <typename T>
 void Matrix<T, Device::CPU>::do_resize_(
-    size_type const& /*height*/, size_type const& width,
+    size_type const& height, size_type const& width,
     size_type const& ldim)
 {
-    data_ = memory_.Require(ldim * width);
+    if (memory_.FileBacked())
+    {
+        // Reinterpret the mapping rather than require the final column to
+        // be padded out to the leading dimension
+        if (width > 0 && size_t((width-1)*ldim + height) > memory_.Size())
+            LogicError("Cannot grow a file-backed matrix");
+        data_ = memory_.Buffer();
+    }
+    else
+        data_ = memory_.Require(ldim * width);
 }
 
 // For supporting duck typing
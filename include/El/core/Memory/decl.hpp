@@ -9,6 +9,9 @@
 #ifndef EL_MEMORY_DECL_HPP
 #define EL_MEMORY_DECL_HPP
 
+#include <memory>
+#include <string>
+
 #include <hydrogen/Device.hpp>
 #include <hydrogen/SyncInfo.hpp>
 
@@ -39,6 +42,51 @@ constexpr unsigned DefaultMemoryMode<Device::GPU>()
 }
 #endif // HYDROGEN_HAVE_GPU
 
+// How a file-backed buffer shares its contents with the file
+namespace FileMapModeNS {
+enum FileMapMode
+{
+    FILE_MAP_READ_ONLY,     // the buffer may not be modified
+    FILE_MAP_COPY_ON_WRITE, // modifications are private to the process
+    FILE_MAP_SHARED         // modifications are written back to the file
+};
+}
+using namespace FileMapModeNS;
+
+// Expected access pattern for a range of a file-backed buffer
+namespace FileAccessHintNS {
+enum FileAccessHint
+{
+    FILE_ACCESS_NORMAL,
+    FILE_ACCESS_SEQUENTIAL,
+    FILE_ACCESS_RANDOM,
+    FILE_ACCESS_WILL_NEED,
+    FILE_ACCESS_DONT_NEED
+};
+}
+using namespace FileAccessHintNS;
+
+namespace mpi
+{
+class NodeComms;
+}
+
+namespace details
+{
+// Map bytes [offset,offset+numBytes) of a file into memory and return a
+// pointer to the first of them. Since mappings must begin on a page
+// boundary, the extent of the actual mapping is returned through
+// 'mapBase' and 'mapBytes' for the remaining routines.
+void* MapFile(
+    std::string const& filename, size_t offset, size_t numBytes,
+    FileMapMode mode, void*& mapBase, size_t& mapBytes);
+void UnmapFile(void* mapBase, size_t mapBytes) noexcept;
+void AdviseFile(
+    void* mapBase, size_t mapBytes,
+    void const* first, size_t numBytes, FileAccessHint hint);
+void SyncFile(void* mapBase, size_t mapBytes);
+} // namespace details
+
 template<typename G, Device D=Device::CPU>
 class Memory
 {
@@ -67,12 +115,39 @@ public:
 
     void SetMode(unsigned int mode);
     unsigned int Mode() const;
+
+    // Replace the buffer with a mapping of 'size' entries of the file
+    // 'filename', starting 'offset' bytes into it. A file-backed buffer
+    // cannot grow, and it is unmapped (rather than freed) when emptied.
+    G* MapFile(
+        std::string const& filename, size_t size,
+        FileMapMode mode, size_t offset=0);
+    bool FileBacked() const noexcept;
+    // Hint at the access pattern for entries [first,first+numEntries)
+    void Advise(FileAccessHint hint, size_t first, size_t numEntries) const;
+    // Flush modifications of a shared mapping to the file
+    void Sync() const;
+
+    // Allocate future buffers in a shared-memory window over the processes
+    // of a node (or privately again if 'nodeComms' is null), discarding the
+    // current buffer. Those processes must then require the same sizes, as
+    // allocating and freeing a node-shared buffer is collective.
+    void SetNodeShared(std::shared_ptr<mpi::NodeComms> nodeComms);
+    bool NodeShared() const noexcept;
+    // Whether this process writes the contents shared by its node
+    bool NodeSharedWriter() const noexcept;
+    // Make the writes of every process sharing the buffer visible to all
+    void NodeSharedBarrier() const;
 private:
     size_t size_;
     G* rawBuffer_;
     G* buffer_;
     unsigned int mode_ = DefaultMemoryMode<D>();
     SyncInfo<D> syncInfo_ = SyncInfo<D>{};
+    void* mapBase_ = nullptr;
+    size_t mapBytes_ = 0;
+    std::shared_ptr<mpi::NodeComms> nodeComms_;
+    MPI_Win window_ = MPI_WIN_NULL;
 
 };// class Memory
 
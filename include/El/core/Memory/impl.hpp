@@ -238,6 +238,10 @@ void Memory<G,D>::ShallowSwap(Memory<G,D>& mem) EL_NO_EXCEPT
     std::swap(buffer_, mem.buffer_);
     std::swap(mode_, mem.mode_);
     std::swap(syncInfo_, mem.syncInfo_);
+    std::swap(mapBase_, mem.mapBase_);
+    std::swap(mapBytes_, mem.mapBytes_);
+    std::swap(nodeComms_, mem.nodeComms_);
+    std::swap(window_, mem.window_);
 }
 
 template<typename G, Device D>
@@ -255,7 +259,16 @@ G* Memory<G,D>::Require(size_t size)
 {
     if(size > size_)
     {
+        if(FileBacked())
+            LogicError("Cannot grow a file-backed buffer");
         Empty();
+        if(NodeShared())
+        {
+            buffer_ = static_cast<G*>(
+                nodeComms_->AllocateShared(size*sizeof(G), window_));
+            size_ = size;
+            return buffer_;
+        }
 #ifndef EL_RELEASE
         try
         {
@@ -293,10 +306,21 @@ void Memory<G,D>::Release()
 template<typename G, Device D>
 void Memory<G,D>::Empty()
 {
-    if(rawBuffer_ != nullptr)
+    if(mapBase_ != nullptr)
+    {
+        details::UnmapFile(mapBase_, mapBytes_);
+        mapBase_ = nullptr;
+        mapBytes_ = 0;
+    }
+    else if(window_ != MPI_WIN_NULL)
+    {
+        mpi::NodeComms::FreeSharedWindow(window_);
+    }
+    else if(rawBuffer_ != nullptr)
     {
         Delete(rawBuffer_, mode_, syncInfo_);
     }
+    rawBuffer_ = nullptr;
     buffer_ = nullptr;
     size_ = 0;
 }
@@ -326,7 +350,9 @@ SyncInfo<D> const& Memory<G,D>::GetSyncInfo() const
 template<typename G, Device D>
 void Memory<G,D>::SetMode(unsigned int mode)
 {
-    if (size_ > 0 && mode_ != mode)
+    // A file mapping is left in place; the mode applies to the next
+    // allocation
+    if (size_ > 0 && mode_ != mode && !FileBacked() && !NodeShared())
     {
         Delete(rawBuffer_, mode_, syncInfo_);
         rawBuffer_ = New<G>(size_, mode, syncInfo_);
@@ -339,6 +365,66 @@ template<typename G, Device D>
 unsigned int Memory<G,D>::Mode() const
 { return mode_; }
 
+template<typename G, Device D>
+G* Memory<G,D>::MapFile(
+    std::string const& filename, size_t size,
+    FileMapMode mode, size_t offset)
+{
+    if (D != Device::CPU)
+        LogicError("Only CPU memory can be backed by a file");
+    Empty();
+    buffer_ = static_cast<G*>(
+        details::MapFile(
+            filename, offset, size*sizeof(G), mode, mapBase_, mapBytes_));
+    size_ = (buffer_ == nullptr ? 0 : size);
+    return buffer_;
+}
+
+template<typename G, Device D>
+bool Memory<G,D>::FileBacked() const EL_NO_EXCEPT
+{ return mapBase_ != nullptr; }
+
+template<typename G, Device D>
+void Memory<G,D>::Advise(
+    FileAccessHint hint, size_t first, size_t numEntries) const
+{
+    if (FileBacked() && first < size_)
+        details::AdviseFile(
+            mapBase_, mapBytes_, buffer_+first,
+            Min(numEntries, size_-first)*sizeof(G), hint);
+}
+
+template<typename G, Device D>
+void Memory<G,D>::Sync() const
+{
+    if (FileBacked())
+        details::SyncFile(mapBase_, mapBytes_);
+}
+
+template<typename G, Device D>
+void Memory<G,D>::SetNodeShared(std::shared_ptr<mpi::NodeComms> nodeComms)
+{
+    if (D != Device::CPU && nodeComms)
+        LogicError("Only CPU memory can be shared by a node");
+    Empty();
+    nodeComms_ = std::move(nodeComms);
+}
+
+template<typename G, Device D>
+bool Memory<G,D>::NodeShared() const EL_NO_EXCEPT
+{ return nodeComms_ != nullptr; }
+
+template<typename G, Device D>
+bool Memory<G,D>::NodeSharedWriter() const EL_NO_EXCEPT
+{ return !NodeShared() || nodeComms_->Leader(); }
+
+template<typename G, Device D>
+void Memory<G,D>::NodeSharedBarrier() const
+{
+    if (NodeShared())
+        nodeComms_->Barrier(window_);
+}
+
 #ifdef EL_INSTANTIATE_CORE
 # define EL_EXTERN
 #else
@@ -8,6 +8,8 @@
 #include <hip/hip_runtime.h>
 #endif
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdlib>
 #include <iostream>
@@ -50,14 +52,56 @@ size_t default_mempool_min_bin() noexcept;
 /** @brief Check env(H_MEMPOOL_MAX_BIN). Default (1<<26). */
 size_t default_mempool_max_bin() noexcept;
 
+/** @brief Check env(H_MEMPOOL_THREAD_CACHE). Default 0UL (disabled). */
+size_t default_mempool_thread_cache() noexcept;
+
+/** @brief Check env(H_MEMPOOL_MAX_CACHED). Default 0UL (unlimited). */
+size_t default_mempool_max_cached() noexcept;
+
 } // namespace details
 
+/** @brief A snapshot of the state of a memory pool. */
+struct MemoryPoolStatistics
+{
+    /** Allocations served from cached blocks. */
+    size_t hits = 0;
+    /** Allocations that required new memory from the system. */
+    size_t misses = 0;
+    /** Bytes currently obtained from the system. */
+    size_t bytes_allocated = 0;
+    /** High-water mark of bytes_allocated. */
+    size_t peak_bytes_allocated = 0;
+    /** Bytes held in free lists, including the per-thread ones. */
+    size_t bytes_cached = 0;
+    /** Bytes of the blocks handed out and not yet released. */
+    size_t bytes_in_use = 0;
+    /** Bytes requested by the allocations that are still live. */
+    size_t bytes_requested = 0;
+    /** Fraction of bytes_in_use lost to rounding up to a bin size. */
+    double fragmentation = 0.;
+};
+
 /** Simple caching memory pool.
  *  This maintains a set of bins that contain allocations of a fixed size.
  *  Each allocation will use the smallest size greater than or equal to the
  *  requested size. If an allocation is larger than any bin, it is allocated
  *  and freed directly.
- *  This memory pool is thread-safe.
+ *
+ *  By default, all bins are shared and protected by a single mutex. If
+ *  thread caching is enabled, each thread additionally keeps up to
+ *  thread_cache_size free blocks of each bin of at most
+ *  THREAD_CACHE_MAX_BIN_SIZE bytes, so that the common small allocations
+ *  are served without locking; a thread returns half of a full free list
+ *  (and all of its blocks when it exits) to the shared bins. A thread's
+ *  cache belongs to the first thread-caching pool it uses; other pools
+ *  take their shared path from that thread.
+ *
+ *  If max_cached_bytes is nonzero, it acts as a high-water mark on the
+ *  bytes held in the shared bins: once exceeded, the largest cached
+ *  blocks are returned to the system until half of it remains.
+ *
+ *  This memory pool is thread-safe. It must not be destroyed while
+ *  other threads are still using it.
  *  @tparam Pinned Whether this pool allocates CUDA pinned memory.
  */
 template <bool Pinned>
@@ -65,6 +109,9 @@ class MemoryPool
 {
 public:
 
+    /** Largest bin that is cached per thread. */
+    static constexpr size_t THREAD_CACHE_MAX_BIN_SIZE = 1UL << 20;
+
     /** Initialize the memory pool.
      *  This sets up bins per specification, and additionally adds power-of-2
      *  bins.
@@ -72,12 +119,22 @@ public:
      *  @param min_bin_size Smallest bin size (in bytes).
      *  @param max_bin_size Largest bin size (in bytes).
      *  @param debug Print debugging messages.
+     *  @param thread_cache_size Free blocks kept per bin and thread
+     *         (zero disables thread caching).
+     *  @param max_cached_bytes Trimming threshold for the shared bins
+     *         (zero disables trimming).
      */
     MemoryPool(float const bin_growth = details::default_mempool_bin_growth(),
                size_t const min_bin_size = details::default_mempool_min_bin(),
                size_t const max_bin_size = details::default_mempool_max_bin(),
-               bool const debug = details::debug_mempool())
-        : debug_{debug}
+               bool const debug = details::debug_mempool(),
+               size_t const thread_cache_size =
+                 details::default_mempool_thread_cache(),
+               size_t const max_cached_bytes =
+                 details::default_mempool_max_cached())
+        : thread_cache_size_{thread_cache_size},
+          max_cached_bytes_{max_cached_bytes},
+          debug_{debug}
     {
         std::set<size_t> bin_sizes;
         for (float bin_size = min_bin_size;
@@ -98,6 +155,11 @@ public:
         // Set up bins.
         for (size_t i = 0; i < bin_sizes_.size(); ++i)
             free_data_.emplace_back();
+        if (thread_cache_size_ > 0)
+            num_thread_bins_ =
+              std::upper_bound(bin_sizes_.begin(), bin_sizes_.end(),
+                               THREAD_CACHE_MAX_BIN_SIZE)
+              - bin_sizes_.begin();
         if (debug_)
         {
             std::clog << "==Mempool(" << this << ")== "
@@ -105,7 +167,9 @@ public:
                       << "pinned=" << (Pinned ? "t" : "f")
                       << ", growth=" << bin_growth
                       << ", min bin=" << bin_sizes_.front()
-                      << ", max bin=" << bin_sizes_.back() << ")\n"
+                      << ", max bin=" << bin_sizes_.back()
+                      << ", thread cache=" << thread_cache_size_
+                      << ", max cached=" << max_cached_bytes_ << ")\n"
                       << "==Mempool(" << this << ")== "
                       << "Bin sizes: [";
             for (auto const& b : bin_sizes_)
@@ -115,6 +179,29 @@ public:
     }
     ~MemoryPool()
     {
+        if (debug_)
+        {
+            auto const stats = Statistics();
+            std::clog << "==Mempool(" << this << ")== "
+                      << stats.hits << " hits, "
+                      << stats.misses << " misses, "
+                      << stats.peak_bytes_allocated << " peak bytes"
+                      << std::endl;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (auto* cache : thread_caches_)
+            {
+                for (auto& free_list : cache->bins)
+                {
+                    for (auto&& ptr : free_list)
+                        do_free(ptr);
+                    std::vector<void*>{}.swap(free_list);
+                }
+                cache->pool = nullptr;
+            }
+            thread_caches_.clear();
+        }
         FreeAllUnused();
         if (debug_)
             std::clog << "==Mempool(" << this << ")== "
@@ -127,98 +214,404 @@ public:
 
     /** Return memory of size bytes. */
     void* Allocate(size_t size)
+    {
+        size_t const bin = get_bin(size);
+        if (thread_cache_size_ == 0)
+            return allocate_shared(bin, size);
+
+        // Blocks carry a header with their bin so that they can be freed
+        // without consulting (and locking) the allocation map.
+        void* mem = nullptr;
+        ThreadCache* cache =
+          (bin < num_thread_bins_ ? get_thread_cache() : nullptr);
+        if (cache)
+        {
+            auto& free_list = cache->bins[bin];
+            if (free_list.size() > 0)
+            {
+                mem = free_list.back();
+                free_list.pop_back();
+                bump(cache->hits, 1);
+                bump(cache->bytes_cached, -(long long)bin_sizes_[bin]);
+            }
+            else
+                mem = allocate_shared(bin, size, false);
+            bump(cache->bytes_in_use, bin_sizes_[bin]);
+            bump(cache->bytes_requested, size);
+        }
+        else
+            mem = allocate_shared(bin, size);
+        auto* header = static_cast<BlockHeader*>(mem);
+        header->bin = bin;
+        header->size = size;
+        return static_cast<char*>(mem) + HEADER_SIZE;
+    }
+    /** Release previously allocated memory. */
+    void Free(void* ptr)
+    {
+        if (thread_cache_size_ == 0)
+        {
+            free_shared(ptr);
+            return;
+        }
+
+        void* const mem = static_cast<char*>(ptr) - HEADER_SIZE;
+        auto const* header = static_cast<BlockHeader const*>(mem);
+        size_t const bin = header->bin;
+        size_t const size = header->size;
+        ThreadCache* cache =
+          (bin < num_thread_bins_ ? get_thread_cache() : nullptr);
+        if (!cache)
+        {
+            free_shared(mem, bin, size);
+            return;
+        }
+        bump(cache->bytes_in_use, -(long long)bin_sizes_[bin]);
+        bump(cache->bytes_requested, -(long long)size);
+        auto& free_list = cache->bins[bin];
+        free_list.push_back(mem);
+        bump(cache->bytes_cached, bin_sizes_[bin]);
+        if (free_list.size() > thread_cache_size_)
+        {
+            // Hand the older half of the free list to the other threads
+            size_t const num_returned = free_list.size() / 2;
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto& shared_list = free_data_[bin];
+            shared_list.insert(shared_list.end(),
+                               free_list.begin(),
+                               free_list.begin() + num_returned);
+            free_list.erase(free_list.begin(),
+                            free_list.begin() + num_returned);
+            size_t const bytes = num_returned*bin_sizes_[bin];
+            bump(cache->bytes_cached, -(long long)bytes);
+            num_cached_blks_ += num_returned;
+            bytes_cached_ += bytes;
+            maybe_trim();
+        }
+    }
+
+    /** Return cached blocks in the shared bins to the system, largest
+     *  first, until at most max_cached_bytes remain cached there.
+     */
+    void Trim(size_t max_cached_bytes = 0)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        trim(max_cached_bytes);
+    }
+
+    /** Summarize the usage of the pool across all threads. */
+    MemoryPoolStatistics Statistics() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        long long hits = hits_;
+        long long bytes_cached = bytes_cached_;
+        long long bytes_in_use = bytes_in_use_;
+        long long bytes_requested = bytes_requested_;
+        for (auto const* cache : thread_caches_)
+        {
+            hits += cache->hits.load(std::memory_order_relaxed);
+            bytes_cached += cache->bytes_cached.load(std::memory_order_relaxed);
+            bytes_in_use += cache->bytes_in_use.load(std::memory_order_relaxed);
+            bytes_requested +=
+              cache->bytes_requested.load(std::memory_order_relaxed);
+        }
+
+        MemoryPoolStatistics stats;
+        stats.hits = hits;
+        stats.misses = misses_;
+        stats.bytes_allocated = bytes_allocated_;
+        stats.peak_bytes_allocated = peak_bytes_allocated_;
+        stats.bytes_cached = bytes_cached;
+        stats.bytes_in_use = bytes_in_use;
+        stats.bytes_requested = bytes_requested;
+        if (bytes_in_use > 0)
+            stats.fragmentation =
+              1. - double(bytes_requested) / double(bytes_in_use);
+        return stats;
+    }
+
+private:
+
+    /** Index of an invalid bin. */
+    static constexpr size_t INVALID_BIN = (size_t) -1;
+
+    /** Prefix of each block when thread caching is enabled. */
+    struct BlockHeader
+    {
+        size_t bin;
+        size_t size;
+    };
+    /** Padded to keep the returned memory maximally aligned. */
+    static constexpr size_t HEADER_SIZE =
+      ((sizeof(BlockHeader) + alignof(std::max_align_t) - 1)
+       / alignof(std::max_align_t)) * alignof(std::max_align_t);
+
+    /** Free lists of the small bins owned by one thread.
+     *  The counters are only modified by the owning thread, but are read
+     *  by Statistics().
+     */
+    struct ThreadCache
+    {
+        MemoryPool* pool = nullptr;
+        std::vector<std::vector<void*>> bins;
+        std::atomic<long long> hits{0};
+        std::atomic<long long> bytes_cached{0};
+        std::atomic<long long> bytes_in_use{0};
+        std::atomic<long long> bytes_requested{0};
+    };
+
+    /** Return the blocks of the calling thread on thread exit. */
+    struct ThreadCacheGuard
+    {
+        void Arm() noexcept {}
+        ~ThreadCacheGuard()
+        {
+            ThreadCache* cache = thread_cache_;
+            thread_cache_ = nullptr;
+            thread_exited_ = true;
+            if (cache)
+            {
+                if (cache->pool)
+                    cache->pool->release_thread_cache(cache);
+                delete cache;
+            }
+        }
+    };
+
+    /** Cache of the calling thread (trivially destructible, so that it
+     *  remains usable while other thread-local objects are destroyed).
+     */
+    static thread_local ThreadCache* thread_cache_;
+    static thread_local bool thread_exited_;
+    static thread_local ThreadCacheGuard thread_cache_guard_;
+
+    /** Serialize access from multiple threads. */
+    mutable std::mutex mutex_;
+
+    /** Size in bytes of each bin. */
+    std::vector<size_t> bin_sizes_;
+    /** Data available to allocate.
+     *  Each entry is a bin, and each bin has a vector of pointers to free
+     *  memory of that size.
+     */
+    std::vector<std::vector<void*>> free_data_;
+    /** Map used pointers to the associated bin index and requested size
+     *  (only when thread caching is disabled).
+     */
+    std::unordered_map<void*, std::pair<size_t, size_t>> alloc_to_bin_;
+
+    /** Thread caches bound to this pool. */
+    std::vector<ThreadCache*> thread_caches_;
+    /** Free blocks kept per bin and thread. */
+    size_t thread_cache_size_;
+    /** Number of (leading) bins that are cached per thread. */
+    size_t num_thread_bins_ = 0;
+    /** Trimming threshold of the shared bins. */
+    size_t max_cached_bytes_;
+
+    /** Track the total number of available blocks. */
+    size_t num_cached_blks_ = 0;
+
+    /** Statistics of the shared bins (and of exited threads). */
+    size_t hits_ = 0;
+    size_t misses_ = 0;
+    size_t bytes_allocated_ = 0;
+    size_t peak_bytes_allocated_ = 0;
+    long long bytes_cached_ = 0;
+    long long bytes_in_use_ = 0;
+    long long bytes_requested_ = 0;
+
+    /** Print debugging messages throughout lifetime. */
+    bool debug_;
+
+    /** Add to a counter that only the calling thread modifies. */
+    static void bump(std::atomic<long long>& counter, long long value)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + value,
+                      std::memory_order_relaxed);
+    }
+
+    /** Return the cache of the calling thread if it is bound to this
+     *  pool, binding it if it is unbound.
+     */
+    ThreadCache* get_thread_cache()
+    {
+        ThreadCache* cache = thread_cache_;
+        if (cache && cache->pool == this)
+            return cache;
+        if (thread_exited_ || (cache && cache->pool))
+            return nullptr;
+        if (!cache)
+        {
+            thread_cache_guard_.Arm();
+            cache = thread_cache_ = new ThreadCache;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        cache->pool = this;
+        cache->bins.resize(num_thread_bins_);
+        thread_caches_.push_back(cache);
+        return cache;
+    }
+
+    /** Move the blocks and statistics of an exiting thread into the
+     *  shared bins.
+     */
+    void release_thread_cache(ThreadCache* cache)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (size_t bin = 0; bin < cache->bins.size(); ++bin)
+        {
+            auto& free_list = cache->bins[bin];
+            free_data_[bin].insert(free_data_[bin].end(),
+                                   free_list.begin(), free_list.end());
+            num_cached_blks_ += free_list.size();
+            std::vector<void*>{}.swap(free_list);
+        }
+        hits_ += cache->hits.load(std::memory_order_relaxed);
+        bytes_cached_ += cache->bytes_cached.load(std::memory_order_relaxed);
+        bytes_in_use_ += cache->bytes_in_use.load(std::memory_order_relaxed);
+        bytes_requested_ +=
+          cache->bytes_requested.load(std::memory_order_relaxed);
+        thread_caches_.erase(
+            std::find(thread_caches_.begin(), thread_caches_.end(), cache));
+        cache->pool = nullptr;
+        maybe_trim();
+    }
+
+    /** Allocate from the shared bins. If account is false, the caller
+     *  records the usage of the block itself.
+     */
+    void* allocate_shared(size_t bin, size_t size, bool account = true)
     {
         if (debug_)
             std::clog << "==Mempool(" << this << ")== "
                       << "Requesting allocation of "
                       << size << " bytes."
                       << std::endl;
-        size_t const bin = get_bin(size);
+        size_t const header_size = (thread_cache_size_ > 0 ? HEADER_SIZE : 0);
         void* mem = nullptr;
         std::lock_guard<std::mutex> lock(mutex_);
         // size is too large, this will not be cached.
-        if (bin == INVALID_BIN)
-            mem = do_allocation(size);
-        else
+        size_t const bin_size = (bin == INVALID_BIN ? size : bin_sizes_[bin]);
+        if (bin != INVALID_BIN && free_data_[bin].size() > 0)
         {
             // Check if there is available memory in our bin.
-            if (free_data_[bin].size() > 0)
-            {
-                mem = free_data_[bin].back();
-                free_data_[bin].pop_back();
-                --num_cached_blks_;
-                if (debug_)
-                    std::clog << "==Mempool(" << this << ")== "
-                              << "Reusing cached pointer " << mem << "\n";
-            }
-            else
-            {
-                mem = do_allocation(bin_sizes_[bin]);
-            }
+            mem = free_data_[bin].back();
+            free_data_[bin].pop_back();
+            --num_cached_blks_;
+            bytes_cached_ -= bin_size;
+            ++hits_;
+            if (debug_)
+                std::clog << "==Mempool(" << this << ")== "
+                          << "Reusing cached pointer " << mem << "\n";
         }
-        alloc_to_bin_[mem] = bin;
+        else
+        {
+            mem = do_allocation(bin_size + header_size);
+            ++misses_;
+            bytes_allocated_ += bin_size + header_size;
+            peak_bytes_allocated_ =
+              std::max(peak_bytes_allocated_, bytes_allocated_);
+        }
+        if (account)
+        {
+            bytes_in_use_ += bin_size;
+            bytes_requested_ += size;
+        }
+        if (thread_cache_size_ == 0)
+            alloc_to_bin_[mem] = std::make_pair(bin, size);
         if (debug_)
             std::clog << "==Mempool(" << this << ")== "
-                      << alloc_to_bin_.size()
-                      << " blocks allocated; "
+                      << bytes_in_use_
+                      << " bytes in use; "
                       << num_cached_blks_
                       << " blocks cached"
                       << std::endl;
 
         return mem;
     }
-    /** Release previously allocated memory. */
-    void Free(void* ptr)
+
+    /** Release a block allocated without thread caching. */
+    void free_shared(void* ptr)
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        auto const iter = alloc_to_bin_.find(ptr);
-        if (iter == alloc_to_bin_.end())
-            details::ThrowRuntimeError("Tried to free unknown ptr");
+        size_t bin, size;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto const iter = alloc_to_bin_.find(ptr);
+            if (iter == alloc_to_bin_.end())
+                details::ThrowRuntimeError("Tried to free unknown ptr");
+            bin = iter->second.first;
+            size = iter->second.second;
+            alloc_to_bin_.erase(iter);
+        }
+        free_shared(ptr, bin, size);
+    }
 
-        size_t const& bin = iter->second;
-        alloc_to_bin_.erase(iter);
+    /** Return a block of the given bin to the shared bins. */
+    void free_shared(void* mem, size_t bin, size_t size)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        size_t const bin_size = (bin == INVALID_BIN ? size : bin_sizes_[bin]);
+        bytes_in_use_ -= bin_size;
+        bytes_requested_ -= size;
         if (bin == INVALID_BIN)
-            do_free(ptr);
+        {
+            do_free(mem);
+            bytes_allocated_ -=
+              bin_size + (thread_cache_size_ > 0 ? HEADER_SIZE : 0);
+        }
         else
         {
             // Cache the pointer for reuse.
-            free_data_[bin].push_back(ptr);
+            free_data_[bin].push_back(mem);
             ++num_cached_blks_;
+            bytes_cached_ += bin_size;
             if (debug_)
                 std::clog << "==Mempool(" << this << ")== "
-                          << "Cached pointer " << ptr << "\n";
+                          << "Cached pointer " << mem << "\n";
+            maybe_trim();
         }
         if (debug_)
             std::clog << "==Mempool(" << this << ")== "
-                      << alloc_to_bin_.size()
-                      << " blocks allocated; "
+                      << bytes_in_use_
+                      << " bytes in use; "
                       << num_cached_blks_
                       << " blocks cached"
                       << std::endl;
     }
-private:
-
-    /** Index of an invalid bin. */
-    static constexpr size_t INVALID_BIN = (size_t) -1;
 
-    /** Serialize access from multiple threads. */
-    std::mutex mutex_;
-
-    /** Size in bytes of each bin. */
-    std::vector<size_t> bin_sizes_;
-    /** Data available to allocate.
-     *  Each entry is a bin, and each bin has a vector of pointers to free
-     *  memory of that size.
+    /** Trim the shared bins to half of the high-water mark once it is
+     *  exceeded. The mutex must be held.
      */
-    std::vector<std::vector<void*>> free_data_;
-    /** Map used pointers to the associated bin index. */
-    std::unordered_map<void*, size_t> alloc_to_bin_;
-
-    /** Track the total number of available blocks. */
-    size_t num_cached_blks_;
+    void maybe_trim()
+    {
+        if (max_cached_bytes_ > 0
+            && bytes_cached_ > (long long) max_cached_bytes_)
+            trim(max_cached_bytes_ / 2);
+    }
 
-    /** Print debugging messages throughout lifetime. */
-    bool debug_;
+    /** Free cached blocks of the shared bins, largest first, until at
+     *  most max_cached_bytes remain. The mutex must be held.
+     */
+    void trim(size_t max_cached_bytes)
+    {
+        size_t const header_size = (thread_cache_size_ > 0 ? HEADER_SIZE : 0);
+        for (size_t bin = bin_sizes_.size(); bin-- > 0; )
+        {
+            auto& free_list = free_data_[bin];
+            while (free_list.size() > 0
+                   && bytes_cached_ > (long long) max_cached_bytes)
+            {
+                do_free(free_list.back());
+                free_list.pop_back();
+                --num_cached_blks_;
+                bytes_cached_ -= bin_sizes_[bin];
+                bytes_allocated_ -= bin_sizes_[bin] + header_size;
+            }
+            if (free_list.empty())
+                std::vector<void*>{}.swap(free_list);
+        }
+    }
 
     /** Release all unused memory. */
     void FreeAllUnused()
@@ -239,19 +632,28 @@ private:
     inline void do_free(void* ptr);
 
     /** Return the bin index for size. */
-    inline size_t get_bin(size_t size)
+    inline size_t get_bin(size_t size) const
     {
-        // Assuming we don't have that many bins, just do a linear search.
-        // Could optimize with binary search if need be.
-        for (size_t i = 0; i < bin_sizes_.size(); ++i)
-        {
-            if (bin_sizes_[i] >= size) return i;
-        }
-        return INVALID_BIN;
+        auto const iter =
+          std::lower_bound(bin_sizes_.begin(), bin_sizes_.end(), size);
+        if (iter == bin_sizes_.end())
+            return INVALID_BIN;
+        return iter - bin_sizes_.begin();
     }
 
 };  // class MemoryPool
 
+template <bool Pinned>
+thread_local typename MemoryPool<Pinned>::ThreadCache*
+MemoryPool<Pinned>::thread_cache_ = nullptr;
+
+template <bool Pinned>
+thread_local bool MemoryPool<Pinned>::thread_exited_ = false;
+
+template <bool Pinned>
+thread_local typename MemoryPool<Pinned>::ThreadCacheGuard
+MemoryPool<Pinned>::thread_cache_guard_;
+
 #ifdef HYDROGEN_HAVE_CUDA
 template <>
 inline void* MemoryPool<true>::do_allocation(size_t const bytes)
@@ -2,7 +2,9 @@
 #ifndef EL_CORE_PROFILING_HPP_
 #define EL_CORE_PROFILING_HPP_
 
+#include <iosfwd>
 #include <string>
+#include <vector>
 
 #include "El-lite.hpp"
 #include "hydrogen/Device.hpp"
@@ -23,6 +25,22 @@ void DisableNVProf() noexcept;
 void EnableROCTX() noexcept;
 void DisableROCTX() noexcept;
 
+/** \brief Enable or disable the built-in region statistics.
+ *
+ *  Unlike the tools above, these are always available. They are
+ *  disabled by default, and enabled at startup iff env(H_PROFILE) is
+ *  truthy (in the sense of env(H_MEMPOOL_DEBUG)). While enabled, each
+ *  profiling region accumulates its number of calls, its inclusive and
+ *  exclusive wall time, and the bytes moved by (and the time spent in)
+ *  the mpi:: wrappers called within it.
+ */
+void EnableRegionStatistics() noexcept;
+void DisableRegionStatistics() noexcept;
+bool RegionStatisticsEnabled() noexcept;
+
+/** \brief Discard the statistics accumulated so far. */
+void ResetRegionStatistics() noexcept;
+
 /** \brief A selection of colors to use with the profiling interface.
  *
  *  It seems unlikely that a user will ever need to access these by
@@ -241,6 +259,67 @@ struct SyncProfileRegion
     SyncInfo<D> si_;
 };// struct SyncProfileRegion
 
+/** \struct RegionStatistics
+ *  \brief The statistics accumulated by one region on one process.
+ *
+ *  A region entered recursively contributes one call per entry but its
+ *  inclusive quantities only once. The communication time and volume
+ *  are inclusive.
+ */
+struct RegionStatistics
+{
+    std::string name;
+    size_t calls = 0;
+    double inclusive_time = 0.;
+    double exclusive_time = 0.;
+    double comm_time = 0.;
+    size_t bytes_sent = 0;
+    size_t bytes_received = 0;
+};// struct RegionStatistics
+
+/** \brief The statistics of every region on this process.
+ *
+ *  The last entry, "[total]", covers all communication since the
+ *  statistics were enabled or reset, and its inclusive time is the
+ *  wall time elapsed since then.
+ */
+std::vector<RegionStatistics> GetRegionStatistics();
+
+/** \brief Print the statistics of this process. */
+void PrintRegionStatistics(std::ostream& os);
+
+/** \brief Print the minimum, average and maximum of the statistics
+ *      over a communicator from its root.
+ *
+ *  This is collective over the communicator, and regions that were
+ *  not entered on some processes count as zero there.
+ */
+void ReportRegionStatistics(mpi::Comm const& comm, std::ostream& os);
+
+/** \class CommunicationProfile
+ *  \brief Attribute an MPI operation to the active profiling regions.
+ *
+ *  The operation is timed from Start() until destruction; see
+ *  EL_PROFILE_COMMUNICATION.
+ */
+class CommunicationProfile
+{
+public:
+    CommunicationProfile() noexcept = default;
+    ~CommunicationProfile() noexcept;
+
+    void Start(size_t bytes_sent, size_t bytes_received) noexcept;
+
+    CommunicationProfile(CommunicationProfile const&) = delete;
+    CommunicationProfile& operator=(CommunicationProfile const&) = delete;
+
+private:
+    bool active_ = false;
+    size_t bytes_sent_ = 0;
+    size_t bytes_received_ = 0;
+    Clock::time_point start_;
+};// class CommunicationProfile
+
 template <Device D>
 auto MakeSyncProfileRegion(
     std::string desc, Color color, SyncInfo<D> si) noexcept
@@ -259,6 +338,12 @@ auto MakeSyncProfileRegion(
         MakeSyncProfileRegion(                                          \
             description, GetNextProfilingColor(), syncinfo)
 
+// The byte counts are only evaluated when the statistics are enabled
+#define EL_PROFILE_COMMUNICATION(bytes_sent, bytes_received)            \
+    ::El::CommunicationProfile comm_profiler__;                         \
+    if (::El::RegionStatisticsEnabled())                                \
+        comm_profiler__.Start(bytes_sent, bytes_received)
+
 #ifdef HYDROGEN_DEFAULT_SYNC_PROFILING
 #define AUTO_PROFILE_REGION(description, syncinfo) \
     AUTO_SYNC_PROFILE_REGION(description, syncinfo)
@@ -16,6 +16,7 @@
 #include <El/core/imports/mpi/comm.hpp>
 #include <El/core/imports/mpi/error.hpp>
 #include <El/core/imports/mpi/meta.hpp>
+#include <El/core/imports/mpi/node_comms.hpp>
 
 #include <algorithm>
 #include <functional>
@@ -828,6 +829,28 @@ void IGather
         T* rbuf, int rc, int root, Comm const& comm,
   Request<T>& request );
 
+// Non-blocking AllGather
+// ----------------------
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm const& comm,
+  Request<Real>& request );
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm const& comm,
+  Request<Complex<Real>>& request );
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IAllGather
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm const& comm,
+  Request<T>& request );
+
 // Gather with variable recv sizes
 // -------------------------------
 template <typename Real, Device D,
@@ -1354,6 +1377,43 @@ void AllReduce(T* buf, int count, Comm const& comm, SyncInfo<D> const& syncInfo)
 #undef COLLECTIVE_SIGNATURE
 #undef COLL // Collective::ALLREDUCE
 
+// Hierarchical collectives
+// ------------------------
+// When enabled, AllReduce, AllGather, Broadcast and ReduceScatter of CPU
+// data with a native MPI datatype first combine the contributions of the
+// processes on each node through a shared-memory window, so that only one
+// process per node communicates over the network. Reductions must use a
+// commutative operation. These settings must agree across processes and
+// only affect communicators which have not yet been split into nodes.
+void SetHierarchicalCollectives( bool enable );
+bool HierarchicalCollectives();
+
+// Split each node into groups of at most this many processes (e.g., one
+// group per socket), or zero for no limit
+void SetMaxRanksPerNode( int maxRanksPerNode );
+int MaxRanksPerNode();
+
+// The decomposition of comm into nodes, which is built on first use and then
+// cached by comm (and so is collective the first time it is requested)
+NodeComms& GetNodeComms( Comm const& comm );
+
+// Non-blocking in-place AllReduce
+// -------------------------------
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( Real* buf, int count, Op op, Comm const& comm, Request<Real>& request );
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( Complex<Real>* buf, int count, Op op, Comm const& comm,
+  Request<Complex<Real>>& request );
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IAllReduce
+( T* buf, int count, Op op, Comm const& comm, Request<T>& request );
+
 // ReduceScatter
 // -------------
 #define COLL Collective::REDUCESCATTER
@@ -8,12 +8,15 @@
 #include <mpi.h>
 
 #include <exception>
+#include <memory>
 
 namespace El
 {
 namespace mpi
 {
 
+class NodeComms;
+
 /** @class CommImpl
  *  @brief A resource-owning Communicator wrapper.
  *
@@ -97,6 +100,13 @@ public:
      */
     MPI_Comm GetMPIComm() const EL_NO_EXCEPT { return comm_; };
 
+    /** @brief The cached decomposition of the communicator into nodes.
+     *
+     *  This is empty until first requested through GetNodeComms().
+     */
+    std::shared_ptr<NodeComms>& CachedNodeComms() const EL_NO_EXCEPT
+    { return nodeComms_; }
+
     ///@}
     /** @name Modifiers */
     ///@{
@@ -180,6 +190,9 @@ private:
     /** @brief The raw MPI handle. */
     MPI_Comm comm_ = MPI_COMM_NULL;
 
+    /** @brief The intra- and inter-node communicators split from comm_. */
+    mutable std::shared_ptr<NodeComms> nodeComms_;
+
 };// class CommImpl
 
 
@@ -203,6 +216,7 @@ CommImpl<SpecificCommImpl>::CommImpl(
     // derived type data at all.
     comm_ = other.comm_;
     other.comm_ = MPI_COMM_NULL;
+    nodeComms_ = std::move(other.nodeComms_);
 }
 
 
@@ -217,6 +231,8 @@ CommImpl<SpecificCommImpl>::operator=(
     // Take the new MPI_Comm and reset other to null
     comm_ = other.comm_;
     other.comm_ = MPI_COMM_NULL;
+    nodeComms_ = std::move(other.nodeComms_);
+    return *this;
 }
 
 
@@ -313,6 +329,7 @@ void CommImpl<SpecificCommImpl>::Swap(
     static_cast<SpecificCommImpl*>(this)->DoSwap(
         static_cast<SpecificCommImpl&>(other));
     std::swap(comm_, other.comm_);
+    std::swap(nodeComms_, other.nodeComms_);
 }
 
 
@@ -341,6 +358,7 @@ void CommImpl<SpecificCommImpl>::SafeDuplicateMPIComm_(MPI_Comm src_comm)
 template <typename SpecificCommImpl>
 void CommImpl<SpecificCommImpl>::FreeAndResetInternalComm_()
 {
+    nodeComms_.reset();
     int finalized;
     MPI_Finalized(&finalized);
     if (!finalized
@@ -0,0 +1,110 @@
+#pragma once
+#ifndef EL_IMPORTS_MPI_NODE_COMMS_HPP_
+#define EL_IMPORTS_MPI_NODE_COMMS_HPP_
+
+#include <El/config.h>
+
+#include <mpi.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace El
+{
+namespace mpi
+{
+
+/** @class NodeComms
+ *  @brief The decomposition of a communicator into nodes.
+ *
+ *  The processes of a communicator which share memory (optionally split
+ *  further into groups of at most MaxRanksPerNode() processes) form a
+ *  "node" with an intra-node communicator. The lowest-ranked process of
+ *  each node is its leader, and the leaders share an inter-node
+ *  communicator in which the rank of each leader is the index of its node.
+ *
+ *  Each node also owns a scratch buffer in an MPI-3 shared-memory window,
+ *  which is how the hierarchical collectives combine the contributions of
+ *  a node without any intra-node messages.
+ *
+ *  The decomposition is built on first use and cached by the Comm (see
+ *  GetNodeComms), so construction is collective over the communicator.
+ */
+class NodeComms
+{
+public:
+    NodeComms(MPI_Comm comm, int maxRanksPerNode);
+    ~NodeComms();
+
+    NodeComms(NodeComms const&) = delete;
+    NodeComms& operator=(NodeComms const&) = delete;
+
+    /** @brief The processes of this node, ordered by their rank in the
+     *         original communicator.
+     */
+    MPI_Comm IntraComm() const EL_NO_EXCEPT { return intraComm_; }
+    /** @brief The node leaders (MPI_COMM_NULL on all other processes). */
+    MPI_Comm InterComm() const EL_NO_EXCEPT { return interComm_; }
+
+    int NumNodes() const EL_NO_EXCEPT { return int(nodeOffsets_.size())-1; }
+    int Node() const EL_NO_EXCEPT { return node_; }
+    int NodeRank() const EL_NO_EXCEPT { return nodeRank_; }
+    int NodeSize() const EL_NO_EXCEPT { return nodeSize_; }
+    int MaxNodeSize() const EL_NO_EXCEPT { return maxNodeSize_; }
+    bool Leader() const EL_NO_EXCEPT { return nodeRank_ == 0; }
+
+    /** @brief The node of each rank of the original communicator. */
+    std::vector<int> const& NodeOf() const EL_NO_EXCEPT { return nodeOf_; }
+    /** @brief The index of each rank of the original communicator when the
+     *         ranks are sorted by node and then by rank within the node.
+     */
+    std::vector<int> const& Position() const EL_NO_EXCEPT
+    { return position_; }
+    /** @brief The position of the first rank of each node, followed by the
+     *         size of the communicator.
+     */
+    std::vector<int> const& NodeOffsets() const EL_NO_EXCEPT
+    { return nodeOffsets_; }
+
+    /** @brief A scratch buffer of at least numBytes bytes which is shared by
+     *         every process of this node.
+     *
+     *  Collective over the node: every process must request the same size,
+     *  and the buffer is reallocated (invalidating previous pointers) if it
+     *  is too small.
+     */
+    void* SharedBuffer(size_t numBytes);
+
+    /** @brief Wait for every process of the node, ensuring that the writes
+     *         of each process to the shared buffer are visible to all.
+     */
+    void Barrier() const;
+
+    /** @brief Allocate numBytes bytes which are shared by every process of
+     *         this node in a new window.
+     *
+     *  Collective over the node: every process must request the same size
+     *  and later free the window with FreeSharedWindow.
+     */
+    void* AllocateShared(size_t numBytes, MPI_Win& window) const;
+    static void FreeSharedWindow(MPI_Win& window);
+
+    /** @brief As Barrier(), but for the buffer of the given window. */
+    void Barrier(MPI_Win window) const;
+
+private:
+    void FreeWindow_();
+
+    MPI_Comm intraComm_ = MPI_COMM_NULL;
+    MPI_Comm interComm_ = MPI_COMM_NULL;
+    int node_, nodeRank_, nodeSize_, maxNodeSize_;
+    std::vector<int> nodeOf_, position_, nodeOffsets_;
+
+    MPI_Win window_ = MPI_WIN_NULL;
+    void* sharedBuffer_ = nullptr;
+    size_t sharedBytes_ = 0;
+};// class NodeComms
+
+}// namespace mpi
+}// namespace El
+#endif /* EL_IMPORTS_MPI_NODE_COMMS_HPP_ */
@@ -112,7 +112,43 @@ F SampleBall( const F& center=F(0), const Base<F>& radius=Base<F>(1) );
 template<typename Real,typename=EnableIf<IsReal<Real>>>
 Real SampleBall( const Real& center=Real(0), const Real& radius=Real(1) );
 
+// Counter-based random number generation
+// ======================================
+// Philox4x32-10 (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3")
+// maps a 64-bit key and a 128-bit counter to four independent 32-bit words.
+// The generator has no state, so entry (i,j) of a random matrix can be drawn
+// from the counter (i,j) without drawing any of the entries before it.
+class Philox4x32
+{
+public:
+    explicit Philox4x32( std::uint64_t key ) EL_NO_EXCEPT;
+    std::array<std::uint32_t,4>
+    operator()( std::uint64_t i, std::uint64_t j ) const EL_NO_EXCEPT;
+private:
+    std::uint32_t key_[2];
+};
+
+// When enabled (the default), the Gaussian, Uniform, Bernoulli, ThreeValued
+// and Rademacher fills of Int, float, double, Complex<float>, and
+// Complex<double> matrices on the CPU draw entry (i,j) from Philox4x32 with
+// the global indices (i,j) as the counter. Distributed matrices are then
+// independent of the process grid and of the number of threads, are filled in
+// parallel, and need no communication. Local matrices also mix the rank into
+// the key so that each process draws an independent matrix.
+//
+// The key of each fill is derived from the seed and the number of previous
+// fills, so the processes viewing a distributed matrix must have performed
+// the same sequence of distributed fills.
+void SetCounterBasedRandom( bool counterBased );
+bool CounterBasedRandom();
+
+// Reseed the counter-based generator and restart its sequence of fills
+void SetCounterBasedSeed( std::uint64_t seed );
+std::uint64_t CounterBasedSeed();
+
 // To be used internally by Elemental
+// Return the key of the next distributed (or, otherwise, local) fill
+std::uint64_t NextCounterBasedKey( bool distributed );
 void InitializeRandom( bool deterministic=true );
 void FinalizeRandom();
 
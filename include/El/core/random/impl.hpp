@@ -230,6 +230,36 @@ template<typename Real,typename>
 Real SampleBall( const Real& center, const Real& radius )
 { return SampleUniform(Real(center-radius),Real(center+radius)); }
 
+inline Philox4x32::Philox4x32( std::uint64_t key ) EL_NO_EXCEPT
+{
+    key_[0] = std::uint32_t(key);
+    key_[1] = std::uint32_t(key >> 32);
+}
+
+inline std::array<std::uint32_t,4>
+Philox4x32::operator()( std::uint64_t i, std::uint64_t j ) const EL_NO_EXCEPT
+{
+    const std::uint64_t M0 = 0xD2511F53, M1 = 0xCD9E8D57;
+    const std::uint32_t W0 = 0x9E3779B9, W1 = 0xBB67AE85;
+
+    std::uint32_t c0 = std::uint32_t(i), c1 = std::uint32_t(i >> 32),
+                  c2 = std::uint32_t(j), c3 = std::uint32_t(j >> 32);
+    std::uint32_t k0 = key_[0], k1 = key_[1];
+    for( int round=0; round<10; ++round )
+    {
+        const std::uint64_t p0 = M0*c0, p1 = M1*c2;
+        const std::uint32_t hi0 = std::uint32_t(p0 >> 32),
+                            hi1 = std::uint32_t(p1 >> 32);
+        c0 = hi1 ^ c1 ^ k0;
+        c1 = std::uint32_t(p1);
+        c2 = hi0 ^ c3 ^ k1;
+        c3 = std::uint32_t(p0);
+        k0 += W0;
+        k1 += W1;
+    }
+    return {{c0,c1,c2,c3}};
+}
+
 } // namespace El
 
 #endif // ifndef EL_RANDOM_IMPL_HPP
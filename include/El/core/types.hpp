@@ -382,7 +382,7 @@ enum ViewType
     VIEW = 0x1,
     OWNER_FIXED = 0x2,
     VIEW_FIXED = 0x3,
-    LOCKED_OWNER = 0x4, // unused
+    LOCKED_OWNER = 0x4, // read-only file mappings
     LOCKED_VIEW = 0x5,
     LOCKED_OWNER_FIXED = 0x6, // unused
     LOCKED_VIEW_FIXED = 0x7
@@ -101,6 +101,37 @@ void Write
 ( const AbstractDistMatrix<T>& A, string basename="DistMatrix",
   FileFormat format=BINARY, string title="" );
 
+// Out-of-core
+// ===========
+// Routines which operate on matrices held in BINARY files that need not fit
+// in the aggregate memory of the grid. Tiles are streamed through memory,
+// with the reads of the next tile(s) and the writes of the previous one
+// performed on a background thread while the current tile is processed.
+
+struct OutOfCoreCtrl
+{
+    // The number of bytes that each process may devote to tiles
+    size_t memoryBudget=size_t(1)<<30;
+    // If positive, overrides the tile size derived from the memory budget
+    Int tileSize=0;
+    bool progress=false;
+};
+
+// C := alpha op(A) op(B) + beta C, where C is created if beta is zero
+template<typename T>
+void OutOfCoreGemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const string& AFilename, const string& BFilename,
+  T beta, const string& CFilename,
+  const Grid& g, const OutOfCoreCtrl& ctrl=OutOfCoreCtrl() );
+
+// Overwrite the lower triangle of the Hermitian positive-definite matrix in
+// the file with its Cholesky factor
+template<typename F>
+void OutOfCoreCholesky
+( UpperOrLower uplo, const string& filename,
+  const Grid& g, const OutOfCoreCtrl& ctrl=OutOfCoreCtrl() );
+
 } // namespace El
 
 #ifdef EL_HAVE_QT5
@@ -107,6 +107,12 @@ struct HermitianTridiagCtrl
     HermitianTridiagApproach approach=HERMITIAN_TRIDIAG_SQUARE;
     GridOrder order=ROW_MAJOR;
     SymvCtrl<Field> symvCtrl;
+
+    // Reduce first to a band via Gemm-rich blocked reflectors and then to
+    // tridiagonal form by chasing bulges (currently only for Matrix)
+    bool twoStage=false;
+    // The half-bandwidth of the intermediate band; zero selects Blocksize()
+    Int bandwidth=0;
 };
 
 template<typename Field>
@@ -125,6 +131,10 @@ template<typename Field>
 void ExplicitCondensed( UpperOrLower uplo, Matrix<Field>& A );
 template<typename Field>
 void ExplicitCondensed
+( UpperOrLower uplo, Matrix<Field>& A,
+  const HermitianTridiagCtrl<Field>& ctrl );
+template<typename Field>
+void ExplicitCondensed
 ( UpperOrLower uplo, AbstractDistMatrix<Field>& A,
   const HermitianTridiagCtrl<Field>& ctrl=HermitianTridiagCtrl<Field>() );
 
@@ -141,6 +151,35 @@ void ApplyQ
   const AbstractDistMatrix<Field>& householderScalars,
         AbstractDistMatrix<Field>& B );
 
+// The two-stage reduction, T = G2 G1 A G1^H G2^H, where G1 reduces A to a
+// band of half-bandwidth 'bandwidth' and G2 chases the band down to
+// tridiagonal form. The reflectors of G1 are packed beneath the band of A
+// (with their scalars in householderScalars), while those of G2 are stored
+// explicitly, one per column of chaseReflectors. A bandwidth of one yields
+// the one-stage reduction.
+template<typename Field>
+struct TwoStageReflectors
+{
+    Int bandwidth=1;
+    Matrix<Field> householderScalars;
+    Matrix<Field> chaseReflectors;
+    Matrix<Field> chaseScalars;
+};
+
+template<typename Field>
+void TwoStage
+( UpperOrLower uplo,
+  Matrix<Field>& A,
+  TwoStageReflectors<Field>& reflectors,
+  Int bandwidth=0 );
+
+template<typename Field>
+void ApplyQ
+( LeftOrRight side, UpperOrLower uplo, Orientation orientation,
+  const Matrix<Field>& A,
+  const TwoStageReflectors<Field>& reflectors,
+        Matrix<Field>& B );
+
 } // namespace herm_tridiag
 
 // Hessenberg
@@ -158,6 +197,10 @@ namespace hessenberg {
 template<typename Field>
 void ExplicitCondensed( UpperOrLower uplo, Matrix<Field>& A );
 template<typename Field>
+void ExplicitCondensed
+( UpperOrLower uplo, Matrix<Field>& A,
+  const HermitianTridiagCtrl<Field>& ctrl );
+template<typename Field>
 void ExplicitCondensed( UpperOrLower uplo, AbstractDistMatrix<Field>& A );
 
 template<typename Field>
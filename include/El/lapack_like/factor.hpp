@@ -26,6 +26,13 @@ void Cholesky
 template<typename Field, Device D>
 void Cholesky( UpperOrLower uplo, DistMatrix<Field,STAR,STAR,ELEMENT,D>& A );
 
+// The number of block columns of the trailing matrix that the distributed
+// lower Cholesky factorization updates before factoring the next panel;
+// the rest of each trailing update is deferred until the next panel is
+// factored (and overlapped with it on GPUs). Zero disables the lookahead.
+void SetCholeskyLookahead( Int depth );
+Int CholeskyLookahead();
+
 template<typename Field>
 void ReverseCholesky( UpperOrLower uplo, Matrix<Field>& A );
 template<typename Field>
@@ -57,6 +64,28 @@ void HPSDCholesky( UpperOrLower uplo, Matrix<Field>& A );
 template<typename Field>
 void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<Field>& A );
 
+// Factor each member of a batch of small HPD matrices (see the batched
+// BLAS-like routines in level3.hpp for the four ways of addressing them).
+// A NonHPDMatrixException naming the first failing member is thrown once
+// the entire batch has been processed.
+template<typename Field>
+void CholeskyBatched
+( UpperOrLower uplo, Int n,
+  Field* const* A, Int ALDim,
+  Int batchCount );
+template<typename Field>
+void CholeskyStridedBatched
+( UpperOrLower uplo, Int n,
+  Field* A, Int ALDim, Int strideA,
+  Int batchCount );
+template<typename Field>
+void CholeskyBatched( UpperOrLower uplo, vector<Matrix<Field>>& A );
+template<typename Field>
+void CholeskyInterleavedBatched
+( UpperOrLower uplo, Int n,
+  Field* A, Int ALDim,
+  Int batchCount );
+
 namespace cholesky {
 
 template<typename Field>
@@ -169,6 +169,83 @@ void Overwrite
 
 } // namespace hpd_solve
 
+// Mixed-precision iterative refinement
+// ====================================
+// Factor A in the lower precision Demote<Field> (e.g., float for double) and
+// refine the solution in Field until the normwise backward error,
+//
+//   max_j || b_j - A x_j ||_oo / (|| A ||_oo || x_j ||_oo + || b_j ||_oo),
+//
+// is below 'relTol'. Classical iterative refinement is tried first; once it
+// stops making progress, each correction equation is instead solved with
+// GMRES preconditioned by the low-precision factors (GMRES-IR). As a last
+// resort, A is refactored in Field.
+
+template<typename Real>
+struct MixedPrecisionCtrl
+{
+    // A value of zero selects Sqrt(n) eps, as in LAPACK's [d,z]sgesv
+    Real relTol=Real(0);
+    Int maxRefineIts=30;
+    // Classical refinement is abandoned once an iteration fails to reduce the
+    // backward error by at least this factor
+    Real stagnationRatio=Real(0.5);
+
+    bool gmres=true;
+    Real gmresRelTol;
+    Int gmresRestart=30;
+    Int maxGMRESIts=100;
+
+    bool fullPrecisionFallback=true;
+    bool progress=false;
+
+    MixedPrecisionCtrl()
+    {
+        const Real eps = limits::Epsilon<Real>();
+        gmresRelTol = Pow(eps,Real(0.25));
+    }
+};
+
+template<typename Real>
+struct MixedPrecisionInfo
+{
+    // The number of classical and GMRES-based refinement steps, as well as
+    // the total number of GMRES iterations over the latter
+    Int refineIts=0;
+    Int gmresRefineIts=0;
+    Int gmresIts=0;
+
+    Real backwardError=Real(0);
+    bool converged=false;
+    bool fullPrecisionFallback=false;
+};
+
+template<typename Field>
+MixedPrecisionInfo<Base<Field>> LinearSolve
+( const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl );
+template<typename Field>
+MixedPrecisionInfo<Base<Field>> LinearSolve
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl );
+
+template<typename Field>
+MixedPrecisionInfo<Base<Field>> HPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl );
+template<typename Field>
+MixedPrecisionInfo<Base<Field>> HPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl );
+
 // Multi-shift Hessenberg
 // ======================
 template<typename Field>
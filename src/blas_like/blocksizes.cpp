@@ -15,6 +15,10 @@ using namespace El;
 
 std::stack<Int> blocksizeStack;
 
+Int gemmReplicationDepth = 0;
+
+Int redistChunkSize = Int(1) << 22;
+
 template<typename T>
 struct LocalSymvBlocksizeHelper { static Int value; };
 template<typename T>
@@ -70,6 +74,26 @@ void EmptyBlocksizeStack()
         ::blocksizeStack.pop();
 }
 
+void SetGemmReplicationDepth( Int depth )
+{
+    if( depth < 0 )
+        LogicError("Gemm replication depth must be non-negative");
+    ::gemmReplicationDepth = depth;
+}
+
+Int GemmReplicationDepth()
+{ return ::gemmReplicationDepth; }
+
+void SetRedistChunkSize( Int numEntries )
+{
+    if( numEntries < 1 )
+        LogicError("Redistribution chunk size must be positive");
+    ::redistChunkSize = numEntries;
+}
+
+Int RedistChunkSize()
+{ return ::redistChunkSize; }
+
 template<typename T>
 void SetLocalSymvBlocksize( Int blocksize )
 { LocalSymvBlocksizeHelper<T>::value = blocksize; }
@@ -0,0 +1,641 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level3.hpp>
+
+namespace El {
+
+namespace batched {
+
+// The interleaved kernels split the batch into chunks of this many matrices,
+// which are distributed over threads and then processed with SIMD
+const Int interleavedChunkSize = 128;
+
+template<bool conjugate,typename T>
+inline T MaybeConj( const T& alpha )
+{ return conjugate ? Conj(alpha) : alpha; }
+
+// C(cOff) += alpha op(X(xOff)) op(Y(yOff)) over the chunk [b0,b1) of an
+// interleaved batch, where the offsets are in units of whole matrix entries
+template<bool conjX,bool conjY,typename T>
+inline void InterleavedUpdate
+( Int b0, Int b1, Int batchCount,
+  T alpha, const T* X, Int xOff,
+           const T* Y, Int yOff,
+                 T* C, Int cOff )
+{
+    const T* XEnt = &X[xOff*batchCount];
+    const T* YEnt = &Y[yOff*batchCount];
+          T* CEnt = &C[cOff*batchCount];
+    EL_SIMD
+    for( Int b=b0; b<b1; ++b )
+        CEnt[b] += alpha*MaybeConj<conjX>(XEnt[b])*MaybeConj<conjY>(YEnt[b]);
+}
+
+// C(cOff) := beta C(cOff), where beta=0 overwrites rather than scales so
+// that NaN's in the input are not propagated (as in the BLAS)
+template<typename T>
+inline void InterleavedScale
+( Int b0, Int b1, Int batchCount, T beta, T* C, Int cOff )
+{
+    T* CEnt = &C[cOff*batchCount];
+    if( beta == T(0) )
+    {
+        EL_SIMD
+        for( Int b=b0; b<b1; ++b )
+            CEnt[b] = T(0);
+    }
+    else if( beta != T(1) )
+    {
+        EL_SIMD
+        for( Int b=b0; b<b1; ++b )
+            CEnt[b] *= beta;
+    }
+}
+
+// Run 'chunkKernel(b0,b1)' over every chunk of an interleaved batch
+template<class ChunkKernel>
+void ForEachChunk( Int batchCount, const ChunkKernel& chunkKernel )
+{
+    const Int numChunks =
+      (batchCount+interleavedChunkSize-1) / interleavedChunkSize;
+    EL_PARALLEL_FOR
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        const Int b0 = chunk*interleavedChunkSize;
+        const Int b1 = Min(b0+interleavedChunkSize,batchCount);
+        chunkKernel( b0, b1 );
+    }
+}
+
+// The offset of entry (i,j) of op(A) within A
+inline Int OrientedOffset( Orientation orient, Int i, Int j, Int ALDim )
+{ return orient == NORMAL ? i+j*ALDim : j+i*ALDim; }
+
+template<bool conjA,bool conjB,typename T>
+void GemmInterleavedChunk
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k,
+  T alpha, const T* A, Int ALDim,
+           const T* B, Int BLDim,
+                 T* C, Int CLDim,
+  Int b0, Int b1, Int batchCount )
+{
+    for( Int j=0; j<n; ++j )
+        for( Int l=0; l<k; ++l )
+        {
+            const Int BOff = OrientedOffset( orientB, l, j, BLDim );
+            for( Int i=0; i<m; ++i )
+                InterleavedUpdate<conjA,conjB>
+                ( b0, b1, batchCount,
+                  alpha, A, OrientedOffset( orientA, i, l, ALDim ),
+                         B, BOff,
+                         C, i+j*CLDim );
+        }
+}
+
+template<typename T>
+void CheckBatch( Int batchCount, Int ldim, Int height, const char* name )
+{
+    if( batchCount < 0 )
+        LogicError("Batch count was negative: ",batchCount);
+    if( ldim < Max(height,Int(1)) )
+        LogicError
+        ("Leading dimension of ",name," was ",ldim,
+         " but the height was ",height);
+}
+
+} // namespace batched
+
+// Gemm
+// ====
+template<typename T>
+void GemmBatched
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k,
+  T alpha, const T* const* A, Int ALDim,
+           const T* const* B, Int BLDim,
+  T beta,        T* const* C, Int CLDim,
+  Int batchCount )
+{
+    EL_DEBUG_CSE
+    batched::CheckBatch<T>
+    ( batchCount, ALDim, orientA==NORMAL ? m : k, "A" );
+    batched::CheckBatch<T>
+    ( batchCount, BLDim, orientB==NORMAL ? k : n, "B" );
+    batched::CheckBatch<T>( batchCount, CLDim, m, "C" );
+    const char transA = OrientationToChar( orientA );
+    const char transB = OrientationToChar( orientB );
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchCount; ++b )
+        blas::Gemm
+        ( transA, transB, m, n, k,
+          alpha, A[b], ALDim, B[b], BLDim,
+          beta,  C[b], CLDim );
+}
+
+template<typename T>
+void GemmStridedBatched
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k,
+  T alpha, const T* A, Int ALDim, Int strideA,
+           const T* B, Int BLDim, Int strideB,
+  T beta,        T* C, Int CLDim, Int strideC,
+  Int batchCount )
+{
+    EL_DEBUG_CSE
+    batched::CheckBatch<T>
+    ( batchCount, ALDim, orientA==NORMAL ? m : k, "A" );
+    batched::CheckBatch<T>
+    ( batchCount, BLDim, orientB==NORMAL ? k : n, "B" );
+    batched::CheckBatch<T>( batchCount, CLDim, m, "C" );
+    const char transA = OrientationToChar( orientA );
+    const char transB = OrientationToChar( orientB );
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchCount; ++b )
+        blas::Gemm
+        ( transA, transB, m, n, k,
+          alpha, &A[b*strideA], ALDim, &B[b*strideB], BLDim,
+          beta,  &C[b*strideC], CLDim );
+}
+
+template<typename T>
+void GemmBatched
+( Orientation orientA, Orientation orientB,
+  T alpha, const vector<Matrix<T>>& A,
+           const vector<Matrix<T>>& B,
+  T beta,        vector<Matrix<T>>& C )
+{
+    EL_DEBUG_CSE
+    const Int batchCount = A.size();
+    if( Int(B.size()) != batchCount || Int(C.size()) != batchCount )
+        LogicError("Batches of A, B, and C were of different lengths");
+    // Check every member up front since nothing may be thrown from within
+    // the threaded loop
+    for( Int b=0; b<batchCount; ++b )
+    {
+        const Int m = C[b].Height();
+        const Int n = C[b].Width();
+        const Int k = ( orientA == NORMAL ? A[b].Width() : A[b].Height() );
+        if( (orientA == NORMAL ? A[b].Height() : A[b].Width()) != m ||
+            (orientB == NORMAL ? B[b].Height() : B[b].Width()) != k ||
+            (orientB == NORMAL ? B[b].Width() : B[b].Height()) != n )
+            LogicError("Nonconformal GemmBatched at batch member ",b);
+    }
+    const char transA = OrientationToChar( orientA );
+    const char transB = OrientationToChar( orientB );
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchCount; ++b )
+    {
+        const Int k = ( orientA == NORMAL ? A[b].Width() : A[b].Height() );
+        blas::Gemm
+        ( transA, transB, C[b].Height(), C[b].Width(), k,
+          alpha, A[b].LockedBuffer(), A[b].LDim(),
+                 B[b].LockedBuffer(), B[b].LDim(),
+          beta,  C[b].Buffer(),       C[b].LDim() );
+    }
+}
+
+template<typename T>
+void GemmInterleavedBatched
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k,
+  T alpha, const T* A, Int ALDim,
+           const T* B, Int BLDim,
+  T beta,        T* C, Int CLDim,
+  Int batchCount )
+{
+    EL_DEBUG_CSE
+    batched::CheckBatch<T>
+    ( batchCount, ALDim, orientA==NORMAL ? m : k, "A" );
+    batched::CheckBatch<T>
+    ( batchCount, BLDim, orientB==NORMAL ? k : n, "B" );
+    batched::CheckBatch<T>( batchCount, CLDim, m, "C" );
+    const bool conjA = ( orientA == ADJOINT );
+    const bool conjB = ( orientB == ADJOINT );
+    batched::ForEachChunk
+    ( batchCount,
+      [&]( Int b0, Int b1 )
+      {
+          for( Int j=0; j<n; ++j )
+              for( Int i=0; i<m; ++i )
+                  batched::InterleavedScale
+                  ( b0, b1, batchCount, beta, C, i+j*CLDim );
+          if( alpha == T(0) )
+              return;
+          if( conjA && conjB )
+              batched::GemmInterleavedChunk<true,true>
+              ( orientA, orientB, m, n, k, alpha, A, ALDim, B, BLDim,
+                C, CLDim, b0, b1, batchCount );
+          else if( conjA )
+              batched::GemmInterleavedChunk<true,false>
+              ( orientA, orientB, m, n, k, alpha, A, ALDim, B, BLDim,
+                C, CLDim, b0, b1, batchCount );
+          else if( conjB )
+              batched::GemmInterleavedChunk<false,true>
+              ( orientA, orientB, m, n, k, alpha, A, ALDim, B, BLDim,
+                C, CLDim, b0, b1, batchCount );
+          else
+              batched::GemmInterleavedChunk<false,false>
+              ( orientA, orientB, m, n, k, alpha, A, ALDim, B, BLDim,
+                C, CLDim, b0, b1, batchCount );
+      });
+}
+
+// Herk
+// ====
+template<typename T>
+void HerkBatched
+( UpperOrLower uplo, Orientation orientation,
+  Int n, Int k,
+  Base<T> alpha, const T* const* A, Int ALDim,
+  Base<T> beta,        T* const* C, Int CLDim,
+  Int batchCount )
+{
+    EL_DEBUG_CSE
+    batched::CheckBatch<T>
+    ( batchCount, ALDim, orientation==NORMAL ? n : k, "A" );
+    batched::CheckBatch<T>( batchCount, CLDim, n, "C" );
+    const char uploChar = UpperOrLowerToChar( uplo );
+    const char trans = OrientationToChar( orientation );
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchCount; ++b )
+        blas::Herk
+        ( uploChar, trans, n, k,
+          alpha, A[b], ALDim,
+          beta,  C[b], CLDim );
+}
+
+template<typename T>
+void HerkStridedBatched
+( UpperOrLower uplo, Orientation orientation,
+  Int n, Int k,
+  Base<T> alpha, const T* A, Int ALDim, Int strideA,
+  Base<T> beta,        T* C, Int CLDim, Int strideC,
+  Int batchCount )
+{
+    EL_DEBUG_CSE
+    batched::CheckBatch<T>
+    ( batchCount, ALDim, orientation==NORMAL ? n : k, "A" );
+    batched::CheckBatch<T>( batchCount, CLDim, n, "C" );
+    const char uploChar = UpperOrLowerToChar( uplo );
+    const char trans = OrientationToChar( orientation );
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchCount; ++b )
+        blas::Herk
+        ( uploChar, trans, n, k,
+          alpha, &A[b*strideA], ALDim,
+          beta,  &C[b*strideC], CLDim );
+}
+
+template<typename T>
+void HerkBatched
+( UpperOrLower uplo, Orientation orientation,
+  Base<T> alpha, const vector<Matrix<T>>& A,
+  Base<T> beta,        vector<Matrix<T>>& C )
+{
+    EL_DEBUG_CSE
+    const Int batchCount = A.size();
+    if( Int(C.size()) != batchCount )
+        LogicError("Batches of A and C were of different lengths");
+    for( Int b=0; b<batchCount; ++b )
+    {
+        const Int n = ( orientation == NORMAL ? A[b].Height() : A[b].Width() );
+        if( C[b].Height() != n || C[b].Width() != n )
+            LogicError("Nonconformal HerkBatched at batch member ",b);
+    }
+    const char uploChar = UpperOrLowerToChar( uplo );
+    const char trans = OrientationToChar( orientation );
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchCount; ++b )
+    {
+        const Int k = ( orientation == NORMAL ? A[b].Width() : A[b].Height() );
+        blas::Herk
+        ( uploChar, trans, C[b].Height(), k,
+          alpha, A[b].LockedBuffer(), A[b].LDim(),
+          beta,  C[b].Buffer(),       C[b].LDim() );
+    }
+}
+
+template<typename T>
+void HerkInterleavedBatched
+( UpperOrLower uplo, Orientation orientation,
+  Int n, Int k,
+  Base<T> alpha, const T* A, Int ALDim,
+  Base<T> beta,        T* C, Int CLDim,
+  Int batchCount )
+{
+    EL_DEBUG_CSE
+    batched::CheckBatch<T>
+    ( batchCount, ALDim, orientation==NORMAL ? n : k, "A" );
+    batched::CheckBatch<T>( batchCount, CLDim, n, "C" );
+    // C(i,j) += alpha sum_l op(A)(i,l) conj(op(A)(j,l)), where the
+    // conjugation falls on the left factor when op(A) = A^H
+    const Orientation orientRight =
+      ( orientation == NORMAL ? NORMAL : ADJOINT );
+    batched::ForEachChunk
+    ( batchCount,
+      [&]( Int b0, Int b1 )
+      {
+          for( Int j=0; j<n; ++j )
+          {
+              const Int iBeg = ( uplo == LOWER ? j : 0 );
+              const Int iEnd = ( uplo == LOWER ? n : j+1 );
+              for( Int i=iBeg; i<iEnd; ++i )
+                  batched::InterleavedScale
+                  ( b0, b1, batchCount, T(beta), C, i+j*CLDim );
+              if( alpha != Base<T>(0) )
+              {
+                  for( Int l=0; l<k; ++l )
+                  {
+                      const Int AjOff =
+                        batched::OrientedOffset( orientRight, j, l, ALDim );
+                      for( Int i=iBeg; i<iEnd; ++i )
+                      {
+                          const Int AiOff =
+                            batched::OrientedOffset
+                            ( orientRight, i, l, ALDim );
+                          if( orientation == NORMAL )
+                              batched::InterleavedUpdate<false,true>
+                              ( b0, b1, batchCount, T(alpha),
+                                A, AiOff, A, AjOff, C, i+j*CLDim );
+                          else
+                              batched::InterleavedUpdate<true,false>
+                              ( b0, b1, batchCount, T(alpha),
+                                A, AiOff, A, AjOff, C, i+j*CLDim );
+                      }
+                  }
+              }
+              // The diagonal of a Hermitian matrix is real
+              T* CDiag = &C[(j+j*CLDim)*batchCount];
+              EL_SIMD
+              for( Int b=b0; b<b1; ++b )
+                  CDiag[b] = RealPart(CDiag[b]);
+          }
+      });
+}
+
+// Trsm
+// ====
+template<typename F>
+void TrsmBatched
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  Int m, Int n,
+  F alpha, const F* const* A, Int ALDim,
+                 F* const* B, Int BLDim,
+  Int batchCount )
+{
+    EL_DEBUG_CSE
+    batched::CheckBatch<F>( batchCount, ALDim, side==LEFT ? m : n, "A" );
+    batched::CheckBatch<F>( batchCount, BLDim, m, "B" );
+    const char sideChar = LeftOrRightToChar( side );
+    const char uploChar = UpperOrLowerToChar( uplo );
+    const char trans = OrientationToChar( orientation );
+    const char diagChar = UnitOrNonUnitToChar( diag );
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchCount; ++b )
+        blas::Trsm
+        ( sideChar, uploChar, trans, diagChar, m, n,
+          alpha, A[b], ALDim, B[b], BLDim );
+}
+
+template<typename F>
+void TrsmStridedBatched
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  Int m, Int n,
+  F alpha, const F* A, Int ALDim, Int strideA,
+                 F* B, Int BLDim, Int strideB,
+  Int batchCount )
+{
+    EL_DEBUG_CSE
+    batched::CheckBatch<F>( batchCount, ALDim, side==LEFT ? m : n, "A" );
+    batched::CheckBatch<F>( batchCount, BLDim, m, "B" );
+    const char sideChar = LeftOrRightToChar( side );
+    const char uploChar = UpperOrLowerToChar( uplo );
+    const char trans = OrientationToChar( orientation );
+    const char diagChar = UnitOrNonUnitToChar( diag );
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchCount; ++b )
+        blas::Trsm
+        ( sideChar, uploChar, trans, diagChar, m, n,
+          alpha, &A[b*strideA], ALDim, &B[b*strideB], BLDim );
+}
+
+template<typename F>
+void TrsmBatched
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const vector<Matrix<F>>& A,
+                 vector<Matrix<F>>& B )
+{
+    EL_DEBUG_CSE
+    const Int batchCount = A.size();
+    if( Int(B.size()) != batchCount )
+        LogicError("Batches of A and B were of different lengths");
+    for( Int b=0; b<batchCount; ++b )
+    {
+        const Int order = ( side == LEFT ? B[b].Height() : B[b].Width() );
+        if( A[b].Height() != order || A[b].Width() != order )
+            LogicError("Nonconformal TrsmBatched at batch member ",b);
+    }
+    const char sideChar = LeftOrRightToChar( side );
+    const char uploChar = UpperOrLowerToChar( uplo );
+    const char trans = OrientationToChar( orientation );
+    const char diagChar = UnitOrNonUnitToChar( diag );
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchCount; ++b )
+        blas::Trsm
+        ( sideChar, uploChar, trans, diagChar,
+          B[b].Height(), B[b].Width(),
+          alpha, A[b].LockedBuffer(), A[b].LDim(),
+                 B[b].Buffer(),       B[b].LDim() );
+}
+
+namespace batched {
+
+// Solve op(A) X = B (LEFT) or X op(A) = B (RIGHT) over a chunk of an
+// interleaved batch, where op(A) is lower triangular if 'lower'
+template<bool conjA,typename F>
+void TrsmInterleavedChunk
+( LeftOrRight side, bool lower,
+  Orientation orientation, UnitOrNonUnit diag,
+  Int m, Int n,
+  const F* A, Int ALDim,
+        F* B, Int BLDim,
+  Int b0, Int b1, Int batchCount )
+{
+    auto divide = [&]( Int BOff, Int AOff )
+    {
+        const F* AEnt = &A[AOff*batchCount];
+              F* BEnt = &B[BOff*batchCount];
+        EL_SIMD
+        for( Int b=b0; b<b1; ++b )
+            BEnt[b] /= MaybeConj<conjA>(AEnt[b]);
+    };
+    if( side == LEFT )
+    {
+        for( Int j=0; j<n; ++j )
+        {
+            for( Int step=0; step<m; ++step )
+            {
+                const Int i = ( lower ? step : m-1-step );
+                if( diag == NON_UNIT )
+                    divide( i+j*BLDim, OrientedOffset(orientation,i,i,ALDim) );
+                const Int rBeg = ( lower ? i+1 : 0 );
+                const Int rEnd = ( lower ? m : i );
+                for( Int r=rBeg; r<rEnd; ++r )
+                    InterleavedUpdate<conjA,false>
+                    ( b0, b1, batchCount,
+                      F(-1), A, OrientedOffset(orientation,r,i,ALDim),
+                             B, i+j*BLDim,
+                             B, r+j*BLDim );
+            }
+        }
+    }
+    else
+    {
+        for( Int step=0; step<n; ++step )
+        {
+            const Int j = ( lower ? n-1-step : step );
+            for( Int i=0; i<m; ++i )
+                if( diag == NON_UNIT )
+                    divide( i+j*BLDim, OrientedOffset(orientation,j,j,ALDim) );
+            const Int rBeg = ( lower ? 0 : j+1 );
+            const Int rEnd = ( lower ? j : n );
+            for( Int r=rBeg; r<rEnd; ++r )
+            {
+                const Int AOff = OrientedOffset( orientation, j, r, ALDim );
+                for( Int i=0; i<m; ++i )
+                    InterleavedUpdate<false,conjA>
+                    ( b0, b1, batchCount,
+                      F(-1), B, i+j*BLDim,
+                             A, AOff,
+                             B, i+r*BLDim );
+            }
+        }
+    }
+}
+
+} // namespace batched
+
+template<typename F>
+void TrsmInterleavedBatched
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  Int m, Int n,
+  F alpha, const F* A, Int ALDim,
+                 F* B, Int BLDim,
+  Int batchCount )
+{
+    EL_DEBUG_CSE
+    batched::CheckBatch<F>( batchCount, ALDim, side==LEFT ? m : n, "A" );
+    batched::CheckBatch<F>( batchCount, BLDim, m, "B" );
+    // Transposition swaps the triangle that op(A) occupies
+    const bool lower = ( (uplo == LOWER) == (orientation == NORMAL) );
+    batched::ForEachChunk
+    ( batchCount,
+      [&]( Int b0, Int b1 )
+      {
+          for( Int j=0; j<n; ++j )
+              for( Int i=0; i<m; ++i )
+                  batched::InterleavedScale
+                  ( b0, b1, batchCount, alpha, B, i+j*BLDim );
+          if( orientation == ADJOINT )
+              batched::TrsmInterleavedChunk<true>
+              ( side, lower, orientation, diag, m, n, A, ALDim, B, BLDim,
+                b0, b1, batchCount );
+          else
+              batched::TrsmInterleavedChunk<false>
+              ( side, lower, orientation, diag, m, n, A, ALDim, B, BLDim,
+                b0, b1, batchCount );
+      });
+}
+
+#define PROTO(T) \
+  template void GemmBatched \
+  ( Orientation orientA, Orientation orientB, \
+    Int m, Int n, Int k, \
+    T alpha, const T* const* A, Int ALDim, \
+             const T* const* B, Int BLDim, \
+    T beta,        T* const* C, Int CLDim, \
+    Int batchCount ); \
+  template void GemmStridedBatched \
+  ( Orientation orientA, Orientation orientB, \
+    Int m, Int n, Int k, \
+    T alpha, const T* A, Int ALDim, Int strideA, \
+             const T* B, Int BLDim, Int strideB, \
+    T beta,        T* C, Int CLDim, Int strideC, \
+    Int batchCount ); \
+  template void GemmBatched \
+  ( Orientation orientA, Orientation orientB, \
+    T alpha, const vector<Matrix<T>>& A, \
+             const vector<Matrix<T>>& B, \
+    T beta,        vector<Matrix<T>>& C ); \
+  template void GemmInterleavedBatched \
+  ( Orientation orientA, Orientation orientB, \
+    Int m, Int n, Int k, \
+    T alpha, const T* A, Int ALDim, \
+             const T* B, Int BLDim, \
+    T beta,        T* C, Int CLDim, \
+    Int batchCount ); \
+  template void HerkBatched \
+  ( UpperOrLower uplo, Orientation orientation, \
+    Int n, Int k, \
+    Base<T> alpha, const T* const* A, Int ALDim, \
+    Base<T> beta,        T* const* C, Int CLDim, \
+    Int batchCount ); \
+  template void HerkStridedBatched \
+  ( UpperOrLower uplo, Orientation orientation, \
+    Int n, Int k, \
+    Base<T> alpha, const T* A, Int ALDim, Int strideA, \
+    Base<T> beta,        T* C, Int CLDim, Int strideC, \
+    Int batchCount ); \
+  template void HerkBatched \
+  ( UpperOrLower uplo, Orientation orientation, \
+    Base<T> alpha, const vector<Matrix<T>>& A, \
+    Base<T> beta,        vector<Matrix<T>>& C ); \
+  template void HerkInterleavedBatched \
+  ( UpperOrLower uplo, Orientation orientation, \
+    Int n, Int k, \
+    Base<T> alpha, const T* A, Int ALDim, \
+    Base<T> beta,        T* C, Int CLDim, \
+    Int batchCount ); \
+  template void TrsmBatched \
+  ( LeftOrRight side, UpperOrLower uplo, \
+    Orientation orientation, UnitOrNonUnit diag, \
+    Int m, Int n, \
+    T alpha, const T* const* A, Int ALDim, \
+                   T* const* B, Int BLDim, \
+    Int batchCount ); \
+  template void TrsmStridedBatched \
+  ( LeftOrRight side, UpperOrLower uplo, \
+    Orientation orientation, UnitOrNonUnit diag, \
+    Int m, Int n, \
+    T alpha, const T* A, Int ALDim, Int strideA, \
+                   T* B, Int BLDim, Int strideB, \
+    Int batchCount ); \
+  template void TrsmBatched \
+  ( LeftOrRight side, UpperOrLower uplo, \
+    Orientation orientation, UnitOrNonUnit diag, \
+    T alpha, const vector<Matrix<T>>& A, \
+                   vector<Matrix<T>>& B ); \
+  template void TrsmInterleavedBatched \
+  ( LeftOrRight side, UpperOrLower uplo, \
+    Orientation orientation, UnitOrNonUnit diag, \
+    Int m, Int n, \
+    T alpha, const T* A, Int ALDim, \
+                   T* B, Int BLDim, \
+    Int batchCount );
+
+#define EL_NO_INT_PROTO
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -89,6 +89,8 @@ GetSyncInfoPool(El::Grid const& g)
 }// namespace <anon>
 #endif // HYDROGEN_HAVE_MS_GEMM
 
+#include "./Gemm/Pipelined.hpp"
+#include "./Gemm/SUMMA3D.hpp"
 #include "./Gemm/NN.hpp"
 #include "./Gemm/NT.hpp"
 #include "./Gemm/TN.hpp"
@@ -187,6 +189,29 @@ void Gemm_impl(
 
 #endif // HYDROGEN_HAVE_GPU
 
+// Returns the tuning table's decision for a distributed Gemm, autotuning
+// the problem's bucket first if requested. GEMM_DEFAULT means that the
+// historical heuristic should be used.
+template <typename T>
+GemmTuningEntry TunedGemm(
+    Orientation orientA, Orientation orientB,
+    AbstractDistMatrix<T> const& A, AbstractDistMatrix<T> const& C)
+{
+    const Grid& g = C.Grid();
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int k = (orientA == NORMAL ? A.Width() : A.Height());
+    const GemmTuningKey key = MakeGemmTuningKey(
+        g, TypeName<T>(), C.GetLocalDevice(), orientA, orientB, m, n, k);
+
+    GemmTuningEntry entry;
+    if (!GetGemmTuning(key, entry)
+        && GemmAutotuning() && g.InGrid() && m*n*k > 0)
+        entry = TuneGemm<T>(
+            orientA, orientB, m, n, k, g, C.GetLocalDevice());
+    return entry;
+}
+
 }// namespace <anon>
 
 template<typename T, Device D, typename>
@@ -280,25 +305,48 @@ void Gemm
 {
     EL_DEBUG_CSE;
     Scale(beta, C);
-    if(orientA == NORMAL && orientB == NORMAL)
+
+    // Let the tuning table override the heuristic of GEMM_DEFAULT
+    GemmHeuristicCtrl ctrl = GemmHeuristics();
+    Int blocksize = 0;
+    if(alg == GEMM_DEFAULT)
+    {
+        const GemmTuningEntry entry = TunedGemm(orientA, orientB, A, C);
+        alg = entry.alg;
+        if(alg == GEMM_SUMMA_DOT && entry.blocksize > 0)
+            ctrl.blocksizeDot = entry.blocksize;
+        else
+            blocksize = entry.blocksize;
+    }
+    if(blocksize > 0)
+        PushBlocksizeStack(blocksize);
+
+    if(alg == GEMM_SUMMA_3D)
+    {
+        gemm::SUMMA3D(orientA, orientB, alpha, A, B, C);
+    }
+    else if(orientA == NORMAL && orientB == NORMAL)
     {
         if(alg == GEMM_CANNON)
             gemm::Cannon_NN(alpha, A, B, C);
         else
-            gemm::SUMMA_NN(alpha, A, B, C, alg);
+            gemm::SUMMA_NN(alpha, A, B, C, alg, ctrl);
     }
     else if(orientA == NORMAL)
     {
-        gemm::SUMMA_NT(orientB, alpha, A, B, C, alg);
+        gemm::SUMMA_NT(orientB, alpha, A, B, C, alg, ctrl);
     }
     else if(orientB == NORMAL)
     {
-        gemm::SUMMA_TN(orientA, alpha, A, B, C, alg);
+        gemm::SUMMA_TN(orientA, alpha, A, B, C, alg, ctrl);
     }
     else
     {
-        gemm::SUMMA_TT(orientA, orientB, alpha, A, B, C, alg);
+        gemm::SUMMA_TT(orientA, orientB, alpha, A, B, C, alg, ctrl);
     }
+
+    if(blocksize > 0)
+        PopBlocksizeStack();
 }
 
 template<typename T>
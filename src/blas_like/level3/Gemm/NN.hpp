@@ -553,7 +553,8 @@ void SUMMA_NN(
     AbstractDistMatrix<T> const& A,
     AbstractDistMatrix<T> const& B,
     AbstractDistMatrix<T>& C,
-    GemmAlgorithm alg=GEMM_DEFAULT)
+    GemmAlgorithm alg=GEMM_DEFAULT,
+    const GemmHeuristicCtrl& ctrl=GemmHeuristics())
 {
     EL_DEBUG_CSE;
     EL_DEBUG_ONLY(
@@ -571,13 +572,11 @@ void SUMMA_NN(
     const Int m = C.Height();
     const Int n = C.Width();
     const Int sumDim = A.Width();
-    const double weightTowardsC = 2.;
-    const double weightAwayFromDot = 10.;
+    const double weightTowardsC = ctrl.weightTowardsC;
+    const double weightAwayFromDot = ctrl.weightAwayFromDot;
+    const Int blockSizeDot = ctrl.blocksizeDot;
 
-    // TODO(poulson): Make this tunable
-    const Int blockSizeDot = 2000;
-
-    // Until a real profile-based heuristic is derived, we will use
+    // Problems without an entry in the tuning table (see TuneGemm) use
     // the historical heuristic. If multiple streams are available, we
     // will use the multistream versions.
     if (alg == GEMM_DEFAULT)
@@ -595,8 +594,11 @@ void SUMMA_NN(
             alg = (multistream ? GEMM_SUMMA_B_MS : GEMM_SUMMA_B);
         else if (n <= m && weightTowardsC*n <= sumDim)
             alg = (multistream ? GEMM_SUMMA_A_MS : GEMM_SUMMA_A);
+        else if (multistream)
+            alg = GEMM_SUMMA_C_MS;
         else
-            alg = (multistream ? GEMM_SUMMA_C_MS : GEMM_SUMMA_C);
+            alg = (UsePipelinedSUMMA(C, sumDim) ?
+                   GEMM_SUMMA_C_PIPELINED : GEMM_SUMMA_C);
     }
 
     switch(alg)
@@ -610,6 +612,13 @@ void SUMMA_NN(
     case GEMM_SUMMA_B:    SUMMA_NNB(alpha, A, B, C); break;
     case GEMM_SUMMA_C_MS: SUMMA_NNC_MS(alpha, A, B, C); break;
     case GEMM_SUMMA_C:    SUMMA_NNC(alpha, A, B, C); break;
+    case GEMM_SUMMA_C_PIPELINED:
+        // The nonblocking variant is CPU-only
+        if (C.GetLocalDevice() == Device::CPU)
+            SUMMA_Pipelined(NORMAL, NORMAL, alpha, A, B, C);
+        else
+            SUMMA_NNC(alpha, A, B, C);
+        break;
     case GEMM_SUMMA_DOT:  SUMMA_NNDot(alpha, A, B, C, blockSizeDot); break;
     default:
         LogicError("Unsupported Gemm option (this shouldn't be possible)");
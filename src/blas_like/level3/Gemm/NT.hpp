@@ -464,7 +464,8 @@ void SUMMA_NT
   const AbstractDistMatrix<T>& A,
   const AbstractDistMatrix<T>& B,
         AbstractDistMatrix<T>& C,
-  GemmAlgorithm alg=GEMM_DEFAULT)
+  GemmAlgorithm alg=GEMM_DEFAULT,
+  const GemmHeuristicCtrl& ctrl=GemmHeuristics())
 {
     EL_DEBUG_CSE;
 #ifdef H_RELEASE
@@ -485,11 +486,9 @@ void SUMMA_NT
     const Int m = C.Height();
     const Int n = C.Width();
     const Int sumDim = A.Width();
-    const double weightTowardsC = 2.;
-    const double weightAwayFromDot = 10.;
-
-    // TODO(poulson): Make this tunable
-    const Int blockSizeDot = 2000;
+    const double weightTowardsC = ctrl.weightTowardsC;
+    const double weightAwayFromDot = ctrl.weightAwayFromDot;
+    const Int blockSizeDot = ctrl.blocksizeDot;
 
     if (alg == GEMM_DEFAULT)
     {
@@ -506,8 +505,11 @@ void SUMMA_NT
             alg = (multistream ? GEMM_SUMMA_B_MS : GEMM_SUMMA_B);
         else if(n <= m && weightTowardsC*n <= sumDim)
             alg = (multistream ? GEMM_SUMMA_A_MS : GEMM_SUMMA_A);
+        else if (multistream)
+            alg = GEMM_SUMMA_C_MS;
         else
-            alg = (multistream ? GEMM_SUMMA_C_MS : GEMM_SUMMA_C);
+            alg = (UsePipelinedSUMMA(C, sumDim) ?
+                   GEMM_SUMMA_C_PIPELINED : GEMM_SUMMA_C);
     }
     switch(alg)
     {
@@ -520,6 +522,13 @@ void SUMMA_NT
     case GEMM_SUMMA_B:    SUMMA_NTB(orientB, alpha, A, B, C); break;
     case GEMM_SUMMA_C_MS: SUMMA_NTC_MS(orientB, alpha, A, B, C); break;
     case GEMM_SUMMA_C:    SUMMA_NTC(orientB, alpha, A, B, C); break;
+    case GEMM_SUMMA_C_PIPELINED:
+        // The nonblocking variant is CPU-only
+        if (C.GetLocalDevice() == Device::CPU)
+            SUMMA_Pipelined(NORMAL, orientB, alpha, A, B, C);
+        else
+            SUMMA_NTC(orientB, alpha, A, B, C);
+        break;
     case GEMM_SUMMA_DOT:
         SUMMA_NTDot(orientB, alpha, A, B, C, blockSizeDot);
         break;
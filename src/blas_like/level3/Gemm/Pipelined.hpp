@@ -0,0 +1,264 @@
+namespace El {
+namespace gemm {
+
+// Nonblocking all-gather of a panel of an elemental matrix into its
+// (U,Collect(V)) or (Collect(U),V) counterpart. Start() packs the local
+// data and posts the collective; Finish() waits on it and unpacks the
+// result. The local multiplication of the previous panel is meant to be
+// done in between the two calls.
+//
+// The target must be aligned with the source, which is guaranteed by the
+// proxies in SUMMA_Pipelined_impl.
+template <typename T>
+class PanelAllGather
+{
+public:
+    void Start(ElementalMatrix<T> const& A, ElementalMatrix<T>& B)
+    {
+        EL_DEBUG_CSE;
+        EL_DEBUG_ONLY(
+          if (B.ColDist() == A.ColDist()
+              ? B.RowDist() != Collect(A.RowDist())
+              : (B.ColDist() != Collect(A.ColDist())
+                 || B.RowDist() != A.RowDist()))
+              LogicError("PanelAllGather: Incompatible distributions");
+        )
+        B_ = &B;
+        rowGather_ = (B.ColDist() == A.ColDist());
+        pending_ = false;
+
+        const Int height = A.Height();
+        const Int width = A.Width();
+        if (rowGather_)
+            B.AlignColsAndResize(A.ColAlign(), height, width, false, false);
+        else
+            B.AlignRowsAndResize(A.RowAlign(), height, width, false, false);
+        if (!A.Participating())
+            return;
+
+        stride_ = (rowGather_ ? A.RowStride() : A.ColStride());
+        if (stride_ == 1)
+        {
+            Copy(A.LockedMatrix(), B.Matrix());
+            return;
+        }
+
+        SyncInfo<Device::CPU> syncInfo;
+        if (rowGather_)
+        {
+            localHeight_ = A.LocalHeight();
+            localWidth_ = width;
+            align_ = A.RowAlign();
+            portionSize_ =
+              mpi::Pad(localHeight_*MaxLength(width,stride_));
+        }
+        else
+        {
+            localHeight_ = height;
+            localWidth_ = A.LocalWidth();
+            align_ = A.ColAlign();
+            portionSize_ =
+              mpi::Pad(MaxLength(height,stride_)*localWidth_);
+        }
+        buffer_.allocate((stride_+1)*portionSize_);
+        T* sendBuf = buffer_.data();
+        T* recvBuf = buffer_.data() + portionSize_;
+
+        // Pack
+        copy::util::InterleaveMatrix(
+            A.LocalHeight(), A.LocalWidth(),
+            A.LockedBuffer(), 1, A.LDim(),
+            sendBuf,          1, A.LocalHeight(), syncInfo);
+
+        // Communicate
+        mpi::IAllGather(
+            sendBuf, portionSize_, recvBuf, portionSize_,
+            (rowGather_ ? A.RowComm() : A.ColComm()), request_);
+        pending_ = true;
+    }
+
+    void Finish()
+    {
+        EL_DEBUG_CSE;
+        if (!pending_)
+            return;
+        mpi::Wait(request_);
+        pending_ = false;
+
+        // Unpack
+        SyncInfo<Device::CPU> syncInfo;
+        T* recvBuf = buffer_.data() + portionSize_;
+        if (rowGather_)
+            copy::util::RowStridedUnpack(
+                localHeight_, localWidth_, align_, stride_,
+                recvBuf, portionSize_,
+                B_->Buffer(), B_->LDim(), syncInfo);
+        else
+            copy::util::ColStridedUnpack(
+                localHeight_, localWidth_, align_, stride_,
+                recvBuf, portionSize_,
+                B_->Buffer(), B_->LDim(), syncInfo);
+    }
+
+private:
+    simple_buffer<T,Device::CPU> buffer_;
+    mpi::Request<T> request_;
+    ElementalMatrix<T>* B_ = nullptr;
+    bool rowGather_ = true;
+    bool pending_ = false;
+    Int stride_ = 1;
+    Int align_ = 0;
+    Int localHeight_ = 0;
+    Int localWidth_ = 0;
+    Int portionSize_ = 0;
+};
+
+// Stationary-C SUMMA that overlaps the all-gathers of panel k+1 of
+// op(A) and op(B) with the local multiplication of panel k.
+//
+// op(A) is kept in [MC,MR] if A is not transposed and in [MR,MC]
+// otherwise, so that both orientations reduce to a single all-gather
+// per panel: A1[MC,*] (or A1^T[*,MC]) and B1[*,MR] (or B1^T[MR,*]).
+template <bool TransA, bool TransB, typename T>
+void SUMMA_Pipelined_loop(
+    Orientation orientA, Orientation orientB,
+    T alpha,
+    AbstractDistMatrix<T> const& APre,
+    AbstractDistMatrix<T> const& BPre,
+    DistMatrix<T,MC,MR>& C)
+{
+    EL_DEBUG_CSE;
+    constexpr Dist UA = (TransA ? MR : MC), VA = (TransA ? MC : MR);
+    constexpr Dist UB = (TransB ? MR : MC), VB = (TransB ? MC : MR);
+    constexpr Dist UA1 = (TransA ? STAR : MC), VA1 = (TransA ? MC : STAR);
+    constexpr Dist UB1 = (TransB ? MR : STAR), VB1 = (TransB ? STAR : MR);
+
+    const Int sumDim = (TransA ? APre.Height() : APre.Width());
+    const Int bsize = Blocksize();
+    const Grid& g = APre.Grid();
+
+    // Align the distribution of op(A) with the rows of C and the
+    // distribution of op(B) with the columns of C
+    ElementalProxyCtrl ctrlA, ctrlB;
+    if (TransA)
+    {
+        ctrlA.rowConstrain = true; ctrlA.rowAlign = C.ColAlign();
+    }
+    else
+    {
+        ctrlA.colConstrain = true; ctrlA.colAlign = C.ColAlign();
+    }
+    if (TransB)
+    {
+        ctrlB.colConstrain = true; ctrlB.colAlign = C.RowAlign();
+    }
+    else
+    {
+        ctrlB.rowConstrain = true; ctrlB.rowAlign = C.RowAlign();
+    }
+    DistMatrixReadProxy<T,T,UA,VA> AProx(APre, ctrlA);
+    DistMatrixReadProxy<T,T,UB,VB> BProx(BPre, ctrlB);
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+
+    // Double-buffered panels
+    DistMatrix<T,UA1,VA1> A1Even(g), A1Odd(g);
+    DistMatrix<T,UB1,VB1> B1Even(g), B1Odd(g);
+    DistMatrix<T,UA1,VA1>* A1[2] = { &A1Even, &A1Odd };
+    DistMatrix<T,UB1,VB1>* B1[2] = { &B1Even, &B1Odd };
+    PanelAllGather<T> gatherA[2], gatherB[2];
+
+    auto startPanel = [&](Int k, Int slot)
+    {
+        const Range<Int> ind(k, Min(k+bsize,sumDim));
+        auto APanel = (TransA ? A(ind, ALL) : A(ALL, ind));
+        auto BPanel = (TransB ? B(ALL, ind) : B(ind, ALL));
+        gatherA[slot].Start(APanel, *A1[slot]);
+        gatherB[slot].Start(BPanel, *B1[slot]);
+    };
+
+    if (sumDim > 0)
+        startPanel(0, 0);
+    for (Int k=0, slot=0; k<sumDim; k+=bsize, slot=1-slot)
+    {
+        gatherA[slot].Finish();
+        gatherB[slot].Finish();
+        if (k+bsize < sumDim)
+            startPanel(k+bsize, 1-slot);
+
+        // C[MC,MR] += alpha op(A1)[MC,*] op(B1)[*,MR]
+        LocalGemm(orientA, orientB,
+                  alpha, *A1[slot], *B1[slot],
+                  TypeTraits<T>::One(), C);
+    }
+}
+
+template <typename T,
+          typename=EnableIf<IsDeviceValidType<T,Device::CPU>>>
+void SUMMA_Pipelined_impl(
+    Orientation orientA, Orientation orientB,
+    T alpha,
+    AbstractDistMatrix<T> const& APre,
+    AbstractDistMatrix<T> const& BPre,
+    AbstractDistMatrix<T>& CPre)
+{
+    EL_DEBUG_CSE;
+    AUTO_PROFILE_REGION(
+        "SUMMA.Pipelined",
+        SyncInfoFromMatrix(
+            static_cast<Matrix<T,Device::CPU> const&>(CPre.LockedMatrix())));
+
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx(CPre);
+    auto& C = CProx.Get();
+
+    const bool transA = (orientA != NORMAL);
+    const bool transB = (orientB != NORMAL);
+    if (transA && transB)
+        SUMMA_Pipelined_loop<true,true>(orientA, orientB, alpha, APre, BPre, C);
+    else if (transA)
+        SUMMA_Pipelined_loop<true,false>(orientA, orientB, alpha, APre, BPre, C);
+    else if (transB)
+        SUMMA_Pipelined_loop<false,true>(orientA, orientB, alpha, APre, BPre, C);
+    else
+        SUMMA_Pipelined_loop<false,false>(orientA, orientB, alpha, APre, BPre, C);
+}
+
+template <typename T,
+          typename=DisableIf<IsDeviceValidType<T,Device::CPU>>,
+          typename=void>
+void SUMMA_Pipelined_impl(
+    Orientation, Orientation, T,
+    AbstractDistMatrix<T> const&,
+    AbstractDistMatrix<T> const&,
+    AbstractDistMatrix<T>&)
+{
+    LogicError("SUMMA_Pipelined_impl type-device combo not supported.");
+}
+
+template <typename T>
+void SUMMA_Pipelined(
+    Orientation orientA, Orientation orientB,
+    T alpha,
+    AbstractDistMatrix<T> const& APre,
+    AbstractDistMatrix<T> const& BPre,
+    AbstractDistMatrix<T>& CPre)
+{
+    EL_DEBUG_CSE;
+    if (CPre.GetLocalDevice() != Device::CPU)
+        LogicError("SUMMA_Pipelined: Only the CPU is supported.");
+    SUMMA_Pipelined_impl(orientA, orientB, alpha, APre, BPre, CPre);
+}
+
+// Returns true if the nonblocking, stationary-C variant should be
+// preferred over the blocking one. The overlap only pays off on the CPU
+// when there is actual communication and more than one panel.
+template <typename T>
+bool UsePipelinedSUMMA(AbstractDistMatrix<T> const& C, Int sumDim)
+{
+    return C.GetLocalDevice() == Device::CPU
+        && C.Grid().Size() > 1
+        && sumDim > Blocksize();
+}
+
+} // namespace gemm
+} // namespace El
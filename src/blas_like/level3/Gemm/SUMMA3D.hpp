@@ -0,0 +1,176 @@
+namespace El {
+namespace gemm {
+
+// Replication depth used by GEMM_SUMMA_3D when GemmReplicationDepth() is
+// zero: the largest divisor c of the grid size with c^3 <= p, which is the
+// regime where the 2.5D algorithm moves a factor of sqrt(c) fewer words
+// than SUMMA without exceeding the 3D memory bound.
+inline Int DefaultReplicationDepth(Int gridSize)
+{
+    Int depth = 1;
+    for (Int c=2; c*c*c<=gridSize; ++c)
+        if (gridSize % c == 0)
+            depth = c;
+    return depth;
+}
+
+// 2.5D matrix multiplication.
+//
+// The grid is split into c layers of p/c processes (see Grid::LayerGrid).
+// Layer l receives the l-th slice of the summation dimension of op(A) and
+// op(B), forms its partial product with an ordinary 2D Gemm over the layer
+// grid, and the c partial products are reduced over Grid::DepthComm. The
+// reduction is scattered by column blocks so that every layer finishes
+// with one c-th of C, which is then translated back into C.
+template <Device D, typename T, typename=EnableIf<IsDeviceValidType<T,D>>>
+void SUMMA3D_impl(
+    Orientation orientA, Orientation orientB,
+    T alpha,
+    AbstractDistMatrix<T> const& APre,
+    AbstractDistMatrix<T> const& BPre,
+    AbstractDistMatrix<T>& CPre,
+    Int depth)
+{
+    EL_DEBUG_CSE;
+    AUTO_PROFILE_REGION(
+        "SUMMA.3D",
+        SyncInfoFromMatrix(
+            static_cast<Matrix<T,D> const&>(CPre.LockedMatrix())));
+
+    const Grid& g = CPre.Grid();
+    const Int m = CPre.Height();
+    const Int n = CPre.Width();
+    const Int sumDim = (orientA == NORMAL ? APre.Width() : APre.Height());
+
+    DistMatrixReadProxy<T,T,MC,MR,ELEMENT,D> AProx(APre);
+    DistMatrixReadProxy<T,T,MC,MR,ELEMENT,D> BProx(BPre);
+    DistMatrixReadWriteProxy<T,T,MC,MR,ELEMENT,D> CProx(CPre);
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& C = CProx.Get();
+
+    // Every process views every layer, but only belongs to one
+    const Int layerSize = g.Size() / depth;
+    const Int myLayer = (g.InGrid() ? g.VCRank() / layerSize : -1);
+
+    std::vector<std::unique_ptr<DistMatrix<T,MC,MR,ELEMENT,D>>>
+      CLayers(depth);
+    for (Int layer=0; layer<depth; ++layer)
+    {
+        const Grid& layerGrid = g.LayerGrid(depth, layer);
+        const Range<Int> ind(sumDim*layer/depth, sumDim*(layer+1)/depth);
+
+        // Replicate the slices of A and B into the layer
+        DistMatrix<T,MC,MR,ELEMENT,D> ALayer(layerGrid), BLayer(layerGrid);
+        if (orientA == NORMAL)
+            ALayer = A(ALL, ind);
+        else
+            ALayer = A(ind, ALL);
+        if (orientB == NORMAL)
+            BLayer = B(ind, ALL);
+        else
+            BLayer = B(ALL, ind);
+
+        CLayers[layer].reset(new DistMatrix<T,MC,MR,ELEMENT,D>(layerGrid));
+        Zeros(*CLayers[layer], m, n);
+
+        // Only the members of the layer take part in its multiplication
+        if (layer == myLayer)
+            Gemm(orientA, orientB,
+                 alpha, ALayer, BLayer,
+                 TypeTraits<T>::Zero(), *CLayers[layer]);
+    }
+
+    // Sum the partial products, sending column block l to layer l. All of
+    // the layers share the same shape and alignments, so the members of the
+    // depth communicator hold conformal local matrices.
+    if (g.InGrid())
+    {
+        auto& CLoc = CLayers[myLayer]->Matrix();
+        EL_DEBUG_ONLY(
+          if (CLoc.Height() > 0 && CLoc.LDim() != CLoc.Height())
+              LogicError("SUMMA3D: Expected a contiguous local matrix");
+        )
+        SyncInfo<D> syncInfo = SyncInfoFromMatrix(CLoc);
+        const Int rowShift = CLayers[myLayer]->RowShift();
+        const Int rowStride = CLayers[myLayer]->RowStride();
+        mpi::Comm const& depthComm = g.DepthComm(depth);
+        for (Int layer=0; layer<depth; ++layer)
+        {
+            const Int jBeg = Length(n*layer/depth, rowShift, rowStride);
+            const Int jEnd = Length(n*(layer+1)/depth, rowShift, rowStride);
+            mpi::Reduce(
+                CLoc.Buffer(0, jBeg), CLoc.Height()*(jEnd-jBeg),
+                layer, depthComm, syncInfo);
+        }
+    }
+
+    // C += CLayer_l(:,J_l) for each layer l
+    DistMatrix<T,MC,MR,ELEMENT,D> CUpdate(g);
+    for (Int layer=0; layer<depth; ++layer)
+    {
+        const Range<Int> ind(n*layer/depth, n*(layer+1)/depth);
+        auto C1 = C(ALL, ind);
+        CUpdate.AlignWith(C1);
+        CUpdate = (*CLayers[layer])(ALL, ind);
+        Axpy(TypeTraits<T>::One(), CUpdate.LockedMatrix(), C1.Matrix());
+    }
+}
+
+template <Device D, typename T,
+          typename=DisableIf<IsDeviceValidType<T,D>>, typename=void>
+void SUMMA3D_impl(
+    Orientation, Orientation, T,
+    AbstractDistMatrix<T> const&,
+    AbstractDistMatrix<T> const&,
+    AbstractDistMatrix<T>&,
+    Int)
+{
+    LogicError("SUMMA3D_impl type-device combo not supported.");
+}
+
+template <typename T>
+void SUMMA3D(
+    Orientation orientA, Orientation orientB,
+    T alpha,
+    AbstractDistMatrix<T> const& APre,
+    AbstractDistMatrix<T> const& BPre,
+    AbstractDistMatrix<T>& CPre)
+{
+    EL_DEBUG_CSE;
+    const Grid& g = CPre.Grid();
+    AssertSameGrids(APre.Grid(), BPre.Grid(), g);
+    Int depth = GemmReplicationDepth();
+    if (depth == 0)
+        depth = DefaultReplicationDepth(g.Size());
+    if (g.Size() % depth != 0)
+        LogicError(
+            "SUMMA3D: Replication depth ", depth,
+            " does not divide the grid size ", g.Size());
+
+    if (depth == 1)
+    {
+        Gemm(orientA, orientB,
+             alpha, APre, BPre, TypeTraits<T>::One(), CPre);
+        return;
+    }
+
+    switch (CPre.GetLocalDevice())
+    {
+    case Device::CPU:
+        SUMMA3D_impl<Device::CPU>(
+            orientA, orientB, alpha, APre, BPre, CPre, depth);
+        break;
+#ifdef HYDROGEN_HAVE_GPU
+    case Device::GPU:
+        SUMMA3D_impl<Device::GPU>(
+            orientA, orientB, alpha, APre, BPre, CPre, depth);
+        break;
+#endif // HYDROGEN_HAVE_GPU
+    default:
+        LogicError("SUMMA3D: Bad device.");
+    }
+}
+
+} // namespace gemm
+} // namespace El
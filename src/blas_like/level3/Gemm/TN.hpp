@@ -462,7 +462,8 @@ void SUMMA_TN
   const AbstractDistMatrix<T>& A,
   const AbstractDistMatrix<T>& B,
         AbstractDistMatrix<T>& C,
-  GemmAlgorithm alg=GEMM_DEFAULT)
+  GemmAlgorithm alg=GEMM_DEFAULT,
+  const GemmHeuristicCtrl& ctrl=GemmHeuristics())
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
@@ -482,11 +483,9 @@ void SUMMA_TN
     const Int m = C.Height();
     const Int n = C.Width();
     const Int sumDim = A.Height();
-    const double weightTowardsC = 2.;
-    const double weightAwayFromDot = 10.;
-
-    // TODO(poulson): Make this tunable
-    const Int blockSizeDot = 2000;
+    const double weightTowardsC = ctrl.weightTowardsC;
+    const double weightAwayFromDot = ctrl.weightAwayFromDot;
+    const Int blockSizeDot = ctrl.blocksizeDot;
 
     if (alg == GEMM_DEFAULT)
     {
@@ -503,8 +502,11 @@ void SUMMA_TN
             alg = (multistream ? GEMM_SUMMA_B_MS : GEMM_SUMMA_B);
         else if(n <= m && weightTowardsC*n <= sumDim)
             alg = (multistream ? GEMM_SUMMA_A_MS : GEMM_SUMMA_A);
+        else if (multistream)
+            alg = GEMM_SUMMA_C_MS;
         else
-            alg = (multistream ? GEMM_SUMMA_C_MS : GEMM_SUMMA_C);
+            alg = (UsePipelinedSUMMA(C, sumDim) ?
+                   GEMM_SUMMA_C_PIPELINED : GEMM_SUMMA_C);
     }
 
     switch(alg)
@@ -518,6 +520,13 @@ void SUMMA_TN
     case GEMM_SUMMA_B:    SUMMA_TNB(orientA, alpha, A, B, C); break;
     case GEMM_SUMMA_C_MS: SUMMA_TNC_MS(orientA, alpha, A, B, C); break;
     case GEMM_SUMMA_C:    SUMMA_TNC(orientA, alpha, A, B, C); break;
+    case GEMM_SUMMA_C_PIPELINED:
+        // The nonblocking variant is CPU-only
+        if (C.GetLocalDevice() == Device::CPU)
+            SUMMA_Pipelined(orientA, NORMAL, alpha, A, B, C);
+        else
+            SUMMA_TNC(orientA, alpha, A, B, C);
+        break;
     case GEMM_SUMMA_DOT:
         SUMMA_TNDot(orientA, alpha, A, B, C, blockSizeDot);
         break;
@@ -383,7 +383,8 @@ void SUMMA_TT
   const AbstractDistMatrix<T>& A,
   const AbstractDistMatrix<T>& B,
         AbstractDistMatrix<T>& C,
-  GemmAlgorithm alg=GEMM_DEFAULT)
+  GemmAlgorithm alg=GEMM_DEFAULT,
+  const GemmHeuristicCtrl& ctrl=GemmHeuristics())
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
@@ -402,11 +403,9 @@ void SUMMA_TT
     const Int m = C.Height();
     const Int n = C.Width();
     const Int sumDim = A.Height();
-    const double weightTowardsC = 2.;
-    const double weightAwayFromDot = 10.;
-
-    // TODO(poulson): Make this tunable
-    const Int blockSizeDot = 2000;
+    const double weightTowardsC = ctrl.weightTowardsC;
+    const double weightAwayFromDot = ctrl.weightAwayFromDot;
+    const Int blockSizeDot = ctrl.blocksizeDot;
 
     switch(alg)
     {
@@ -417,6 +416,8 @@ void SUMMA_TT
             SUMMA_TTB(orientA, orientB, alpha, A, B, C);
         else if (n <= m && weightTowardsC*n <= sumDim)
             SUMMA_TTA(orientA, orientB, alpha, A, B, C);
+        else if (UsePipelinedSUMMA(C, sumDim))
+            SUMMA_Pipelined(orientA, orientB, alpha, A, B, C);
         else
             SUMMA_TTC(orientA, orientB, alpha, A, B, C);
         break;
@@ -429,6 +430,13 @@ void SUMMA_TT
     case GEMM_SUMMA_C:
         SUMMA_TTC(orientA, orientB, alpha, A, B, C);
         break;
+    case GEMM_SUMMA_C_PIPELINED:
+        // The nonblocking variant is CPU-only
+        if (C.GetLocalDevice() == Device::CPU)
+            SUMMA_Pipelined(orientA, orientB, alpha, A, B, C);
+        else
+            SUMMA_TTC(orientA, orientB, alpha, A, B, C);
+        break;
     case GEMM_SUMMA_DOT:
         SUMMA_TTDot(orientA, orientB, alpha, A, B, C);
         break;
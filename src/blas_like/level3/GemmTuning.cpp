@@ -0,0 +1,400 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+#include <El/blas_like/level3.hpp>
+
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <tuple>
+
+#if defined(HYDROGEN_HAVE_GPU) && defined(HYDROGEN_HAVE_ALUMINUM)
+#define HYDROGEN_HAVE_MS_GEMM
+#endif
+
+namespace {
+using namespace El;
+
+GemmHeuristicCtrl gemmHeuristics;
+std::map<GemmTuningKey,GemmTuningEntry> gemmTuningTable;
+bool gemmTuningTableLoaded = false;
+bool gemmAutotuning = false;
+
+const char* TuningFileName()
+{ return std::getenv("H_GEMM_TUNING_FILE"); }
+
+// Reads H_GEMM_TUNING_FILE the first time the table is needed. The file
+// not existing yet is fine, since autotuning may be about to create it.
+void EnsureTuningTableLoaded()
+{
+    if( gemmTuningTableLoaded )
+        return;
+    gemmTuningTableLoaded = true;
+    const char* filename = TuningFileName();
+    if( filename != nullptr && std::ifstream(filename).good() )
+        LoadGemmTuningTable( filename );
+}
+
+int Log2Floor( Int n )
+{
+    int log2 = 0;
+    for( ; n > 1; n /= 2 )
+        ++log2;
+    return log2;
+}
+
+string DeviceString( Device device )
+{
+    switch( device )
+    {
+    case Device::CPU: return "CPU";
+#ifdef HYDROGEN_HAVE_GPU
+    case Device::GPU: return "GPU";
+#endif // HYDROGEN_HAVE_GPU
+    default:
+        LogicError("Bad device.");
+    }
+    return "";
+}
+
+Device StringToDevice( const string& str )
+{
+    if( str == "CPU" )
+        return Device::CPU;
+#ifdef HYDROGEN_HAVE_GPU
+    if( str == "GPU" )
+        return Device::GPU;
+#endif // HYDROGEN_HAVE_GPU
+    RuntimeError("Unsupported device in Gemm tuning table: ",str);
+    return Device::CPU;
+}
+
+// The algorithms (and blocksizes) worth trying for a given problem
+vector<GemmTuningEntry> GemmCandidates
+( Orientation orientA, Orientation orientB, const Grid& g, Device device )
+{
+    vector<GemmTuningEntry> candidates;
+    const Int nb = Blocksize();
+    vector<Int> blocksizes;
+    if( nb > 1 )
+        blocksizes.push_back( nb/2 );
+    blocksizes.push_back( nb );
+    blocksizes.push_back( 2*nb );
+
+    vector<GemmAlgorithm> algs =
+      { GEMM_SUMMA_A, GEMM_SUMMA_B, GEMM_SUMMA_C };
+#ifdef HYDROGEN_HAVE_MS_GEMM
+    if( device == Device::GPU && (orientA == NORMAL || orientB == NORMAL) )
+    {
+        algs.push_back( GEMM_SUMMA_A_MS );
+        algs.push_back( GEMM_SUMMA_B_MS );
+        algs.push_back( GEMM_SUMMA_C_MS );
+    }
+#endif // HYDROGEN_HAVE_MS_GEMM
+    if( device == Device::CPU && g.Size() > 1 )
+        algs.push_back( GEMM_SUMMA_C_PIPELINED );
+    const Int depth = GemmReplicationDepth();
+    if( depth > 1 && g.Size() % depth == 0 )
+        algs.push_back( GEMM_SUMMA_3D );
+
+    for( auto alg : algs )
+        for( auto blocksize : blocksizes )
+        {
+            GemmTuningEntry entry;
+            entry.alg = alg;
+            entry.blocksize = blocksize;
+            candidates.push_back( entry );
+        }
+
+    // The dot-product variant has its own panel width
+    GemmTuningEntry dot;
+    dot.alg = GEMM_SUMMA_DOT;
+    dot.blocksize = gemmHeuristics.blocksizeDot;
+    candidates.push_back( dot );
+
+    return candidates;
+}
+
+template<Device D,typename T,typename=EnableIf<IsDeviceValidType<T,D>>>
+GemmTuningEntry TuneGemm_impl
+( Orientation orientA, Orientation orientB, Int m, Int n, Int k,
+  const Grid& g )
+{
+    EL_DEBUG_CSE
+    const Int numTrials = 3;
+
+    DistMatrix<T,MC,MR,ELEMENT,D> A(g), B(g), C(g);
+    if( orientA == NORMAL )
+        A.Resize( m, k );
+    else
+        A.Resize( k, m );
+    if( orientB == NORMAL )
+        B.Resize( k, n );
+    else
+        B.Resize( n, k );
+    C.Resize( m, n );
+    Fill( A, TypeTraits<T>::One() );
+    Fill( B, TypeTraits<T>::One() );
+    Fill( C, TypeTraits<T>::Zero() );
+    auto syncInfo = SyncInfoFromMatrix( C.LockedMatrix() );
+    const T alpha = TypeTraits<T>::One();
+    const T beta = TypeTraits<T>::Zero();
+
+    GemmTuningEntry best;
+    double bestTime = std::numeric_limits<double>::infinity();
+    Timer timer;
+    for( const auto& candidate : GemmCandidates(orientA,orientB,g,D) )
+    {
+        const bool pushBlocksize = (candidate.alg != GEMM_SUMMA_DOT);
+        if( pushBlocksize )
+            PushBlocksizeStack( candidate.blocksize );
+
+        // One untimed run to set up communicators and workspace
+        Gemm( orientA, orientB, alpha, A, B, beta, C, candidate.alg );
+        Synchronize( syncInfo );
+
+        double time = std::numeric_limits<double>::infinity();
+        for( Int trial=0; trial<numTrials; ++trial )
+        {
+            mpi::Barrier( g.Comm() );
+            timer.Start();
+            Gemm( orientA, orientB, alpha, A, B, beta, C, candidate.alg );
+            Synchronize( syncInfo );
+            time = Min( time, timer.Stop() );
+        }
+        if( pushBlocksize )
+            PopBlocksizeStack();
+
+        // The slowest process determines the time of a collective
+        time = mpi::AllReduce
+               ( time, mpi::MAX, g.Comm(), SyncInfo<Device::CPU>() );
+        if( time < bestTime )
+        {
+            bestTime = time;
+            best = candidate;
+        }
+    }
+    return best;
+}
+
+template<Device D,typename T,
+         typename=DisableIf<IsDeviceValidType<T,D>>,typename=void>
+GemmTuningEntry TuneGemm_impl
+( Orientation, Orientation, Int, Int, Int, const Grid& )
+{
+    LogicError("TuneGemm: Bad device/type combination.");
+    return GemmTuningEntry();
+}
+
+} // namespace <anon>
+
+namespace El {
+
+void SetGemmHeuristics( const GemmHeuristicCtrl& ctrl )
+{ ::gemmHeuristics = ctrl; }
+
+const GemmHeuristicCtrl& GemmHeuristics()
+{ return ::gemmHeuristics; }
+
+bool operator<( const GemmTuningKey& a, const GemmTuningKey& b )
+{
+    return std::tie
+           ( a.gridHeight, a.gridWidth, a.typeName, a.device,
+             a.orientA, a.orientB, a.logM, a.logN, a.logK ) <
+           std::tie
+           ( b.gridHeight, b.gridWidth, b.typeName, b.device,
+             b.orientA, b.orientB, b.logM, b.logN, b.logK );
+}
+
+GemmTuningKey MakeGemmTuningKey
+( const Grid& g, const string& typeName, Device device,
+  Orientation orientA, Orientation orientB, Int m, Int n, Int k )
+{
+    GemmTuningKey key;
+    key.gridHeight = g.Height();
+    key.gridWidth = g.Width();
+    key.typeName = typeName;
+    key.device = device;
+    key.orientA = orientA;
+    key.orientB = orientB;
+    key.logM = ::Log2Floor( m );
+    key.logN = ::Log2Floor( n );
+    key.logK = ::Log2Floor( k );
+    return key;
+}
+
+void SetGemmTuning( const GemmTuningKey& key, const GemmTuningEntry& entry )
+{
+    ::EnsureTuningTableLoaded();
+    ::gemmTuningTable[key] = entry;
+}
+
+bool GetGemmTuning( const GemmTuningKey& key, GemmTuningEntry& entry )
+{
+    ::EnsureTuningTableLoaded();
+    auto it = ::gemmTuningTable.find( key );
+    if( it == ::gemmTuningTable.end() )
+        return false;
+    entry = it->second;
+    return true;
+}
+
+void ClearGemmTuningTable()
+{
+    ::gemmTuningTable.clear();
+    ::gemmTuningTableLoaded = true;
+}
+
+// Each line of a tuning table has the form
+//
+//   gridHeight gridWidth type device orientA orientB logM logN logK alg nb
+//
+// e.g., "2 2 double CPU N T 10 10 12 SUMMA_C 128". Lines starting with '#'
+// are comments.
+void LoadGemmTuningTable( const string& filename )
+{
+    EL_DEBUG_CSE
+    ::gemmTuningTableLoaded = true;
+    std::ifstream file( filename );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    string line;
+    while( std::getline( file, line ) )
+    {
+        if( line.empty() || line[0] == '#' )
+            continue;
+        std::istringstream record( line );
+        GemmTuningKey key;
+        GemmTuningEntry entry;
+        string device, algName;
+        char orientA, orientB;
+        if( !(record >> key.gridHeight >> key.gridWidth >> key.typeName
+                     >> device >> orientA >> orientB
+                     >> key.logM >> key.logN >> key.logK
+                     >> algName >> entry.blocksize) )
+            RuntimeError("Invalid Gemm tuning record: ",line);
+        key.device = ::StringToDevice( device );
+        key.orientA = CharToOrientation( orientA );
+        key.orientB = CharToOrientation( orientB );
+        entry.alg = GemmAlgorithmFromName( algName );
+        ::gemmTuningTable[key] = entry;
+    }
+}
+
+void SaveGemmTuningTable( const string& filename )
+{
+    EL_DEBUG_CSE
+    std::ofstream file( filename );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file << "# gridHeight gridWidth type device orientA orientB "
+            "logM logN logK algorithm blocksize\n";
+    for( const auto& record : ::gemmTuningTable )
+    {
+        const auto& key = record.first;
+        const auto& entry = record.second;
+        file << key.gridHeight << " " << key.gridWidth << " "
+             << key.typeName << " " << ::DeviceString(key.device) << " "
+             << OrientationToChar(key.orientA) << " "
+             << OrientationToChar(key.orientB) << " "
+             << key.logM << " " << key.logN << " " << key.logK << " "
+             << GemmAlgorithmName(entry.alg) << " " << entry.blocksize
+             << "\n";
+    }
+}
+
+void SetGemmAutotuning( bool autotune )
+{ ::gemmAutotuning = autotune; }
+
+bool GemmAutotuning()
+{ return ::gemmAutotuning || std::getenv("H_GEMM_AUTOTUNE") != nullptr; }
+
+template<typename T>
+GemmTuningEntry TuneGemm
+( Orientation orientA, Orientation orientB, Int m, Int n, Int k,
+  const Grid& g, Device device )
+{
+    EL_DEBUG_CSE
+    if( !g.InGrid() )
+        return GemmTuningEntry();
+
+    GemmTuningEntry best;
+    switch( device )
+    {
+    case Device::CPU:
+        best = ::TuneGemm_impl<Device::CPU,T>( orientA, orientB, m, n, k, g );
+        break;
+#ifdef HYDROGEN_HAVE_GPU
+    case Device::GPU:
+        best = ::TuneGemm_impl<Device::GPU,T>( orientA, orientB, m, n, k, g );
+        break;
+#endif // HYDROGEN_HAVE_GPU
+    default:
+        LogicError("TuneGemm: Bad device.");
+    }
+
+    SetGemmTuning
+    ( MakeGemmTuningKey
+      ( g, TypeName<T>(), device, orientA, orientB, m, n, k ), best );
+    const char* filename = ::TuningFileName();
+    if( filename != nullptr && g.Comm().Rank() == 0 )
+        SaveGemmTuningTable( filename );
+    return best;
+}
+
+string GemmAlgorithmName( GemmAlgorithm alg )
+{
+    switch( alg )
+    {
+    case GEMM_DEFAULT:           return "DEFAULT";
+    case GEMM_SUMMA_A_MS:        return "SUMMA_A_MS";
+    case GEMM_SUMMA_A:           return "SUMMA_A";
+    case GEMM_SUMMA_B_MS:        return "SUMMA_B_MS";
+    case GEMM_SUMMA_B:           return "SUMMA_B";
+    case GEMM_SUMMA_C_MS:        return "SUMMA_C_MS";
+    case GEMM_SUMMA_C:           return "SUMMA_C";
+    case GEMM_SUMMA_DOT:         return "SUMMA_DOT";
+    case GEMM_CANNON:            return "CANNON";
+    case GEMM_SUMMA_C_PIPELINED: return "SUMMA_C_PIPELINED";
+    case GEMM_SUMMA_3D:          return "SUMMA_3D";
+    }
+    return "UNKNOWN";
+}
+
+GemmAlgorithm GemmAlgorithmFromName( const string& name )
+{
+    for( int alg=GEMM_DEFAULT; alg<=GEMM_SUMMA_3D; ++alg )
+        if( name == GemmAlgorithmName(GemmAlgorithm(alg)) )
+            return GemmAlgorithm(alg);
+    RuntimeError("Unknown Gemm algorithm: ",name);
+    return GEMM_DEFAULT;
+}
+
+#define PROTO(T) \
+  template GemmTuningEntry TuneGemm<T> \
+  ( Orientation orientA, Orientation orientB, Int m, Int n, Int k, \
+    const Grid& g, Device device );
+
+#ifdef HYDROGEN_GPU_USE_FP16
+PROTO(gpu_half_type)
+#endif // HYDROGEN_GPU_USE_FP16
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#define EL_ENABLE_HALF
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -10,6 +10,7 @@
 #include <El/blas_like/level1.hpp>
 #include <El/blas_like/level2.hpp>
 #include <El/blas_like/level3.hpp>
+#include <El/core/Profiling.hpp>
 
 #include "./Trsm/LLN.hpp"
 #include "./Trsm/LLT.hpp"
@@ -140,6 +141,7 @@ void Trsm
   DeviceTag<D> dtag)
 {
     EL_DEBUG_CSE
+    AUTO_NOSYNC_PROFILE_REGION("Trsm.Dist");
     EL_DEBUG_ONLY(
       AssertSameGrids( A, B );
       if( A.Height() != A.Width() )
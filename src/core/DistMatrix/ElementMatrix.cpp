@@ -493,6 +493,93 @@ ElementalMatrix<T>::LockedAttach(const El::Grid& g, const El::Matrix<T>& A)
     LockedAttach(A.Height(), A.Width(), g, 0, 0, A.LockedBuffer(), A.LDim());
 }
 
+// File-backed storage
+// -------------------
+template <typename T>
+void
+ElementalMatrix<T>::MapLocalFile
+(const string& filename, Int height, Int width,
+  FileMapMode mode, size_t offset)
+{
+    EL_DEBUG_CSE;
+#ifndef EL_RELEASE
+    this->AssertNotLocked();
+#endif // !EL_RELEASE
+    if (this->Viewing())
+        LogicError("Cannot map a file into a view");
+    if (this->GetLocalDevice() != Device::CPU)
+        LogicError("Only CPU matrices can be backed by a file");
+
+    this->height_ = height;
+    this->width_ = width;
+    if (this->Participating())
+    {
+        auto& ALoc = static_cast<El::Matrix<T>&>(this->Matrix());
+        ALoc.MapFile
+        (filename,
+         Length(height,this->ColShift(),this->ColStride()),
+         Length(width,this->RowShift(),this->RowStride()),
+         mode, offset);
+    }
+}
+
+// Node-shared storage
+// -------------------
+template <typename T>
+void ElementalMatrix<T>::SetNodeSharedStorage(bool share)
+{
+    EL_DEBUG_CSE;
+#ifndef EL_RELEASE
+    this->AssertNotLocked();
+#endif // !EL_RELEASE
+    if (this->Viewing())
+        LogicError("Cannot share the storage of a view");
+    if (this->GetLocalDevice() != Device::CPU)
+        LogicError("Only CPU matrices can be shared by a node");
+    if (!this->Participating() || share == NodeSharedStorage())
+        return;
+
+    std::shared_ptr<mpi::NodeComms> nodeComms;
+    if (share)
+    {
+        mpi::GetNodeComms(this->RedundantComm());
+        nodeComms = this->RedundantComm().CachedNodeComms();
+    }
+    auto& ALoc = static_cast<El::Matrix<T>&>(this->Matrix());
+    El::Matrix<T> contents(ALoc);
+    // Nobody may free shared storage that another process is reading
+    ALoc.NodeSharedBarrier();
+    ALoc.SetNodeShared(std::move(nodeComms));
+    ALoc.Resize(contents.Height(), contents.Width());
+    if (ALoc.NodeSharedWriter())
+        El::Copy(contents, ALoc);
+    ALoc.NodeSharedBarrier();
+}
+
+template <typename T>
+bool ElementalMatrix<T>::NodeSharedStorage() const
+{
+    return this->GetLocalDevice() == Device::CPU &&
+      static_cast<const El::Matrix<T>&>(this->LockedMatrix()).NodeShared();
+}
+
+template <typename T>
+bool ElementalMatrix<T>::NodeSharedWriter() const
+{
+    return !NodeSharedStorage() ||
+      static_cast<const El::Matrix<T>&>(this->LockedMatrix()).
+      NodeSharedWriter();
+}
+
+template <typename T>
+void ElementalMatrix<T>::NodeSharedBarrier() const
+{
+    EL_DEBUG_CSE;
+    if (NodeSharedStorage())
+        static_cast<const El::Matrix<T>&>(this->LockedMatrix()).
+        NodeSharedBarrier();
+}
+
 // Operator overloading
 // ====================
 
@@ -16,6 +16,36 @@
 namespace El
 {
 
+namespace
+{
+
+// Queued updates are shipped as the differences between consecutive
+// sorted offsets into the owner's local matrix, seven bits per byte with
+// the high bit marking that another byte follows
+inline void EncodeOffsetDelta(std::uint64_t delta, vector<byte>& bytes)
+{
+    while (delta >= 0x80)
+    {
+        bytes.push_back(byte(delta | 0x80));
+        delta >>= 7;
+    }
+    bytes.push_back(byte(delta));
+}
+
+inline std::uint64_t DecodeOffsetDelta(const byte*& bytes)
+{
+    std::uint64_t delta = 0;
+    for (int shift=0; ; shift+=7)
+    {
+        const byte b = *bytes++;
+        delta |= std::uint64_t(b & 0x7f) << shift;
+        if (!(b & 0x80))
+            return delta;
+    }
+}
+
+} // namespace <anon>
+
 #define DM DistMatrix<T,COLDIST,ROWDIST,ELEMENT,D>
 #define EM ElementalMatrix<T>
 #define ADM AbstractDistMatrix<T>
@@ -674,6 +704,23 @@ void DM::QueueUpdate(const Entry<T>& entry)
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+#ifdef EL_HYBRID
+    // Each thread of a (non-nested) parallel region fills its own queue;
+    // local entries are queued as well since several threads may update
+    // the same entry
+    if (omp_in_parallel())
+    {
+        const int thread = omp_get_thread_num();
+        if (omp_get_level() == 1 && thread < int(threadUpdates_.size()))
+            threadUpdates_[thread].push_back(entry);
+        else
+        {
+            #pragma omp critical
+            remoteUpdates_.push_back(entry);
+        }
+        return;
+    }
+#endif
     // NOTE: We cannot always simply locally update since it can (and has)
     //       lead to the processors in the same redundant communicator having
     //       different results after ProcessQueues()
@@ -695,70 +742,182 @@ void DM::ProcessQueues(bool includeViewers)
     const auto& grid = Grid();
     const Dist colDist = ColDist();
     const Dist rowDist = RowDist();
-    const Int totalSend = remoteUpdates_.size();
-    LogicError("Test.");
+#ifdef EL_HYBRID
+    for (auto& threadUpdates : threadUpdates_)
+    {
+        remoteUpdates_.insert(
+          remoteUpdates_.end(), threadUpdates.begin(), threadUpdates.end());
+        SwapClear(threadUpdates);
+    }
+#endif
+    if (!includeViewers && !this->Participating())
+        return;
+    mpi::Comm const& comm
+        = (includeViewers ? grid.ViewingComm() : grid.VCComm());
+    const int commSize = mpi::Size(comm);
+    SyncInfo<Device::CPU> cpu_si;
 
     // We will first push to redundant rank 0
     const int redundantRoot = 0;
 
-    // Compute the metadata
-    // ====================
-    mpi::Comm const& comm
-        = (includeViewers ? grid.ViewingComm() : grid.VCComm());
-    vector<int> sendCounts, owners(totalSend);
-    if (includeViewers)
+    // Map the distribution ranks onto the communicator and compute the
+    // local height of each process row, so that each update can be
+    // addressed by its column-major offset in its owner's local matrix
+    const int colStride = this->ColStride();
+    const int distSize = DistSize();
+    vector<int> distToComm(distSize);
+    for (int distRank=0; distRank<distSize; ++distRank)
     {
-        const int viewingSize = mpi::Size(grid.ViewingComm());
-        sendCounts.resize(viewingSize,0);
-        for(Int k=0; k<totalSend; ++k)
-        {
-            const Entry<T>& entry = remoteUpdates_[k];
-            const int distOwner = this->Owner(entry.i,entry.j);
-            const int vcOwner =
-              grid.CoordsToVC(colDist,rowDist,distOwner,redundantRoot);
-            owners[k] = grid.VCToViewing(vcOwner);
-            ++sendCounts[owners[k]];
-        }
+        const int vcOwner =
+          grid.CoordsToVC
+          (colDist,rowDist,distRank,this->Root(),redundantRoot);
+        distToComm[distRank] =
+          (includeViewers ? grid.VCToViewing(vcOwner) : vcOwner);
     }
-    else
+    vector<Int> ownerHeights(colStride);
+    for (int rowOwner=0; rowOwner<colStride; ++rowOwner)
+        ownerHeights[rowOwner] =
+          Length(this->Height(), rowOwner, this->ColAlign(), colStride);
+    const Int localHeight = this->LocalHeight();
+
+    // Bound the size of the temporary buffers by flushing the queue in
+    // chunks of at most RedistChunkSize() updates per process
+    const Int totalQueued = remoteUpdates_.size();
+    const Int chunkSize = Max(RedistChunkSize(), Int(1));
+    Int numChunks = (totalQueued+chunkSize-1) / chunkSize;
+    numChunks = mpi::AllReduce(numChunks, mpi::MAX, comm, cpu_si);
+
+    vector<int> owners;
+    vector<std::pair<std::uint64_t,T>> sortedUpdates;
+    vector<int> bucketSizes(commSize), bucketOffs;
+    vector<int> sendCounts(2*commSize), recvCounts(2*commSize);
+    vector<int> valueCounts(commSize), valueOffs, byteCounts(commSize), byteOffs;
+    vector<int> recvValueCounts(commSize), recvValueOffs;
+    vector<int> recvByteCounts(commSize), recvByteOffs;
+    vector<T> sendValues, recvValues;
+    vector<byte> sendBytes, recvBytes;
+    for (Int chunk=0; chunk<numChunks; ++chunk)
     {
+        const Int updateBeg = Min(chunk*chunkSize, totalQueued);
+        const Int updateEnd = Min(updateBeg+chunkSize, totalQueued);
+        const Int numUpdates = updateEnd - updateBeg;
+
+        // Bucket the updates by owner with a single counting-sort pass
+        // ============================================================
+        owners.resize(numUpdates);
+        sortedUpdates.resize(numUpdates);
+        std::fill(bucketSizes.begin(), bucketSizes.end(), 0);
+        for (Int k=0; k<numUpdates; ++k)
+        {
+            const Entry<T>& entry = remoteUpdates_[updateBeg+k];
+            const int rowOwner = this->RowOwner(entry.i);
+            const int colOwner = this->ColOwner(entry.j);
+            owners[k] = distToComm[rowOwner+colStride*colOwner];
+            ++bucketSizes[owners[k]];
+        }
+        Scan(bucketSizes, bucketOffs);
+        auto offs = bucketOffs;
+        for (Int k=0; k<numUpdates; ++k)
+        {
+            const Entry<T>& entry = remoteUpdates_[updateBeg+k];
+            const int rowOwner = this->RowOwner(entry.i);
+            const int colOwner = this->ColOwner(entry.j);
+            const std::uint64_t offset =
+              this->LocalRow(entry.i,rowOwner) +
+              std::uint64_t(this->LocalCol(entry.j,colOwner))*
+              ownerHeights[rowOwner];
+            sortedUpdates[offs[owners[k]]++] = {offset, entry.value};
+        }
+
+        // Coalesce duplicates and encode the sorted offsets as deltas
+        // ===========================================================
+        sendValues.clear();
+        sendBytes.clear();
+        for (int owner=0; owner<commSize; ++owner)
+        {
+            auto first = sortedUpdates.begin() + bucketOffs[owner];
+            auto last = first + bucketSizes[owner];
+            std::sort(
+              first, last,
+              [](const std::pair<std::uint64_t,T>& a,
+                 const std::pair<std::uint64_t,T>& b)
+              { return a.first < b.first; });
+            const std::size_t numValues = sendValues.size();
+            const std::size_t numBytes = sendBytes.size();
+            std::uint64_t prevOffset = 0;
+            while (first != last)
+            {
+                const std::uint64_t offset = first->first;
+                T value = first->second;
+                for (++first; first != last && first->first == offset; ++first)
+                    value += first->second;
+                EncodeOffsetDelta(offset-prevOffset, sendBytes);
+                sendValues.push_back(value);
+                prevOffset = offset;
+            }
+            valueCounts[owner] = sendValues.size() - numValues;
+            byteCounts[owner] = sendBytes.size() - numBytes;
+            sendCounts[2*owner] = valueCounts[owner];
+            sendCounts[2*owner+1] = byteCounts[owner];
+        }
+        Scan(valueCounts, valueOffs);
+        Scan(byteCounts, byteOffs);
+
+        // Exchange the data
+        // =================
+        mpi::AllToAll
+        (sendCounts.data(), 2, recvCounts.data(), 2, comm, cpu_si);
+        for (int q=0; q<commSize; ++q)
+        {
+            recvValueCounts[q] = recvCounts[2*q];
+            recvByteCounts[q] = recvCounts[2*q+1];
+        }
+        const int totalRecvValues = Scan(recvValueCounts, recvValueOffs);
+        const int totalRecvBytes = Scan(recvByteCounts, recvByteOffs);
+        recvValues.resize(totalRecvValues);
+        recvBytes.resize(totalRecvBytes);
+        mpi::AllToAll
+        (sendValues.data(), valueCounts.data(), valueOffs.data(),
+         recvValues.data(), recvValueCounts.data(), recvValueOffs.data(),
+         comm, cpu_si);
+        mpi::AllToAll
+        (sendBytes.data(), byteCounts.data(), byteOffs.data(),
+         recvBytes.data(), recvByteCounts.data(), recvByteOffs.data(),
+         comm, cpu_si);
         if (!this->Participating())
-            return;
-        const int vcSize = mpi::Size(grid.VCComm());
-        sendCounts.resize(vcSize,0);
-        for(Int k=0; k<totalSend; ++k)
+            continue;
+        if (RedundantSize() > 1)
         {
-            const Entry<T>& entry = remoteUpdates_[k];
-            const int distOwner = this->Owner(entry.i,entry.j);
-            owners[k] =
-              grid.CoordsToVC(colDist,rowDist,distOwner,redundantRoot);
-            ++sendCounts[owners[k]];
+            mpi::Broadcast
+            (recvValueCounts.data(), commSize, redundantRoot,
+             RedundantComm(), cpu_si);
+            Int recvSizes[2] = { Int(recvValues.size()), Int(recvBytes.size()) };
+            mpi::Broadcast(recvSizes, 2, redundantRoot, RedundantComm(), cpu_si);
+            recvValues.resize(recvSizes[0]);
+            recvBytes.resize(recvSizes[1]);
+            mpi::Broadcast
+            (recvValues.data(), recvSizes[0], redundantRoot,
+             RedundantComm(), cpu_si);
+            mpi::Broadcast
+            (recvBytes.data(), recvSizes[1], redundantRoot,
+             RedundantComm(), cpu_si);
         }
-    }
 
-    // Pack the data
-    // =============
-    vector<int> sendOffs;
-    Scan(sendCounts, sendOffs);
-    vector<Entry<T>> sendBuf(totalSend);
-    auto offs = sendOffs;
-    for(Int k=0; k<totalSend; ++k)
-        sendBuf[offs[owners[k]]++] = remoteUpdates_[k];
+        // Unpack the data
+        // ===============
+        const byte* bytes = recvBytes.data();
+        const T* values = recvValues.data();
+        for (int q=0; q<commSize; ++q)
+        {
+            std::uint64_t offset = 0;
+            for (int k=0; k<recvValueCounts[q]; ++k)
+            {
+                offset += DecodeOffsetDelta(bytes);
+                UpdateLocal(offset % localHeight, offset / localHeight, *values++);
+            }
+        }
+    }
     SwapClear(remoteUpdates_);
-
-    // Exchange and unpack the data
-    // ============================
-    SyncInfo<Device::CPU> cpu_si;
-    auto recvBuf = mpi::AllToAll(sendBuf, sendCounts, sendOffs, comm);
-    Int recvBufSize = recvBuf.size();
-    mpi::Broadcast(recvBufSize, redundantRoot, RedundantComm(), cpu_si);
-    recvBuf.resize(recvBufSize);
-    mpi::Broadcast(
-        recvBuf.data(), recvBufSize, redundantRoot, RedundantComm(), cpu_si);
-    // TODO: Make this loop faster
-    for(const auto& entry : recvBuf)
-        UpdateLocal(this->LocalRow(entry.i), this->LocalCol(entry.j),
-                    entry.value);
 }
 
 template <typename T, Device D>
@@ -785,8 +944,6 @@ void DM::ProcessPullQueue(T* pullBuf, bool includeViewers) const
     const int root = this->Root();
     const Int totalRecv = remotePulls_.size();
 
-    LogicError("Test.");
-
     // Compute the metadata
     // ====================
     mpi::Comm const& comm
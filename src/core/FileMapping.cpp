@@ -0,0 +1,152 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#ifdef HYDROGEN_HAVE_MMAP
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // HYDROGEN_HAVE_MMAP
+
+namespace El
+{
+namespace details
+{
+
+#ifdef HYDROGEN_HAVE_MMAP
+namespace
+{
+
+size_t PageSize()
+{
+    static const size_t pageSize = sysconf(_SC_PAGESIZE);
+    return pageSize;
+}
+
+int AdviceFlag(FileAccessHint hint)
+{
+    switch (hint)
+    {
+    case FILE_ACCESS_NORMAL:     return MADV_NORMAL;
+    case FILE_ACCESS_SEQUENTIAL: return MADV_SEQUENTIAL;
+    case FILE_ACCESS_RANDOM:     return MADV_RANDOM;
+    case FILE_ACCESS_WILL_NEED:  return MADV_WILLNEED;
+    case FILE_ACCESS_DONT_NEED:  return MADV_DONTNEED;
+    default: LogicError("Invalid file access hint");
+    }
+    return MADV_NORMAL;
+}
+
+} // namespace <anonymous>
+#endif // HYDROGEN_HAVE_MMAP
+
+void* MapFile(
+    std::string const& filename, size_t offset, size_t numBytes,
+    FileMapMode mode, void*& mapBase, size_t& mapBytes)
+{
+    EL_DEBUG_CSE;
+    mapBase = nullptr;
+    mapBytes = 0;
+#ifdef HYDROGEN_HAVE_MMAP
+    const int fd =
+      open(filename.c_str(), mode == FILE_MAP_SHARED ? O_RDWR : O_RDONLY);
+    if (fd < 0)
+        RuntimeError("Could not open ",filename,": ",std::strerror(errno));
+    struct stat info;
+    if (fstat(fd, &info) != 0)
+    {
+        const int error = errno;
+        close(fd);
+        RuntimeError("Could not stat ",filename,": ",std::strerror(error));
+    }
+    if (offset+numBytes > size_t(info.st_size))
+    {
+        close(fd);
+        RuntimeError
+        (filename," holds ",info.st_size," bytes but bytes [",offset,",",
+         offset+numBytes,") were requested");
+    }
+    if (numBytes == 0)
+    {
+        close(fd);
+        return nullptr;
+    }
+
+    // mmap requires a page-aligned file offset, so map from the enclosing
+    // page boundary and hand back a pointer to the requested byte
+    const size_t pageOffset = offset % PageSize();
+    const int protection =
+      ( mode == FILE_MAP_READ_ONLY ? PROT_READ : PROT_READ|PROT_WRITE );
+    const int flags =
+      ( mode == FILE_MAP_COPY_ON_WRITE ? MAP_PRIVATE : MAP_SHARED );
+    void* base =
+      mmap
+      (nullptr, numBytes+pageOffset, protection, flags, fd,
+       off_t(offset-pageOffset));
+    const int error = errno;
+    // The mapping holds its own reference to the file
+    close(fd);
+    if (base == MAP_FAILED)
+        RuntimeError("Could not map ",filename,": ",std::strerror(error));
+
+    mapBase = base;
+    mapBytes = numBytes+pageOffset;
+    return static_cast<char*>(base) + pageOffset;
+#else
+    RuntimeError("File-backed storage requires mmap support");
+    return nullptr;
+#endif // HYDROGEN_HAVE_MMAP
+}
+
+void UnmapFile(void* mapBase, size_t mapBytes) noexcept
+{
+#ifdef HYDROGEN_HAVE_MMAP
+    // This is called from destructors, and munmap can only fail on a
+    // range that was never mapped
+    if (mapBase != nullptr)
+        munmap(mapBase, mapBytes);
+#endif // HYDROGEN_HAVE_MMAP
+}
+
+void AdviseFile(
+    void* mapBase, size_t mapBytes,
+    void const* first, size_t numBytes, FileAccessHint hint)
+{
+    EL_DEBUG_CSE;
+#ifdef HYDROGEN_HAVE_MMAP
+    if (mapBase == nullptr || numBytes == 0)
+        return;
+    // Widen the range to whole pages, clipped to the mapping
+    char* mapBegin = static_cast<char*>(mapBase);
+    char* mapEnd = mapBegin + mapBytes;
+    char* begin = const_cast<char*>(static_cast<char const*>(first));
+    char* end = std::min(begin+numBytes, mapEnd);
+    begin = mapBegin + ((begin-mapBegin) / PageSize()) * PageSize();
+    if (begin >= end)
+        return;
+    // Advice is only a hint, so a refusal is not an error
+    madvise(begin, end-begin, AdviceFlag(hint));
+#endif // HYDROGEN_HAVE_MMAP
+}
+
+void SyncFile(void* mapBase, size_t mapBytes)
+{
+    EL_DEBUG_CSE;
+#ifdef HYDROGEN_HAVE_MMAP
+    if (mapBase != nullptr && msync(mapBase, mapBytes, MS_SYNC) != 0)
+        RuntimeError("Could not flush file mapping: ",std::strerror(errno));
+#endif // HYDROGEN_HAVE_MMAP
+}
+
+} // namespace details
+} // namespace El
@@ -9,6 +9,7 @@
 */
 #include <El-lite.hpp>
 
+#include <limits>
 #include <memory>
 
 namespace El {
@@ -63,6 +64,43 @@ int Grid::DefaultHeight( int gridSize ) EL_NO_EXCEPT
     return gridHeight;
 }
 
+int Grid::TopologyAwareHeight
+( int gridSize, int ranksPerNode, const GridTopologyCtrl& ctrl ) EL_NO_EXCEPT
+{
+    // For m x n matrices on an r x c grid, a SUMMA-style algorithm sends
+    // (m/r)(c-1)/c words per process over the MR communicators and
+    // (n/c)(r-1)/r over the MC communicators. The 'onNode' communicators
+    // are intra-node when r (or c) divides the number of processes per
+    // node, and the other communicators only when there is a single node.
+    const double m = ctrl.aspectRatio;
+    const double n = 1;
+    const bool oneNode = ( ranksPerNode % gridSize == 0 );
+    int bestHeight = DefaultHeight( gridSize );
+    double bestCost = std::numeric_limits<double>::max();
+    for( int height=1; height<=gridSize; ++height )
+    {
+        if( gridSize % height != 0 )
+            continue;
+        const int width = gridSize / height;
+        const bool colsOnNode =
+          oneNode || ( ctrl.onNode == MC && ranksPerNode % height == 0 );
+        const bool rowsOnNode =
+          oneNode || ( ctrl.onNode == MR && ranksPerNode % width == 0 );
+        const double colCost = ( colsOnNode ? ctrl.intraNodeCost : 1. );
+        const double rowCost = ( rowsOnNode ? ctrl.intraNodeCost : 1. );
+        const double cost =
+          rowCost*(m/height)*(width-1)/width +
+          colCost*(n/width)*(height-1)/height;
+        // Ties are broken in favor of the shorter grid
+        if( cost < bestCost*(1-1e-12) )
+        {
+            bestCost = cost;
+            bestHeight = height;
+        }
+    }
+    return bestHeight;
+}
+
 Grid::Grid()
     : Grid{mpi::NewWorldComm()}
 {}
@@ -92,6 +130,62 @@ Grid::Grid(mpi::Comm comm, int height, GridOrder order)
     SetUpGrid();
 }
 
+Grid::Grid(mpi::Comm comm, const GridTopologyCtrl& ctrl, GridOrder order)
+    : haveViewers_(false),
+      order_(order),
+      viewingComm_{std::move(comm)}
+{
+    EL_DEBUG_CSE
+    if( ctrl.onNode != MC && ctrl.onNode != MR )
+        LogicError
+        ("Only the MC or MR communicator can be kept within a node, not ",
+         DistToString(ctrl.onNode));
+    if( ctrl.aspectRatio <= 0 || ctrl.intraNodeCost <= 0 )
+        LogicError
+        ("Invalid aspect ratio, ",ctrl.aspectRatio,", or intra-node cost, ",
+         ctrl.intraNodeCost);
+    size_ = mpi::Size( viewingComm_ );
+
+    // Every node holds a multiple of the GCD of the node sizes, so groups of
+    // consecutive processes in node-major order whose size divides it never
+    // straddle two nodes
+    mpi::NodeComms& nodeComms = mpi::GetNodeComms( viewingComm_ );
+    auto const& nodeOffsets = nodeComms.NodeOffsets();
+    int ranksPerNode = 0;
+    for( int node=0; node<nodeComms.NumNodes(); ++node )
+        ranksPerNode =
+          El::GCD( ranksPerNode, nodeOffsets[node+1]-nodeOffsets[node] );
+    height_ = TopologyAwareHeight( size_, ranksPerNode, ctrl );
+    const int width = size_ / height_;
+
+    // Assign the grid coordinates in node-major order, running fastest
+    // along the communicator that should stay on-node
+    const int position = nodeComms.Position()[mpi::Rank(viewingComm_)];
+    int mcRank, mrRank;
+    if( ctrl.onNode == MC )
+    {
+        mcRank = position % height_;
+        mrRank = position / height_;
+    }
+    else
+    {
+        mrRank = position % width;
+        mcRank = position / width;
+    }
+    const int placedRank =
+      ( order_ == COLUMN_MAJOR ? mcRank + mrRank*height_
+                               : mrRank + mcRank*width );
+    mpi::Comm placedComm;
+    mpi::Split( viewingComm_, 0, placedRank, placedComm );
+    mpi::Free( viewingComm_ );
+    viewingComm_ = std::move(placedComm);
+
+    mpi::CommGroup( viewingComm_, viewingGroup_ );
+    owningGroup_ = viewingGroup_;
+
+    SetUpGrid();
+}
+
 void Grid::SetUpGrid()
 {
     EL_DEBUG_CSE
@@ -223,6 +317,8 @@ void Grid::SetUpGrid()
 
 Grid::~Grid()
 {
+    // The layer grids only view duplicates of our communicators
+    replicationLayers_.clear();
     if( !mpi::Finalized() )
     {
 #ifdef EL_HAVE_SCALAPACK
@@ -390,6 +486,69 @@ int Grid::CoordsToVC
 int Grid::VCToViewing( int vcRank ) const EL_NO_EXCEPT
 { return vcToViewing_[vcRank]; }
 
+const Grid::ReplicationLayers&
+Grid::GetReplicationLayers( int depth ) const
+{
+    EL_DEBUG_CSE
+    auto it = replicationLayers_.find( depth );
+    if( it != replicationLayers_.end() )
+        return *it->second;
+
+    if( depth < 1 || size_ % depth != 0 )
+        LogicError
+        ("Replication depth, ",depth,", does not evenly divide grid size, ",
+         size_);
+    const int layerSize = size_ / depth;
+    const bool colMajor = (order_==COLUMN_MAJOR);
+
+    std::unique_ptr<ReplicationLayers> layers( new ReplicationLayers );
+    layers->layerGrids.resize( depth );
+    vector<int> ranks(layerSize);
+    for( int layer=0; layer<depth; ++layer )
+    {
+        // Translate the VC ranks of the layer into ranks of the owning group
+        for( int q=0; q<layerSize; ++q )
+        {
+            const int vcRank = layer*layerSize + q;
+            ranks[q] = ( colMajor ? vcRank : VCToVR(vcRank) );
+        }
+        mpi::Group layerGroup;
+        mpi::Incl( owningGroup_, layerSize, ranks.data(), layerGroup );
+        mpi::Comm viewers;
+        mpi::Dup( viewingComm_, viewers );
+        layers->layerGrids[layer].reset
+        ( new Grid
+          ( std::move(viewers), layerGroup, DefaultHeight(layerSize),
+            COLUMN_MAJOR ) );
+        mpi::Free( layerGroup );
+    }
+    if( InGrid() )
+        mpi::Split
+        ( vcComm_, vcRank_ % layerSize, vcRank_ / layerSize,
+          layers->depthComm );
+
+    auto& result = *layers;
+    replicationLayers_[depth] = std::move(layers);
+    return result;
+}
+
+const Grid& Grid::LayerGrid( int depth, int layer ) const
+{
+    EL_DEBUG_CSE
+    const auto& layers = GetReplicationLayers( depth );
+    EL_DEBUG_ONLY(
+      if( layer < 0 || layer >= depth )
+          LogicError("Layer ",layer," is out of bounds for depth ",depth);
+    )
+    return *layers.layerGrids[layer];
+}
+
+mpi::Comm const& Grid::DepthComm( int depth ) const
+{
+    EL_DEBUG_CSE
+    return GetReplicationLayers( depth ).depthComm;
+}
+
 mpi::Group Grid::OwningGroup() const EL_NO_EXCEPT { return owningGroup_; }
 mpi::Comm const& Grid::OwningComm()  const EL_NO_EXCEPT { return owningComm_; }
 mpi::Comm const& Grid::ViewingComm() const EL_NO_EXCEPT { return viewingComm_; }
@@ -28,6 +28,18 @@ size_t details::default_mempool_max_bin() noexcept
     return (env ? std::stoull(env) : (1 << 26));
 }
 
+size_t details::default_mempool_thread_cache() noexcept
+{
+    char const* const env = std::getenv("H_MEMPOOL_THREAD_CACHE");
+    return (env ? std::stoull(env) : 0UL);
+}
+
+size_t details::default_mempool_max_cached() noexcept
+{
+    char const* const env = std::getenv("H_MEMPOOL_MAX_CACHED");
+    return (env ? std::stoull(env) : 0UL);
+}
+
 namespace
 {
 #ifdef HYDROGEN_HAVE_GPU
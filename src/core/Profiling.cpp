@@ -1,5 +1,13 @@
+#include <algorithm>
 #include <array>
 #include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
 #include <stdexcept>
 
 #include "El/hydrogen_config.h"
@@ -68,6 +76,96 @@ bool roctx_runtime_enabled = true;
 bool roctxRuntimeEnabled() noexcept { return roctx_runtime_enabled; }
 #endif
 
+// Built-in region statistics
+bool RegionStatisticsRequested() noexcept
+{
+    char const* const env = std::getenv("H_PROFILE");
+    return (env && std::strlen(env) && env[0] != '0');
+}
+
+std::atomic<bool> region_stats_enabled(RegionStatisticsRequested());
+
+// A region that is active on the calling thread
+struct RegionFrame
+{
+    std::string name;
+    Clock::time_point start;
+    bool recursive;
+    double child_time = 0.;
+    double comm_time = 0.;
+    size_t bytes_sent = 0;
+    size_t bytes_received = 0;
+};
+
+thread_local std::vector<RegionFrame> region_stack;
+
+std::mutex region_stats_mutex;
+std::map<std::string, RegionStatistics> region_stats;
+RegionStatistics total_stats;
+Clock::time_point region_stats_start = Clock::now();
+
+double Seconds(Clock::duration d) noexcept
+{
+    return std::chrono::duration<double>(d).count();
+}
+
+void BeginRegionStatistics(char const* s) noexcept
+{
+    try
+    {
+        bool recursive = false;
+        for (auto const& frame : region_stack)
+            recursive = recursive || frame.name == s;
+        region_stack.push_back(RegionFrame{s, Clock::now(), recursive});
+    }
+    catch (...) {}
+}
+
+void EndRegionStatistics(char const* s) noexcept
+{
+    // Regions begun while the statistics were disabled are not on the
+    // stack, so only pop a matching frame
+    if (region_stack.empty() || region_stack.back().name != s)
+        return;
+    RegionFrame frame = std::move(region_stack.back());
+    region_stack.pop_back();
+    double const inclusive_time = Seconds(Clock::now() - frame.start);
+    if (!region_stack.empty())
+    {
+        auto& parent = region_stack.back();
+        parent.child_time += inclusive_time;
+        parent.comm_time += frame.comm_time;
+        parent.bytes_sent += frame.bytes_sent;
+        parent.bytes_received += frame.bytes_received;
+    }
+    try
+    {
+        std::lock_guard<std::mutex> lock(region_stats_mutex);
+        auto& stats = region_stats[frame.name];
+        ++stats.calls;
+        stats.exclusive_time += inclusive_time - frame.child_time;
+        if (!frame.recursive)
+        {
+            stats.inclusive_time += inclusive_time;
+            stats.comm_time += frame.comm_time;
+            stats.bytes_sent += frame.bytes_sent;
+            stats.bytes_received += frame.bytes_received;
+        }
+    }
+    catch (...) {}
+}
+
+void PrintStatisticsHeader(std::ostream& os)
+{
+    os << std::left << std::setw(32) << "region" << std::right
+       << std::setw(10) << "calls"
+       << std::setw(14) << "incl (s)"
+       << std::setw(14) << "excl (s)"
+       << std::setw(14) << "comm (s)"
+       << std::setw(16) << "sent (B)"
+       << std::setw(16) << "recv (B)" << "\n";
+}
+
 }// namespace <anon>
 
 void EnableVTune() noexcept
@@ -112,6 +210,186 @@ void DisableROCTX() noexcept
 #endif // HYDROGEN_HAVE_ROCTRACER
 }
 
+void EnableRegionStatistics() noexcept
+{
+    region_stats_enabled = true;
+}
+
+void DisableRegionStatistics() noexcept
+{
+    region_stats_enabled = false;
+}
+
+bool RegionStatisticsEnabled() noexcept
+{
+    return region_stats_enabled.load(std::memory_order_relaxed);
+}
+
+void ResetRegionStatistics() noexcept
+{
+    std::lock_guard<std::mutex> lock(region_stats_mutex);
+    region_stats.clear();
+    total_stats = RegionStatistics{};
+    region_stats_start = Clock::now();
+}
+
+std::vector<RegionStatistics> GetRegionStatistics()
+{
+    std::lock_guard<std::mutex> lock(region_stats_mutex);
+    std::vector<RegionStatistics> stats;
+    stats.reserve(region_stats.size()+1);
+    for (auto const& entry : region_stats)
+    {
+        stats.push_back(entry.second);
+        stats.back().name = entry.first;
+    }
+    stats.push_back(total_stats);
+    stats.back().name = "[total]";
+    stats.back().inclusive_time = Seconds(Clock::now() - region_stats_start);
+    return stats;
+}
+
+void PrintRegionStatistics(std::ostream& os)
+{
+    auto stats = GetRegionStatistics();
+    std::stable_sort(
+        stats.begin(), stats.end()-1,
+        [](RegionStatistics const& a, RegionStatistics const& b)
+        { return a.inclusive_time > b.inclusive_time; });
+    std::ostringstream oss;
+    PrintStatisticsHeader(oss);
+    for (auto const& region : stats)
+        oss << std::left << std::setw(32) << region.name << std::right
+            << std::setw(10) << region.calls
+            << std::fixed << std::setprecision(6)
+            << std::setw(14) << region.inclusive_time
+            << std::setw(14) << region.exclusive_time
+            << std::setw(14) << region.comm_time
+            << std::setw(16) << region.bytes_sent
+            << std::setw(16) << region.bytes_received << "\n";
+    os << oss.str() << std::flush;
+}
+
+void ReportRegionStatistics(mpi::Comm const& comm, std::ostream& os)
+{
+    // Do not account for the reduction itself
+    bool const enabled = region_stats_enabled.exchange(false);
+    auto const stats = GetRegionStatistics();
+    int const commRank = mpi::Rank(comm);
+    int const commSize = mpi::Size(comm);
+    SyncInfo<Device::CPU> syncInfo;
+
+    // Form the union of the region names (excluding the total)
+    std::vector<byte> names;
+    for (auto it = stats.begin(); it != stats.end()-1; ++it)
+    {
+        names.insert(names.end(), it->name.begin(), it->name.end());
+        names.push_back(0);
+    }
+    int const numBytes = names.size();
+    std::vector<int> recvCounts(commSize), recvDispls(commSize);
+    mpi::AllGather(&numBytes, 1, recvCounts.data(), 1, comm, syncInfo);
+    int const totalBytes = Scan(recvCounts, recvDispls);
+    std::vector<byte> allNames(totalBytes);
+    mpi::AllGather(
+        names.data(), numBytes,
+        allNames.data(), recvCounts.data(), recvDispls.data(),
+        comm, syncInfo);
+    std::set<std::string> nameSet;
+    for (int offset=0; offset<totalBytes; )
+    {
+        std::string name(reinterpret_cast<char const*>(&allNames[offset]));
+        offset += name.size() + 1;
+        nameSet.insert(std::move(name));
+    }
+    std::vector<std::string> regionNames(nameSet.begin(), nameSet.end());
+    regionNames.push_back("[total]");
+
+    // Reduce the calls, times and volumes of every region
+    constexpr int numFields = 6;
+    int const numRegions = regionNames.size();
+    std::vector<double> values(numFields*numRegions, 0.);
+    for (auto const& region : stats)
+    {
+        auto const index =
+          std::lower_bound(regionNames.begin(), regionNames.end()-1,
+                           region.name) - regionNames.begin();
+        double* v = &values[numFields*index];
+        v[0] = region.calls;
+        v[1] = region.inclusive_time;
+        v[2] = region.exclusive_time;
+        v[3] = region.comm_time;
+        v[4] = region.bytes_sent;
+        v[5] = region.bytes_received;
+    }
+    std::vector<double> minValues(values.size()), maxValues(values.size()),
+      sumValues(values.size());
+    mpi::Reduce(values.data(), minValues.data(), values.size(), mpi::MIN, 0,
+                comm, syncInfo);
+    mpi::Reduce(values.data(), maxValues.data(), values.size(), mpi::MAX, 0,
+                comm, syncInfo);
+    mpi::Reduce(values.data(), sumValues.data(), values.size(), mpi::SUM, 0,
+                comm, syncInfo);
+
+    if (commRank == 0)
+    {
+        std::ostringstream oss;
+        oss << "Region statistics over " << commSize
+            << " processes (min / avg / max)\n";
+        for (int region=0; region<numRegions; ++region)
+        {
+            oss << regionNames[region] << "\n";
+            char const* fieldNames[numFields] =
+              { "calls", "incl (s)", "excl (s)", "comm (s)",
+                "sent (B)", "recv (B)" };
+            for (int field=0; field<numFields; ++field)
+            {
+                int const k = numFields*region + field;
+                oss << "  " << std::left << std::setw(10) << fieldNames[field]
+                    << std::right << std::setprecision(6)
+                    << std::setw(16) << minValues[k]
+                    << std::setw(16) << sumValues[k]/commSize
+                    << std::setw(16) << maxValues[k] << "\n";
+            }
+            double const inclusive = sumValues[numFields*region+1];
+            if (inclusive > 0.)
+                oss << "  " << std::left << std::setw(10) << "comm (%)"
+                    << std::right << std::setw(32)
+                    << 100*sumValues[numFields*region+3]/inclusive << "\n";
+        }
+        os << oss.str() << std::flush;
+    }
+    region_stats_enabled = enabled;
+}
+
+CommunicationProfile::~CommunicationProfile() noexcept
+{
+    if (!active_)
+        return;
+    double const comm_time = Seconds(Clock::now() - start_);
+    if (!region_stack.empty())
+    {
+        auto& frame = region_stack.back();
+        frame.comm_time += comm_time;
+        frame.bytes_sent += bytes_sent_;
+        frame.bytes_received += bytes_received_;
+    }
+    std::lock_guard<std::mutex> lock(region_stats_mutex);
+    ++total_stats.calls;
+    total_stats.comm_time += comm_time;
+    total_stats.bytes_sent += bytes_sent_;
+    total_stats.bytes_received += bytes_received_;
+}
+
+void CommunicationProfile::Start(
+    size_t bytes_sent, size_t bytes_received) noexcept
+{
+    active_ = true;
+    bytes_sent_ = bytes_sent;
+    bytes_received_ = bytes_received;
+    start_ = Clock::now();
+}
+
 Color GetNextProfilingColor() noexcept
 {
     auto id = current_color.fetch_add(1, std::memory_order_relaxed);
@@ -120,6 +398,9 @@ Color GetNextProfilingColor() noexcept
 
 void BeginRegionProfile(char const* s, Color c) noexcept
 {
+    if (RegionStatisticsEnabled())
+        BeginRegionStatistics(s);
+
 #ifdef HYDROGEN_HAVE_ROCTRACER
     if (roctxRuntimeEnabled())
         roctxRangePush(s);
@@ -159,8 +440,10 @@ void BeginRegionProfile(char const* s, Color c) noexcept
     (void) c;
 }
 
-void EndRegionProfile(const char *) noexcept
+void EndRegionProfile(const char* s) noexcept
 {
+    EndRegionStatistics(s);
+
 #ifdef HYDROGEN_HAVE_ROCTRACER
     if (roctxRuntimeEnabled())
         roctxRangePop();
@@ -10,12 +10,14 @@
 #include <El-lite.hpp>
 
 #include <El/hydrogen_config.h>
+#include <El/core/Profiling.hpp>
 
 #ifdef HYDROGEN_HAVE_GPU
 #include <hydrogen/device/GPU.hpp>
 #endif // HYDROGEN_HAVE_GPU
 
 #include <algorithm>
+#include <fstream>
 #include <set>
 
 namespace {
@@ -346,6 +348,20 @@ void Finalize()
         delete ::args;
         ::args = 0;
 
+        if( RegionStatisticsEnabled() && !mpi::Finalized() )
+        {
+            // Each process may also write its own statistics to
+            // env(H_PROFILE_OUTPUT).<rank>
+            const char* output = std::getenv("H_PROFILE_OUTPUT");
+            if( output && std::strlen(output) )
+            {
+                std::ofstream file
+                ( std::string(output)+"."+std::to_string(mpi::Rank()) );
+                PrintRegionStatistics( file );
+            }
+            ReportRegionStatistics( mpi::COMM_WORLD, cout );
+        }
+
         Grid::FinalizeDefault();
         Grid::FinalizeTrivial();
 
@@ -44,6 +44,114 @@ void EL_BLAS(zgemm)
 namespace El {
 namespace blas {
 
+namespace packed_gemm {
+
+// Blocking parameters for the generic (non-BLAS) Gemm. Following the
+// GotoBLAS/BLIS scheme, a KC x NC panel of op(B) is packed once and shared
+// by all threads, each thread packs MC x KC blocks of op(A), and an
+// MR x NR micro-kernel accumulates into a small block of C. The register
+// blocking is kept small since the element types which reach this code
+// (e.g., DoubleDouble or BigFloat) are emulated in software.
+template<typename T>
+struct Blocksizes
+{
+    static constexpr BlasInt MR = 4;
+    static constexpr BlasInt NR = 4;
+    static constexpr BlasInt MC = 96;
+    static constexpr BlasInt KC = 256;
+    static constexpr BlasInt NC = 1024;
+};
+
+// Pack the mc x kc block of op(A) whose top-left entry is pointed to by A
+// into row panels of height MR, each stored as kc consecutive columns of
+// length MR. The last panel is padded with zeros.
+template<typename T>
+void PackA
+( bool trans, bool conj,
+  BlasInt mc, BlasInt kc,
+  const T* A, BlasInt ALDim,
+        T* Ap )
+{
+    constexpr BlasInt MR = Blocksizes<T>::MR;
+    for( BlasInt ir=0; ir<mc; ir+=MR )
+    {
+        const BlasInt mr = Min(MR,mc-ir);
+        for( BlasInt l=0; l<kc; ++l )
+        {
+            for( BlasInt i=0; i<mr; ++i )
+            {
+                const T& alpha =
+                  ( trans ? A[l+(ir+i)*ALDim] : A[(ir+i)+l*ALDim] );
+                if( conj )
+                    Conj( alpha, Ap[i] );
+                else
+                    Ap[i] = alpha;
+            }
+            for( BlasInt i=mr; i<MR; ++i )
+                Ap[i] = TypeTraits<T>::Zero();
+            Ap += MR;
+        }
+    }
+}
+
+// Pack the kc x nc block of op(B) whose top-left entry is pointed to by B
+// into column panels of width NR, each stored as kc consecutive rows of
+// length NR. The last panel is padded with zeros.
+template<typename T>
+void PackB
+( bool trans, bool conj,
+  BlasInt kc, BlasInt nc,
+  const T* B, BlasInt BLDim,
+        T* Bp )
+{
+    constexpr BlasInt NR = Blocksizes<T>::NR;
+    for( BlasInt jr=0; jr<nc; jr+=NR )
+    {
+        const BlasInt nr = Min(NR,nc-jr);
+        for( BlasInt l=0; l<kc; ++l )
+        {
+            for( BlasInt j=0; j<nr; ++j )
+            {
+                const T& beta =
+                  ( trans ? B[(jr+j)+l*BLDim] : B[l+(jr+j)*BLDim] );
+                if( conj )
+                    Conj( beta, Bp[j] );
+                else
+                    Bp[j] = beta;
+            }
+            for( BlasInt j=nr; j<NR; ++j )
+                Bp[j] = TypeTraits<T>::Zero();
+            Bp += NR;
+        }
+    }
+}
+
+// Form the MR x NR product of a packed row panel of op(A) and a packed
+// column panel of op(B) in the (column-major) accumulator.
+template<typename T,BlasInt MR,BlasInt NR>
+void MicroKernel
+( BlasInt kc, const T* Ap, const T* Bp, T* acc, T& delta )
+{
+    for( BlasInt i=0; i<MR*NR; ++i )
+        acc[i] = TypeTraits<T>::Zero();
+    for( BlasInt l=0; l<kc; ++l )
+    {
+        for( BlasInt j=0; j<NR; ++j )
+        {
+            for( BlasInt i=0; i<MR; ++i )
+            {
+                delta = Ap[i];
+                delta *= Bp[j];
+                acc[i+j*MR] += delta;
+            }
+        }
+        Ap += MR;
+        Bp += NR;
+    }
+}
+
+} // namespace packed_gemm
+
 template<typename T>
 void Gemm
 ( char transA, char transB,
@@ -77,184 +185,74 @@ void Gemm
             for( BlasInt i=0; i<m; ++i )
                 C[i+j*CLDim] *= beta;
     }
+    if( m == 0 || n == 0 || k == 0 || alpha == TypeTraits<T>::Zero() )
+        return;
 
-    // Naive implementation
-    T gamma, delta;
-    if( std::toupper(transA) == 'N' && std::toupper(transB) == 'N' )
-    {
-        // C := alpha A B + C
-        for( BlasInt j=0; j<n; ++j )
-        {
-            for( BlasInt l=0; l<k; ++l )
-            {
-                gamma = alpha;
-                gamma *= B[l+j*BLDim];
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    delta = A[i+l*ALDim];
-                    delta *= gamma;
-                    C[i+j*CLDim] += delta;
-                }
-            }
-        }
-    }
-    else if( std::toupper(transA) == 'N' )
-    {
-        if( std::toupper(transB) == 'T' )
-        {
-            // C := alpha A B^T + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt l=0; l<k; ++l )
-                {
-                    gamma = alpha;
-                    gamma *= B[j+l*BLDim];
-                    for( BlasInt i=0; i<m; ++i )
-                    {
-                        delta = A[i+l*ALDim];
-                        delta *= gamma;
-                        C[i+j*CLDim] += delta;
-                    }
-                }
-            }
-        }
-        else
-        {
-            // C := alpha A B^H + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt l=0; l<k; ++l )
-                {
-                    Conj( B[j+l*BLDim], gamma );
-                    gamma *= alpha;
-                    for( BlasInt i=0; i<m; ++i )
-                    {
-                        delta = A[i+l*ALDim];
-                        delta *= gamma;
-                        C[i+j*CLDim] += delta;
-                    }
-                }
-            }
-        }
-    }
-    else if( std::toupper(transB) == 'N' )
-    {
-        if( std::toupper(transA) == 'T' )
-        {
-            // C := alpha A^T B + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = TypeTraits<T>::Zero();
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        delta = A[l+i*ALDim];
-                        delta *= B[l+j*BLDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-        else
-        {
-            // C := alpha A^H B + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = TypeTraits<T>::Zero();
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        Conj( A[l+i*ALDim], delta );
-                        delta *= B[l+j*BLDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-    }
-    else
+    // Packed, cache-blocked implementation of C := alpha op(A) op(B) + C
+    using packed_gemm::Blocksizes;
+    constexpr BlasInt MR = Blocksizes<T>::MR;
+    constexpr BlasInt NR = Blocksizes<T>::NR;
+    constexpr BlasInt MC = Blocksizes<T>::MC;
+    constexpr BlasInt KC = Blocksizes<T>::KC;
+    constexpr BlasInt NC = Blocksizes<T>::NC;
+    const bool transposeA = ( std::toupper(transA) != 'N' );
+    const bool conjugateA = ( std::toupper(transA) == 'C' );
+    const bool transposeB = ( std::toupper(transB) != 'N' );
+    const bool conjugateB = ( std::toupper(transB) == 'C' );
+    const bool unitAlpha = ( alpha == TypeTraits<T>::One() );
+    const BlasInt numRowBlocks = (m+MC-1) / MC;
+
+    std::vector<T> Bp( Min(NC,((n+NR-1)/NR)*NR)*Min(KC,k) );
+    for( BlasInt jc=0; jc<n; jc+=NC )
     {
-        if( std::toupper(transA) == 'T' && std::toupper(transB) == 'T' )
+        const BlasInt nc = Min(NC,n-jc);
+        for( BlasInt pc=0; pc<k; pc+=KC )
         {
-            // C := alpha A^T B^T + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = TypeTraits<T>::Zero();
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        delta = A[l+i*ALDim];
-                        delta *= B[j+l*BLDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-        else if( std::toupper(transA) == 'T' )
-        {
-            // C := alpha A^T B^H + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = TypeTraits<T>::Zero();
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        Conj( B[j+l*BLDim], delta );
-                        delta *= A[l+i*ALDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-        else if( std::toupper(transB) == 'T' )
-        {
-            // C := alpha A^H B^T + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = TypeTraits<T>::Zero();
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        Conj( A[l+i*ALDim], delta );
-                        delta *= B[j+l*BLDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-        else
-        {
-            // C := alpha A^H B^H + C
-            T phi;
-            for( BlasInt j=0; j<n; ++j )
+            const BlasInt kc = Min(KC,k-pc);
+            const T* BBlock =
+              ( transposeB ? &B[jc+pc*BLDim] : &B[pc+jc*BLDim] );
+            packed_gemm::PackB
+            ( transposeB, conjugateB, kc, nc, BBlock, BLDim, Bp.data() );
+
+            EL_OUTER_PARALLEL_FOR
+            for( BlasInt icBlock=0; icBlock<numRowBlocks; ++icBlock )
             {
-                for( BlasInt i=0; i<m; ++i )
+                const BlasInt ic = icBlock*MC;
+                const BlasInt mc = Min(MC,m-ic);
+                const T* ABlock =
+                  ( transposeA ? &A[pc+ic*ALDim] : &A[ic+pc*ALDim] );
+                std::vector<T> Ap( ((mc+MR-1)/MR)*MR*kc ), acc( MR*NR );
+                T delta;
+                packed_gemm::PackA
+                ( transposeA, conjugateA, mc, kc, ABlock, ALDim, Ap.data() );
+
+                for( BlasInt jr=0; jr<nc; jr+=NR )
                 {
-                    gamma = TypeTraits<T>::Zero();
-                    for( BlasInt l=0; l<k; ++l )
+                    const BlasInt nr = Min(NR,nc-jr);
+                    for( BlasInt ir=0; ir<mc; ir+=MR )
                     {
-                        Conj( A[l+i*ALDim], delta );
-                        Conj( B[j+l*BLDim], phi );
-                        delta *= phi;
-                        gamma += delta;
+                        const BlasInt mr = Min(MR,mc-ir);
+                        packed_gemm::MicroKernel<T,MR,NR>
+                        ( kc, &Ap[ir*kc], &Bp[jr*kc], acc.data(), delta );
+
+                        T* CBlock = &C[(ic+ir)+(jc+jr)*CLDim];
+                        for( BlasInt j=0; j<nr; ++j )
+                        {
+                            for( BlasInt i=0; i<mr; ++i )
+                            {
+                                if( unitAlpha )
+                                {
+                                    CBlock[i+j*CLDim] += acc[i+j*MR];
+                                }
+                                else
+                                {
+                                    delta = acc[i+j*MR];
+                                    delta *= alpha;
+                                    CBlock[i+j*CLDim] += delta;
+                                }
+                            }
+                        }
                     }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
                 }
             }
         }
@@ -57,6 +57,20 @@ const Op BINARY_AND = MPI_BAND;
 const Op BINARY_OR = MPI_BOR;
 const Op BINARY_XOR = MPI_BXOR;
 
+namespace {
+
+// The number of entries described by a vector of counts, for the
+// communication profile
+size_t SumCounts(const int* counts, int numCounts) EL_NO_EXCEPT
+{
+    size_t sum = 0;
+    for (int q=0; q<numCounts; ++q)
+        sum += counts[q];
+    return sum;
+}
+
+}// namespace <anon>
+
 bool CommSameSizeAsInteger() EL_NO_EXCEPT
 { return sizeof(MPI_Comm) == sizeof(int); }
 
@@ -438,6 +452,7 @@ void Translate(
 void Barrier( Comm const& comm ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(0, 0);
     EL_CHECK_MPI_CALL( MPI_Barrier( comm.GetMPIComm() ) );
 }
 
@@ -467,6 +482,7 @@ template <typename T,
 void Wait( Request<T>& request, Status& status ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(0, 0);
     EL_CHECK_MPI_CALL( MPI_Wait( &request.backend, &status ) );
 }
 
@@ -486,6 +502,7 @@ void WaitAll( int numRequests, Request<T>* requests, Status* statuses )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(0, 0);
 #ifndef EL_MPI_REQUEST_IS_NOT_POINTER
     // Both MPICH and OpenMPI define MPI_Request to be a pointer to a structure,
     // which implies that the following code is legal. AFAIK, there are not
@@ -514,6 +531,7 @@ template <typename T,
 void Wait( Request<T>& request, Status& status ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(0, 0);
     EL_CHECK_MPI_CALL( MPI_Wait( &request.backend, &status ) );
     if( request.receivingPacked )
     {
@@ -531,6 +549,7 @@ void WaitAll( int numRequests, Request<T>* requests, Status* statuses )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(0, 0);
 #ifndef EL_MPI_REQUEST_IS_NOT_POINTER
     // Both MPICH and OpenMPI define MPI_Request to be a pointer to a structure,
     // which implies that the following code is legal. AFAIK, there are not
@@ -594,6 +613,7 @@ void TaggedSend(const Real* buf, int count, int to, int tag, Comm const& comm,
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(size_t(count)*sizeof(*buf), 0);
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_SEND_BUFFER(buf, count, syncInfo);
@@ -614,6 +634,7 @@ void TaggedSend(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(size_t(count)*sizeof(*buf), 0);
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_SEND_BUFFER(buf, count, syncInfo);
@@ -639,6 +660,7 @@ void TaggedSend( const T* buf, int count, int to, int tag, Comm const& comm,
     EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(size_t(count)*sizeof(*buf), 0);
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_SEND_BUFFER(buf, count, syncInfo);
@@ -676,6 +698,7 @@ void TaggedISend
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(size_t(count)*sizeof(*buf), 0);
     EL_CHECK_MPI_CALL
     ( MPI_Isend
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to,
@@ -689,6 +712,7 @@ void TaggedISend
   Request<Complex<Real>>& request ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(size_t(count)*sizeof(*buf), 0);
 #ifdef EL_AVOID_COMPLEX_MPI
     EL_CHECK_MPI_CALL
     ( MPI_Isend
@@ -710,6 +734,7 @@ void TaggedISend
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(size_t(count)*sizeof(*buf), 0);
     Serialize( count, buf, request.buffer );
     EL_CHECK_MPI_CALL
     ( MPI_Isend
@@ -741,6 +766,7 @@ void TaggedIRSend
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(size_t(count)*sizeof(*buf), 0);
     EL_CHECK_MPI_CALL
     ( MPI_Irsend
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to,
@@ -754,6 +780,7 @@ void TaggedIRSend
   Request<Complex<Real>>& request ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(size_t(count)*sizeof(*buf), 0);
 #ifdef EL_AVOID_COMPLEX_MPI
     EL_CHECK_MPI_CALL
     ( MPI_Irsend
@@ -776,6 +803,7 @@ void TaggedIRSend
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(size_t(count)*sizeof(*buf), 0);
     Serialize( count, buf, request.buffer );
     EL_CHECK_MPI_CALL
     ( MPI_Irsend
@@ -806,6 +834,7 @@ void TaggedISSend
   Request<Real>& request ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(size_t(count)*sizeof(*buf), 0);
     EL_CHECK_MPI_CALL
     ( MPI_Issend
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to,
@@ -819,6 +848,7 @@ void TaggedISSend
   Request<Complex<Real>>& request ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(size_t(count)*sizeof(*buf), 0);
 #ifdef EL_AVOID_COMPLEX_MPI
     EL_CHECK_MPI_CALL
     ( MPI_Issend
@@ -840,6 +870,7 @@ void TaggedISSend
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(size_t(count)*sizeof(*buf), 0);
     Serialize( count, buf, request.buffer );
     EL_CHECK_MPI_CALL
     ( MPI_Issend
@@ -863,6 +894,7 @@ void TaggedRecv( Real* buf, int count, int from, int tag, Comm const& comm,
                  SyncInfo<D> const& syncInfo ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(0, size_t(count)*sizeof(*buf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_RECV_BUFFER(buf, count, syncInfo);
@@ -882,6 +914,7 @@ void TaggedRecv( Complex<Real>* buf, int count, int from, int tag, Comm const& c
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(0, size_t(count)*sizeof(*buf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_RECV_BUFFER(buf, count, syncInfo);
@@ -910,6 +943,7 @@ void TaggedRecv( T* buf, int count, int from, int tag, Comm const& comm,
     EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(0, size_t(count)*sizeof(*buf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_RECV_BUFFER(buf, count, syncInfo);
@@ -953,6 +987,7 @@ void TaggedIRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(0, size_t(count)*sizeof(*buf));
     EL_CHECK_MPI_CALL
     ( MPI_Irecv
       ( buf, count, TypeMap<Real>(), from, tag, comm.GetMPIComm(), &request.backend ) );
@@ -966,6 +1001,7 @@ void TaggedIRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(0, size_t(count)*sizeof(*buf));
 #ifdef EL_AVOID_COMPLEX_MPI
     EL_CHECK_MPI_CALL
     ( MPI_Irecv
@@ -987,6 +1023,7 @@ void TaggedIRecv
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(0, size_t(count)*sizeof(*buf));
     request.receivingPacked = true;
     request.recvCount = count;
     request.unpackedRecvBuf = buf;
@@ -1021,6 +1058,9 @@ void TaggedSendRecv(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        size_t(sc)*sizeof(*sbuf),
+        size_t(rc)*sizeof(*rbuf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_SEND_BUFFER(sbuf, sc, syncInfo);
@@ -1046,6 +1086,9 @@ void TaggedSendRecv(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        size_t(sc)*sizeof(*sbuf),
+        size_t(rc)*sizeof(*rbuf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_SEND_BUFFER(sbuf, sc, syncInfo);
@@ -1080,6 +1123,9 @@ void TaggedSendRecv(
     EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        size_t(sc)*sizeof(*sbuf),
+        size_t(rc)*sizeof(*rbuf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_SEND_BUFFER(sbuf, sc, syncInfo);
@@ -1126,6 +1172,9 @@ void TaggedSendRecv(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*sizeof(*buf),
+        size_t(count)*sizeof(*buf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_INPLACE_BUFFER(buf, count, syncInfo);
@@ -1148,6 +1197,9 @@ void TaggedSendRecv(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*sizeof(*buf),
+        size_t(count)*sizeof(*buf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_INPLACE_BUFFER(buf, count, syncInfo);
@@ -1178,6 +1230,9 @@ void TaggedSendRecv(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*sizeof(*buf),
+        size_t(count)*sizeof(*buf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_INPLACE_BUFFER(buf, count, syncInfo);
@@ -1208,6 +1263,9 @@ void IBroadcast
 ( Real* buf, int count, int root, Comm const& comm, Request<Real>& request )
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        size_t(Rank(comm) == root ? count : 0)*sizeof(*buf),
+        size_t(Rank(comm) == root ? 0 : count)*sizeof(*buf));
     EL_CHECK_MPI_CALL
     ( MPI_Ibcast
       ( buf, count, TypeMap<Real>(), root, comm.GetMPIComm(), &request.backend ) );
@@ -1220,6 +1278,9 @@ void IBroadcast
   Request<Complex<Real>>& request )
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        size_t(Rank(comm) == root ? count : 0)*sizeof(*buf),
+        size_t(Rank(comm) == root ? 0 : count)*sizeof(*buf));
 #ifdef EL_AVOID_COMPLEX_MPI
     EL_CHECK_MPI_CALL
     ( MPI_Ibcast
@@ -1239,6 +1300,9 @@ void IBroadcast
 ( T* buf, int count, int root, Comm const& comm, Request<T>& request )
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        size_t(Rank(comm) == root ? count : 0)*sizeof(*buf),
+        size_t(Rank(comm) == root ? 0 : count)*sizeof(*buf));
     request.receivingPacked = true;
     request.recvCount = count;
     request.unpackedRecvBuf = buf;
@@ -1262,6 +1326,9 @@ void IGather
   Request<Real>& request )
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        size_t(sc)*sizeof(*sbuf),
+        size_t(Rank(comm) == root ? rc*Size(comm) : 0)*sizeof(*rbuf));
     EL_CHECK_MPI_CALL
     ( MPI_Igather
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1278,6 +1345,9 @@ void IGather
   Request<Complex<Real>>& request )
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        size_t(sc)*sizeof(*sbuf),
+        size_t(Rank(comm) == root ? rc*Size(comm) : 0)*sizeof(*rbuf));
 #ifdef EL_AVOID_COMPLEX_MPI
     EL_CHECK_MPI_CALL
     ( MPI_Igather
@@ -1303,6 +1373,9 @@ void IGather
   Request<T>& request )
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        size_t(sc)*sizeof(*sbuf),
+        size_t(Rank(comm) == root ? rc*Size(comm) : 0)*sizeof(*rbuf));
     if( mpi::Rank(comm) == root )
     {
         const int commSize = mpi::Size(comm);
@@ -1318,6 +1391,143 @@ void IGather
         &request.backend ) );
 }
 
+template <typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc,
+  Comm const& comm, Request<Real>& request )
+{
+    EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        size_t(sc)*sizeof(*sbuf),
+        size_t(rc)*Size(comm)*sizeof(*rbuf));
+    EL_CHECK_MPI_CALL
+    ( MPI_Iallgather
+      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
+        rbuf,                    rc, TypeMap<Real>(), comm.GetMPIComm(),
+        &request.backend ) );
+}
+
+template <typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc,
+  Comm const& comm, Request<Complex<Real>>& request )
+{
+    EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        size_t(sc)*sizeof(*sbuf),
+        size_t(rc)*Size(comm)*sizeof(*rbuf));
+#ifdef EL_AVOID_COMPLEX_MPI
+    EL_CHECK_MPI_CALL
+    ( MPI_Iallgather
+      ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
+        rbuf,                             2*rc, TypeMap<Real>(),
+        comm.GetMPIComm(), &request.backend ) );
+#else
+    EL_CHECK_MPI_CALL
+    ( MPI_Iallgather
+      ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
+        rbuf,                             rc, TypeMap<Complex<Real>>(),
+        comm.GetMPIComm(), &request.backend ) );
+#endif
+}
+
+template <typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void IAllGather
+( const T* sbuf, int sc,
+        T* rbuf, int rc,
+  Comm const& comm, Request<T>& request )
+{
+    EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        size_t(sc)*sizeof(*sbuf),
+        size_t(rc)*Size(comm)*sizeof(*rbuf));
+    // The serialized send data is stored after the receive data so that
+    // both outlive this call
+    const int commSize = mpi::Size(comm);
+    const Int totalCount = rc*commSize + sc;
+    request.receivingPacked = true;
+    request.recvCount = rc*commSize;
+    request.unpackedRecvBuf = rbuf;
+    ReserveSerialized( totalCount, sbuf, request.buffer );
+    const size_t entrySize =
+      ( totalCount > 0 ? request.buffer.size() / totalCount : 0 );
+    byte* packedSendBuf = request.buffer.data() + entrySize*rc*commSize;
+    Serialize( sc, sbuf, packedSendBuf );
+    EL_CHECK_MPI_CALL
+    ( MPI_Iallgather
+      ( packedSendBuf,         sc, TypeMap<T>(),
+        request.buffer.data(), rc, TypeMap<T>(), comm.GetMPIComm(),
+        &request.backend ) );
+}
+
+template <typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllReduce
+( Real* buf, int count, Op op, Comm const& comm, Request<Real>& request )
+{
+    EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*sizeof(*buf),
+        size_t(count)*sizeof(*buf));
+    EL_CHECK_MPI_CALL
+    ( MPI_Iallreduce
+      ( MPI_IN_PLACE, buf, count, TypeMap<Real>(), NativeOp<Real>(op),
+        comm.GetMPIComm(), &request.backend ) );
+}
+
+template <typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllReduce
+( Complex<Real>* buf, int count, Op op, Comm const& comm,
+  Request<Complex<Real>>& request )
+{
+    EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*sizeof(*buf),
+        size_t(count)*sizeof(*buf));
+#ifdef EL_AVOID_COMPLEX_MPI
+    if( op == SUM )
+    {
+        EL_CHECK_MPI_CALL
+        ( MPI_Iallreduce
+          ( MPI_IN_PLACE, buf, 2*count, TypeMap<Real>(), NativeOp<Real>(op),
+            comm.GetMPIComm(), &request.backend ) );
+        return;
+    }
+#endif
+    EL_CHECK_MPI_CALL
+    ( MPI_Iallreduce
+      ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(),
+        NativeOp<Complex<Real>>(op), comm.GetMPIComm(), &request.backend ) );
+}
+
+template <typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void IAllReduce
+( T* buf, int count, Op op, Comm const& comm, Request<T>& request )
+{
+    EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*sizeof(*buf),
+        size_t(count)*sizeof(*buf));
+    // The reduction is performed on a serialized copy which Wait unpacks
+    request.receivingPacked = true;
+    request.recvCount = count;
+    request.unpackedRecvBuf = buf;
+    Serialize( count, buf, request.buffer );
+    EL_CHECK_MPI_CALL
+    ( MPI_Iallreduce
+      ( MPI_IN_PLACE, request.buffer.data(), count, TypeMap<T>(),
+        NativeOp<T>(op), comm.GetMPIComm(), &request.backend ) );
+}
+
 template <typename Real, Device D,
           typename/*=EnableIf<IsPacked<Real>>*/>
 void Gather(
@@ -1327,6 +1537,9 @@ void Gather(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        size_t(sc)*sizeof(*sbuf),
+        (Rank(comm) == root ? SumCounts(rcs, Size(comm)) : 0)*sizeof(*rbuf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const commRank = Rank(comm);
@@ -1357,6 +1570,9 @@ void Gather(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        size_t(sc)*sizeof(*sbuf),
+        (Rank(comm) == root ? SumCounts(rcs, Size(comm)) : 0)*sizeof(*rbuf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const commRank = Rank(comm);
@@ -1409,6 +1625,9 @@ void Gather(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        size_t(sc)*sizeof(*sbuf),
+        (Rank(comm) == root ? SumCounts(rcs, Size(comm)) : 0)*sizeof(*rbuf));
 
     Synchronize(syncInfo);
 
@@ -1447,6 +1666,9 @@ void AllGather(
     EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        size_t(sc)*sizeof(*sbuf),
+        SumCounts(rcs, Size(comm))*sizeof(*rbuf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const commSize = Size(comm);
@@ -1493,6 +1715,9 @@ void AllGather(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        size_t(sc)*sizeof(*sbuf),
+        SumCounts(rcs, Size(comm))*sizeof(*rbuf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const commSize = Size(comm);
@@ -1556,6 +1781,9 @@ void AllGather(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        size_t(sc)*sizeof(*sbuf),
+        SumCounts(rcs, Size(comm))*sizeof(*rbuf));
 
     const int commSize = mpi::Size(comm);
     const int totalRecv = rcs[commSize-1]+rds[commSize-1];
@@ -1587,6 +1815,9 @@ void Scatter(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        size_t(Rank(comm) == root ? sc*Size(comm) : 0)*sizeof(*buf),
+        size_t(rc)*sizeof(*buf));
 
     auto const commRank = Rank( comm );
 
@@ -1627,6 +1858,9 @@ void Scatter(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        size_t(Rank(comm) == root ? sc*Size(comm) : 0)*sizeof(*buf),
+        size_t(rc)*sizeof(*buf));
 
     auto const commRank = Rank( comm );
 
@@ -1681,6 +1915,9 @@ void Scatter(T* buf, int sc, int rc, int root, Comm const& comm,
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        size_t(Rank(comm) == root ? sc*Size(comm) : 0)*sizeof(*buf),
+        size_t(rc)*sizeof(*buf));
     auto const commSize = mpi::Size(comm);
     auto const commRank = Rank( comm );
     auto const totalSend =
@@ -1719,6 +1956,9 @@ void AllToAll(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        SumCounts(scs, Size(comm))*sizeof(*sbuf),
+        SumCounts(rcs, Size(comm))*sizeof(*rbuf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const commSize = Size(comm);
@@ -1748,6 +1988,9 @@ void AllToAll(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        SumCounts(scs, Size(comm))*sizeof(*sbuf),
+        SumCounts(rcs, Size(comm))*sizeof(*rbuf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const commSize = Size(comm);
@@ -1797,6 +2040,9 @@ void AllToAll(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        SumCounts(scs, Size(comm))*sizeof(*sbuf),
+        SumCounts(rcs, Size(comm))*sizeof(*rbuf));
 
     auto const commSize = Size(comm);
     auto const totalSend =
@@ -1857,6 +2103,9 @@ void ReduceScatter(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        SumCounts(rcs, Size(comm))*sizeof(*sbuf),
+        size_t(rcs[Rank(comm)])*sizeof(*rbuf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const commRank = mpi::Rank(comm);
@@ -1883,6 +2132,9 @@ void ReduceScatter(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        SumCounts(rcs, Size(comm))*sizeof(*sbuf),
+        size_t(rcs[Rank(comm)])*sizeof(*rbuf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const commRank = mpi::Rank(comm);
@@ -1933,6 +2185,9 @@ void ReduceScatter(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        SumCounts(rcs, Size(comm))*sizeof(*sbuf),
+        size_t(rcs[Rank(comm)])*sizeof(*rbuf));
 
     Synchronize(syncInfo);
 
@@ -1994,6 +2249,9 @@ EL_NO_RELEASE_EXCEPT
 
     if (count == 0)
         return;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*sizeof(*sbuf),
+        size_t(count)*sizeof(*rbuf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_SEND_BUFFER(sbuf, count, syncInfo);
@@ -2019,6 +2277,9 @@ EL_NO_RELEASE_EXCEPT
 
     if (count == 0)
         return;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*sizeof(*sbuf),
+        size_t(count)*sizeof(*rbuf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_SEND_BUFFER(sbuf, count, syncInfo);
@@ -2063,6 +2324,9 @@ EL_NO_RELEASE_EXCEPT
 
     if (count == 0)
         return;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*sizeof(*sbuf),
+        size_t(count)*sizeof(*rbuf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_SEND_BUFFER(sbuf, count, syncInfo);
@@ -2116,6 +2380,9 @@ EL_NO_RELEASE_EXCEPT
 
     if (count == 0)
         return;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*sizeof(*buf),
+        size_t(count)*sizeof(*buf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_INPLACE_BUFFER(buf, count, syncInfo);
@@ -2139,6 +2406,9 @@ EL_NO_RELEASE_EXCEPT
 
     if( count == 0 )
         return;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*sizeof(*buf),
+        size_t(count)*sizeof(*buf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_INPLACE_BUFFER(buf, count, syncInfo);
@@ -2182,6 +2452,9 @@ EL_NO_RELEASE_EXCEPT
 
     if( count == 0 )
         return;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*sizeof(*buf),
+        size_t(count)*sizeof(*buf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_INPLACE_BUFFER(buf, count, syncInfo);
@@ -2335,6 +2608,12 @@ EL_NO_RELEASE_EXCEPT
         const T* sbuf, int sc,                                          \
         T* rbuf, int rc,                                                \
         int root, Comm const& comm, Request<T>& request);                      \
+    template void IAllGather(                                           \
+        const T* sbuf, int sc,                                          \
+        T* rbuf, int rc,                                                \
+        Comm const& comm, Request<T>& request);                         \
+    template void IAllReduce(                                           \
+        T* buf, int count, Op op, Comm const& comm, Request<T>& request);      \
     MPI_PROTO_DEVICELESS_COMMON(T)
 
 #define MPI_PROTO_DEVICELESS_COMPLEX(T)                                 \
@@ -2357,6 +2636,13 @@ EL_NO_RELEASE_EXCEPT
         const Complex<T>* sbuf, int sc,                                 \
         Complex<T>* rbuf, int rc,                                       \
         int root, Comm const& comm, Request<Complex<T>>& request);             \
+    template void IAllGather<T>(                                        \
+        const Complex<T>* sbuf, int sc,                                 \
+        Complex<T>* rbuf, int rc,                                       \
+        Comm const& comm, Request<Complex<T>>& request);                \
+    template void IAllReduce<T>(                                        \
+        Complex<T>* buf, int count, Op op, Comm const& comm,                   \
+        Request<Complex<T>>& request);                                  \
     MPI_PROTO_DEVICELESS_COMMON(Complex<T>)
 
 #define MPI_PROTO_COMMON_DEV(T,D)               \
@@ -13,6 +13,9 @@ void AllGather(
     SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        size_t(sc)*sizeof(*sbuf),
+        size_t(rc)*Size(comm)*sizeof(*rbuf));
     using Backend = BestBackend<T,D,Collective::ALLGATHER>;
     Al::Allgather<Backend>(
         sbuf, rbuf, sc, comm.template GetComm<Backend>(syncInfo));
@@ -25,6 +28,9 @@ void AllGather(
     SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_COMMUNICATION(
+        size_t(sc)*sizeof(*sbuf),
+        size_t(rc)*Size(comm)*sizeof(*rbuf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto size_c = Size(comm);
@@ -34,6 +40,12 @@ void AllGather(
 #endif
 
     Synchronize(syncInfo);
+    if (D == Device::CPU &&
+        hierarchical::Use(comm, size_t(rc)*Size(comm)*sizeof(T), MPI_OP_NULL))
+    {
+        hierarchical::AllGather(sbuf, rbuf, rc, TypeMap<T>(), comm);
+        return;
+    }
 
 #ifdef EL_USE_BYTE_ALLGATHERS
     LogicError("AllGather: Let Tom know if you go down this code path.");
@@ -60,6 +72,9 @@ void AllGather(
     SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_COMMUNICATION(
+        size_t(sc)*sizeof(*sbuf),
+        size_t(rc)*Size(comm)*sizeof(*rbuf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto size_c = Size(comm);
@@ -69,6 +84,13 @@ void AllGather(
 #endif
 
     Synchronize(syncInfo);
+    if (D == Device::CPU &&
+        hierarchical::Use(
+            comm, size_t(rc)*Size(comm)*sizeof(Complex<T>), MPI_OP_NULL))
+    {
+        hierarchical::AllGather(sbuf, rbuf, rc, TypeMap<Complex<T>>(), comm);
+        return;
+    }
 
 #ifdef EL_USE_BYTE_ALLGATHERS
     LogicError("AllGather: Let Tom know if you go down this code path.");
@@ -100,6 +122,9 @@ void AllGather(
     SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_COMMUNICATION(
+        size_t(sc)*sizeof(*sbuf),
+        size_t(rc)*Size(comm)*sizeof(*rbuf));
     const int commSize = mpi::Size(comm);
     const int totalRecv = rc*commSize;
 
@@ -17,6 +17,9 @@ void AllReduce(T const* sbuf, T* rbuf, int count, Op op, Comm const& comm,
 
     if (count == 0)
         return;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*sizeof(*sbuf),
+        size_t(count)*sizeof(*rbuf));
 
     Al::Allreduce<Backend>(
         sbuf, rbuf, count, MPI_Op2ReductionOperator(AlNativeOp<T>(op)),
@@ -31,6 +34,9 @@ void AllReduce(T const* sbuf, T* rbuf, int count, Op op, Comm const& comm,
     EL_DEBUG_CSE
     if (count == 0)
         return;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*sizeof(*sbuf),
+        size_t(count)*sizeof(*rbuf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_SEND_BUFFER(sbuf, count, syncInfo);
@@ -38,6 +44,13 @@ void AllReduce(T const* sbuf, T* rbuf, int count, Op op, Comm const& comm,
 #endif
 
     Synchronize(syncInfo);
+    if (D == Device::CPU &&
+        hierarchical::Use(comm, size_t(count)*sizeof(T), NativeOp<T>(op)))
+    {
+        hierarchical::AllReduce(
+            sbuf, rbuf, count, TypeMap<T>(), NativeOp<T>(op), comm);
+        return;
+    }
 
     EL_CHECK_MPI_CALL(
         MPI_Allreduce(
@@ -53,6 +66,9 @@ void AllReduce(Complex<T> const* sbuf, Complex<T>* rbuf, int count, Op op,
 
     if (count == 0)
         return;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*sizeof(*sbuf),
+        size_t(count)*sizeof(*rbuf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_SEND_BUFFER(sbuf, count, syncInfo);
@@ -60,6 +76,15 @@ void AllReduce(Complex<T> const* sbuf, Complex<T>* rbuf, int count, Op op,
 #endif
 
     Synchronize(syncInfo);
+    if (D == Device::CPU &&
+        hierarchical::Use(
+            comm, size_t(count)*sizeof(Complex<T>), NativeOp<Complex<T>>(op)))
+    {
+        hierarchical::AllReduce(
+            sbuf, rbuf, count, TypeMap<Complex<T>>(),
+            NativeOp<Complex<T>>(op), comm);
+        return;
+    }
 
 #ifdef EL_AVOID_COMPLEX_MPI
     if (op == SUM)
@@ -91,6 +116,9 @@ void AllReduce(T const* sbuf, T* rbuf, int count, Op op, Comm const& comm,
     EL_DEBUG_CSE
     if (count == 0)
         return;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*sizeof(*sbuf),
+        size_t(count)*sizeof(*rbuf));
 
     MPI_Op opC = NativeOp<T>(op);
     std::vector<byte> packedSend, packedRecv;
@@ -131,6 +159,9 @@ void AllReduce(T* buf, int count, Op op, Comm const& comm,
 
     if (count == 0)
         return;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*sizeof(*buf),
+        size_t(count)*sizeof(*buf));
 
     Al::Allreduce<Backend>(
         buf, count, MPI_Op2ReductionOperator(AlNativeOp<T>(op)),
@@ -145,12 +176,22 @@ void AllReduce(T* buf, int count, Op op, Comm const& comm,
     EL_DEBUG_CSE
     if (count == 0 || Size(comm) == 1)
         return;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*sizeof(*buf),
+        size_t(count)*sizeof(*buf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_INPLACE_BUFFER(buf, count, syncInfo);
 #endif // HYDROGEN_ENSURE_HOST_MPI_BUFFERS
 
     Synchronize(syncInfo);
+    if (D == Device::CPU &&
+        hierarchical::Use(comm, size_t(count)*sizeof(T), NativeOp<T>(op)))
+    {
+        hierarchical::AllReduce(
+            nullptr, buf, count, TypeMap<T>(), NativeOp<T>(op), comm);
+        return;
+    }
 
     EL_CHECK_MPI_CALL(
         MPI_Allreduce(
@@ -165,12 +206,24 @@ void AllReduce(Complex<T>* buf, int count, Op op, Comm const& comm,
     EL_DEBUG_CSE
     if (count == 0 || Size(comm) == 1)
         return;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*sizeof(*buf),
+        size_t(count)*sizeof(*buf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_INPLACE_BUFFER(buf, count, syncInfo);
 #endif // HYDROGEN_ENSURE_HOST_MPI_BUFFERS
 
     Synchronize(syncInfo);
+    if (D == Device::CPU &&
+        hierarchical::Use(
+            comm, size_t(count)*sizeof(Complex<T>), NativeOp<Complex<T>>(op)))
+    {
+        hierarchical::AllReduce(
+            nullptr, buf, count, TypeMap<Complex<T>>(),
+            NativeOp<Complex<T>>(op), comm);
+        return;
+    }
 
 #ifdef EL_AVOID_COMPLEX_MPI
     if (op == SUM)
@@ -203,6 +256,9 @@ void AllReduce(T* buf, int count, Op op, Comm const& comm,
     EL_DEBUG_CSE
     if (count == 0)
         return;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*sizeof(*buf),
+        size_t(count)*sizeof(*buf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_INPLACE_BUFFER(buf, count, syncInfo);
@@ -14,6 +14,9 @@ void AllToAll(T const* sbuf, int /*sc*/, T* rbuf, int rc, Comm const& comm,
     EL_DEBUG_CSE
     if (rc == 0)
         return;
+    EL_PROFILE_COMMUNICATION(
+        size_t(rc)*Size(comm)*sizeof(*sbuf),
+        size_t(rc)*Size(comm)*sizeof(*rbuf));
 
     using Backend = BestBackend<T,D,Collective::ALLTOALL>;
     Al::Alltoall<Backend>(
@@ -26,6 +29,9 @@ void AllToAll(T const* sbuf, int sc, T* rbuf, int rc, Comm const& comm,
               SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_COMMUNICATION(
+        size_t(rc)*Size(comm)*sizeof(*sbuf),
+        size_t(rc)*Size(comm)*sizeof(*rbuf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto size_c = Size(comm);
@@ -47,6 +53,9 @@ void AllToAll(Complex<T> const* sbuf,
               SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_COMMUNICATION(
+        size_t(rc)*Size(comm)*sizeof(*sbuf),
+        size_t(rc)*Size(comm)*sizeof(*rbuf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto size_c = Size(comm);
@@ -79,6 +88,9 @@ void AllToAll(T const* sbuf, int sc, T* rbuf, int rc, Comm const& comm,
               SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_COMMUNICATION(
+        size_t(rc)*Size(comm)*sizeof(*sbuf),
+        size_t(rc)*Size(comm)*sizeof(*rbuf));
 
     const int commSize = mpi::Size(comm);
     const int totalSend = sc*commSize;
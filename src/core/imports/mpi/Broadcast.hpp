@@ -14,6 +14,9 @@ void Broadcast(T* buffer, int count, int root, Comm const& comm,
                SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_COMMUNICATION(
+        size_t(Rank(comm) == root ? count : 0)*sizeof(*buffer),
+        size_t(Rank(comm) == root ? 0 : count)*sizeof(*buffer));
 
     using Backend = BestBackend<T,D,Collective::BROADCAST>;
     Al::Bcast<Backend>(
@@ -28,6 +31,9 @@ void Broadcast(T* buffer, int count, int root, Comm const& comm,
     EL_DEBUG_CSE
     if (Size(comm) == 1 || count == 0)
         return;
+    EL_PROFILE_COMMUNICATION(
+        size_t(Rank(comm) == root ? count : 0)*sizeof(*buffer),
+        size_t(Rank(comm) == root ? 0 : count)*sizeof(*buffer));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     // I want to pre-transfer if root, I want to post-transfer if not root
@@ -41,6 +47,12 @@ void Broadcast(T* buffer, int count, int root, Comm const& comm,
 
     Synchronize(syncInfo);// NOOP on CPU,
                           // cudaStreamSynchronize on GPU.
+    if (D == Device::CPU &&
+        hierarchical::Use(comm, size_t(count)*sizeof(T), MPI_OP_NULL))
+    {
+        hierarchical::Broadcast(buffer, count, TypeMap<T>(), root, comm);
+        return;
+    }
     EL_CHECK_MPI_CALL(MPI_Bcast(buffer, count, TypeMap<T>(), root, comm.GetMPIComm()));
 }
 
@@ -51,6 +63,9 @@ void Broadcast(Complex<T>* buffer, int count, int root, Comm const& comm,
     EL_DEBUG_CSE
     if (Size(comm) == 1 || count == 0)
         return;
+    EL_PROFILE_COMMUNICATION(
+        size_t(Rank(comm) == root ? count : 0)*sizeof(*buffer),
+        size_t(Rank(comm) == root ? 0 : count)*sizeof(*buffer));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     // I want to pre-transfer if root, I want to post-transfer if not root
@@ -63,6 +78,13 @@ void Broadcast(Complex<T>* buffer, int count, int root, Comm const& comm,
 #endif // HYDROGEN_ENSURE_HOST_MPI_BUFFERS
 
     Synchronize(syncInfo);
+    if (D == Device::CPU &&
+        hierarchical::Use(comm, size_t(count)*sizeof(Complex<T>), MPI_OP_NULL))
+    {
+        hierarchical::Broadcast(
+            buffer, count, TypeMap<Complex<T>>(), root, comm);
+        return;
+    }
 
 #ifdef EL_AVOID_COMPLEX_MPI
     EL_CHECK_MPI_CALL(MPI_Bcast(buffer, 2*count, TypeMap<T>(), root, comm.GetMPIComm()));
@@ -78,6 +100,9 @@ void Broadcast(T* buffer, int count, int root, Comm const& comm,
     EL_DEBUG_CSE
     if (Size(comm) == 1 || count == 0)
         return;
+    EL_PROFILE_COMMUNICATION(
+        size_t(Rank(comm) == root ? count : 0)*sizeof(*buffer),
+        size_t(Rank(comm) == root ? 0 : count)*sizeof(*buffer));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     // I want to pre-transfer if root, I want to post-transfer if not root
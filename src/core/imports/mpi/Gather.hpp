@@ -13,6 +13,9 @@ void Gather(
     T* rbuf, int rc, int root, Comm const& comm, SyncInfo<D> const& syncInfo )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_COMMUNICATION(
+        size_t(sc)*sizeof(*sbuf),
+        size_t(Rank(comm) == root ? rc*Size(comm) : 0)*sizeof(*rbuf));
 
     using Backend = BestBackend<T,D,Collective::GATHER>;
     Al::Gather<Backend>(
@@ -27,6 +30,9 @@ void Gather(
     SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_COMMUNICATION(
+        size_t(sc)*sizeof(*sbuf),
+        size_t(Rank(comm) == root ? rc*Size(comm) : 0)*sizeof(*rbuf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const rank = mpi::Rank(comm);
@@ -52,6 +58,9 @@ void Gather(
     SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_COMMUNICATION(
+        size_t(sc)*sizeof(*sbuf),
+        size_t(Rank(comm) == root ? rc*Size(comm) : 0)*sizeof(*rbuf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const rank = mpi::Rank(comm);
@@ -85,6 +94,9 @@ void Gather(
     T* rbuf, int rc, int root, Comm const& comm, SyncInfo<D> const& syncInfo )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_COMMUNICATION(
+        size_t(sc)*sizeof(*sbuf),
+        size_t(Rank(comm) == root ? rc*Size(comm) : 0)*sizeof(*rbuf));
 
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
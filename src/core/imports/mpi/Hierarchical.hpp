@@ -0,0 +1,376 @@
+// Hierarchical (node-aware) collectives
+
+#include <cstring>
+
+namespace El
+{
+namespace mpi
+{
+
+namespace
+{
+bool hierarchicalCollectives_ = false;
+int maxRanksPerNode_ = 0;
+
+// The largest shared buffer which a hierarchical collective may require of a
+// node before falling back to the flat collective
+const size_t maxHierarchicalBytes_ = size_t(1) << 28;
+}
+
+void SetHierarchicalCollectives(bool enable)
+{ hierarchicalCollectives_ = enable; }
+bool HierarchicalCollectives() { return hierarchicalCollectives_; }
+
+void SetMaxRanksPerNode(int maxRanksPerNode)
+{
+    if (maxRanksPerNode < 0)
+        LogicError("The maximum number of ranks per node must be non-negative");
+    maxRanksPerNode_ = maxRanksPerNode;
+}
+int MaxRanksPerNode() { return maxRanksPerNode_; }
+
+NodeComms::NodeComms(MPI_Comm comm, int maxRanksPerNode)
+{
+    EL_DEBUG_CSE
+    int commRank, commSize;
+    EL_CHECK_MPI_CALL(MPI_Comm_rank(comm, &commRank));
+    EL_CHECK_MPI_CALL(MPI_Comm_size(comm, &commSize));
+
+    // The processes which share memory, ordered by their rank in comm
+    MPI_Comm sharedComm;
+    EL_CHECK_MPI_CALL(
+        MPI_Comm_split_type(
+            comm, MPI_COMM_TYPE_SHARED, commRank, MPI_INFO_NULL,
+            &sharedComm));
+    int sharedRank, sharedSize;
+    EL_CHECK_MPI_CALL(MPI_Comm_rank(sharedComm, &sharedRank));
+    EL_CHECK_MPI_CALL(MPI_Comm_size(sharedComm, &sharedSize));
+    if (maxRanksPerNode > 0 && sharedSize > maxRanksPerNode)
+    {
+        // Deal the processes round-robin amongst the groups in the order of
+        // their world ranks, which matches a round-robin binding of
+        // processes to sockets and does not depend on the ordering of comm
+        int worldRank;
+        EL_CHECK_MPI_CALL(MPI_Comm_rank(MPI_COMM_WORLD, &worldRank));
+        std::vector<int> worldRanks(sharedSize);
+        EL_CHECK_MPI_CALL(
+            MPI_Allgather(
+                &worldRank, 1, MPI_INT, worldRanks.data(), 1, MPI_INT,
+                sharedComm));
+        int worldOrder = 0;
+        for (int q=0; q<sharedSize; ++q)
+            if (worldRanks[q] < worldRank)
+                ++worldOrder;
+        const int numGroups = (sharedSize+maxRanksPerNode-1) / maxRanksPerNode;
+        EL_CHECK_MPI_CALL(
+            MPI_Comm_split(
+                sharedComm, worldOrder % numGroups, sharedRank, &intraComm_));
+        EL_CHECK_MPI_CALL(MPI_Comm_free(&sharedComm));
+    }
+    else
+        intraComm_ = sharedComm;
+    EL_CHECK_MPI_CALL(MPI_Comm_rank(intraComm_, &nodeRank_));
+    EL_CHECK_MPI_CALL(MPI_Comm_size(intraComm_, &nodeSize_));
+
+    EL_CHECK_MPI_CALL(
+        MPI_Comm_split(
+            comm, nodeRank_ == 0 ? 0 : MPI_UNDEFINED, commRank, &interComm_));
+    if (nodeRank_ == 0)
+        EL_CHECK_MPI_CALL(MPI_Comm_rank(interComm_, &node_));
+    EL_CHECK_MPI_CALL(MPI_Bcast(&node_, 1, MPI_INT, 0, intraComm_));
+
+    // Every process learns the node and node rank of every other
+    const int myLocation[2] = { node_, nodeRank_ };
+    std::vector<int> locations(2*commSize);
+    EL_CHECK_MPI_CALL(
+        MPI_Allgather(
+            myLocation, 2, MPI_INT, locations.data(), 2, MPI_INT, comm));
+    int numNodes = 0;
+    nodeOf_.resize(commSize);
+    for (int q=0; q<commSize; ++q)
+    {
+        nodeOf_[q] = locations[2*q];
+        numNodes = std::max(numNodes, nodeOf_[q]+1);
+    }
+    nodeOffsets_.assign(numNodes+1, 0);
+    for (int q=0; q<commSize; ++q)
+        ++nodeOffsets_[nodeOf_[q]+1];
+    maxNodeSize_ = 0;
+    for (int k=0; k<numNodes; ++k)
+    {
+        maxNodeSize_ = std::max(maxNodeSize_, nodeOffsets_[k+1]);
+        nodeOffsets_[k+1] += nodeOffsets_[k];
+    }
+    position_.resize(commSize);
+    for (int q=0; q<commSize; ++q)
+        position_[q] = nodeOffsets_[nodeOf_[q]] + locations[2*q+1];
+}
+
+NodeComms::~NodeComms()
+{
+    int finalized;
+    MPI_Finalized(&finalized);
+    if (finalized)
+        return;
+    FreeWindow_();
+    if (interComm_ != MPI_COMM_NULL)
+        MPI_Comm_free(&interComm_);
+    if (intraComm_ != MPI_COMM_NULL)
+        MPI_Comm_free(&intraComm_);
+}
+
+void NodeComms::FreeWindow_()
+{
+    FreeSharedWindow(window_);
+    sharedBuffer_ = nullptr;
+    sharedBytes_ = 0;
+}
+
+void* NodeComms::AllocateShared(size_t numBytes, MPI_Win& window) const
+{
+    EL_DEBUG_CSE
+    // The leader allocates the entire buffer so that it is contiguous
+    void *base, *buffer;
+    EL_CHECK_MPI_CALL(
+        MPI_Win_allocate_shared(
+            nodeRank_ == 0 ? MPI_Aint(numBytes) : MPI_Aint(0), 1,
+            MPI_INFO_NULL, intraComm_, &base, &window));
+    MPI_Aint size;
+    int dispUnit;
+    EL_CHECK_MPI_CALL(
+        MPI_Win_shared_query(window, 0, &size, &dispUnit, &buffer));
+    EL_CHECK_MPI_CALL(MPI_Win_lock_all(MPI_MODE_NOCHECK, window));
+    return buffer;
+}
+
+void NodeComms::FreeSharedWindow(MPI_Win& window)
+{
+    int finalized;
+    MPI_Finalized(&finalized);
+    if (window != MPI_WIN_NULL && !finalized)
+    {
+        MPI_Win_unlock_all(window);
+        MPI_Win_free(&window);
+    }
+    window = MPI_WIN_NULL;
+}
+
+void* NodeComms::SharedBuffer(size_t numBytes)
+{
+    EL_DEBUG_CSE
+    if (numBytes <= sharedBytes_)
+        return sharedBuffer_;
+
+    FreeWindow_();
+    // Grow geometrically so that a sequence of growing requests only
+    // reallocates a logarithmic number of times
+    size_t newBytes = std::max(numBytes, size_t(4096));
+    newBytes = std::max(newBytes, 2*sharedBytes_);
+    sharedBuffer_ = AllocateShared(newBytes, window_);
+    sharedBytes_ = newBytes;
+    return sharedBuffer_;
+}
+
+void NodeComms::Barrier() const { Barrier(window_); }
+
+void NodeComms::Barrier(MPI_Win window) const
+{
+    if (window != MPI_WIN_NULL)
+        EL_CHECK_MPI_CALL(MPI_Win_sync(window));
+    EL_CHECK_MPI_CALL(MPI_Barrier(intraComm_));
+    if (window != MPI_WIN_NULL)
+        EL_CHECK_MPI_CALL(MPI_Win_sync(window));
+}
+
+NodeComms& GetNodeComms(Comm const& comm)
+{
+    EL_DEBUG_CSE
+    auto& nodeComms = comm.CachedNodeComms();
+    if (!nodeComms)
+        nodeComms = std::make_shared<NodeComms>(
+            comm.GetMPIComm(), MaxRanksPerNode());
+    return *nodeComms;
+}
+
+namespace hierarchical
+{
+namespace
+{
+
+size_t Extent(MPI_Datatype type)
+{
+    MPI_Aint lowerBound, extent;
+    EL_CHECK_MPI_CALL(MPI_Type_get_extent(type, &lowerBound, &extent));
+    return extent;
+}
+
+// Reduce entries [beg,end) of each of the node's numSlots slots into the
+// first slot, with each process of the node handling a contiguous chunk
+void ReduceSlots(
+    NodeComms const& nodeComms, byte* base, size_t slotBytes, int count,
+    MPI_Datatype type, MPI_Op op)
+{
+    const size_t extent = Extent(type);
+    const int nodeSize = nodeComms.NodeSize();
+    const int nodeRank = nodeComms.NodeRank();
+    const int chunk = (count+nodeSize-1) / nodeSize;
+    const int beg = std::min(nodeRank*chunk, count);
+    const int end = std::min(beg+chunk, count);
+    if (end > beg)
+        for (int slot=1; slot<nodeSize; ++slot)
+            EL_CHECK_MPI_CALL(
+                MPI_Reduce_local(
+                    base+slot*slotBytes+beg*extent, base+beg*extent, end-beg,
+                    type, op));
+}
+
+}// namespace <anon>
+
+bool Use(Comm const& comm, size_t sharedBytes, Op op)
+{
+    if (!HierarchicalCollectives() || Size(comm) == 1 ||
+        sharedBytes > maxHierarchicalBytes_)
+        return false;
+    if (op.op != MPI_OP_NULL)
+    {
+        // The contributions of a node are combined in an arbitrary order
+        int commutative;
+        EL_CHECK_MPI_CALL(MPI_Op_commutative(op.op, &commutative));
+        if (!commutative)
+            return false;
+    }
+    return GetNodeComms(comm).MaxNodeSize() > 1;
+}
+
+void AllReduce(
+    void const* sbuf, void* rbuf, int count, MPI_Datatype type, MPI_Op op,
+    Comm const& comm)
+{
+    EL_DEBUG_CSE
+    NodeComms& nodeComms = GetNodeComms(comm);
+    const size_t numBytes = count*Extent(type);
+    byte* base = static_cast<byte*>(
+        nodeComms.SharedBuffer(nodeComms.NodeSize()*numBytes));
+
+    std::memcpy(
+        base+nodeComms.NodeRank()*numBytes, sbuf == nullptr ? rbuf : sbuf,
+        numBytes);
+    nodeComms.Barrier();
+    ReduceSlots(nodeComms, base, numBytes, count, type, op);
+    nodeComms.Barrier();
+    if (nodeComms.Leader() && nodeComms.NumNodes() > 1)
+        EL_CHECK_MPI_CALL(
+            MPI_Allreduce(
+                MPI_IN_PLACE, base, count, type, op, nodeComms.InterComm()));
+    nodeComms.Barrier();
+    std::memcpy(rbuf, base, numBytes);
+    nodeComms.Barrier();
+}
+
+void AllGather(
+    void const* sbuf, void* rbuf, int count, MPI_Datatype type,
+    Comm const& comm)
+{
+    EL_DEBUG_CSE
+    NodeComms& nodeComms = GetNodeComms(comm);
+    const int commSize = Size(comm);
+    const size_t blockBytes = count*Extent(type);
+    byte* base = static_cast<byte*>(
+        nodeComms.SharedBuffer(commSize*blockBytes));
+
+    // The blocks are stored in node-major order so that each node's blocks
+    // are contiguous
+    auto const& position = nodeComms.Position();
+    std::memcpy(base+position[Rank(comm)]*blockBytes, sbuf, blockBytes);
+    nodeComms.Barrier();
+    const int numNodes = nodeComms.NumNodes();
+    if (nodeComms.Leader() && numNodes > 1)
+    {
+        auto const& nodeOffsets = nodeComms.NodeOffsets();
+        std::vector<int> counts(numNodes), displs(numNodes);
+        for (int k=0; k<numNodes; ++k)
+        {
+            counts[k] = (nodeOffsets[k+1]-nodeOffsets[k])*count;
+            displs[k] = nodeOffsets[k]*count;
+        }
+        EL_CHECK_MPI_CALL(
+            MPI_Allgatherv(
+                MPI_IN_PLACE, 0, type, base, counts.data(), displs.data(),
+                type, nodeComms.InterComm()));
+    }
+    nodeComms.Barrier();
+    byte* recv = static_cast<byte*>(rbuf);
+    for (int q=0; q<commSize; ++q)
+        std::memcpy(
+            recv+q*blockBytes, base+position[q]*blockBytes, blockBytes);
+    nodeComms.Barrier();
+}
+
+void Broadcast(
+    void* buf, int count, MPI_Datatype type, int root, Comm const& comm)
+{
+    EL_DEBUG_CSE
+    NodeComms& nodeComms = GetNodeComms(comm);
+    const size_t numBytes = count*Extent(type);
+    byte* base = static_cast<byte*>(nodeComms.SharedBuffer(numBytes));
+
+    const bool isRoot = (Rank(comm) == root);
+    if (isRoot)
+        std::memcpy(base, buf, numBytes);
+    nodeComms.Barrier();
+    if (nodeComms.Leader() && nodeComms.NumNodes() > 1)
+        EL_CHECK_MPI_CALL(
+            MPI_Bcast(
+                base, count, type, nodeComms.NodeOf()[root],
+                nodeComms.InterComm()));
+    nodeComms.Barrier();
+    if (!isRoot)
+        std::memcpy(buf, base, numBytes);
+    nodeComms.Barrier();
+}
+
+void ReduceScatter(
+    void const* sbuf, void* rbuf, int count, MPI_Datatype type, MPI_Op op,
+    Comm const& comm)
+{
+    EL_DEBUG_CSE
+    NodeComms& nodeComms = GetNodeComms(comm);
+    const int commSize = Size(comm);
+    const size_t blockBytes = count*Extent(type);
+    const size_t slotBytes = commSize*blockBytes;
+    byte* base = static_cast<byte*>(
+        nodeComms.SharedBuffer(nodeComms.NodeSize()*slotBytes));
+
+    // Permute this process's contribution into node-major order
+    auto const& position = nodeComms.Position();
+    byte const* send =
+        static_cast<byte const*>(sbuf == nullptr ? rbuf : sbuf);
+    byte* slot = base+nodeComms.NodeRank()*slotBytes;
+    for (int q=0; q<commSize; ++q)
+        std::memcpy(
+            slot+position[q]*blockBytes, send+q*blockBytes, blockBytes);
+    nodeComms.Barrier();
+    ReduceSlots(nodeComms, base, slotBytes, commSize*count, type, op);
+    nodeComms.Barrier();
+
+    // Leave the blocks of this node's processes at the start of the buffer
+    const int numNodes = nodeComms.NumNodes();
+    if (nodeComms.Leader() && numNodes > 1)
+    {
+        auto const& nodeOffsets = nodeComms.NodeOffsets();
+        std::vector<int> counts(numNodes);
+        for (int k=0; k<numNodes; ++k)
+            counts[k] = (nodeOffsets[k+1]-nodeOffsets[k])*count;
+        EL_CHECK_MPI_CALL(
+            MPI_Reduce_scatter(
+                MPI_IN_PLACE, base, counts.data(), type, op,
+                nodeComms.InterComm()));
+    }
+    nodeComms.Barrier();
+    std::memcpy(rbuf, base+nodeComms.NodeRank()*blockBytes, blockBytes);
+    nodeComms.Barrier();
+}
+
+}// namespace hierarchical
+}// namespace mpi
+}// namespace El
@@ -12,6 +12,9 @@ void Reduce(T const* sbuf, T* rbuf, int count, Op op,
             int root, Comm const& comm, SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*sizeof(*sbuf),
+        size_t(Rank(comm) == root ? count : 0)*sizeof(*rbuf));
 
     using Backend = BestBackend<T,D,Collective::REDUCE>;
     Al::Reduce<Backend>(
@@ -27,6 +30,9 @@ void Reduce(T const* sbuf, T* rbuf, int count, Op op,
     EL_DEBUG_CSE
     if (count == 0)
         return;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*sizeof(*sbuf),
+        size_t(Rank(comm) == root ? count : 0)*sizeof(*rbuf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const rank = Rank(comm);
@@ -51,6 +57,9 @@ void Reduce(const Complex<T>* sbuf, Complex<T>* rbuf, int count, Op op,
     EL_DEBUG_CSE
     if (count == 0)
         return;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*sizeof(*sbuf),
+        size_t(Rank(comm) == root ? count : 0)*sizeof(*rbuf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const rank = Rank(comm);
@@ -92,6 +101,9 @@ void Reduce(T const* sbuf, T* rbuf, int count, Op op,
     EL_DEBUG_CSE
     if (count == 0)
         return;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*sizeof(*sbuf),
+        size_t(Rank(comm) == root ? count : 0)*sizeof(*rbuf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const rank = Rank(comm);
@@ -155,6 +167,9 @@ void Reduce(T* buf, int count, Op op,
             int root, Comm const& comm, SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*sizeof(*buf),
+        size_t(Rank(comm) == root ? count : 0)*sizeof(*buf));
 
     using Backend = BestBackend<T,D,Collective::REDUCE>;
     Al::Reduce<Backend>(
@@ -170,6 +185,9 @@ void Reduce(T* buf, int count, Op op, int root, Comm const& comm,
     EL_DEBUG_CSE
     if (count == 0 || Size(comm) == 1)
         return;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*sizeof(*buf),
+        size_t(Rank(comm) == root ? count : 0)*sizeof(*buf));
 
     const int commRank = Rank(comm);
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
@@ -200,6 +218,9 @@ void Reduce(Complex<T>* buf, int count, Op op, int root, Comm const& comm,
     EL_DEBUG_CSE
     if (Size(comm) == 1 || count == 0)
         return;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*sizeof(*buf),
+        size_t(Rank(comm) == root ? count : 0)*sizeof(*buf));
 
     const int commRank = mpi::Rank(comm);
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
@@ -266,6 +287,9 @@ void Reduce(T* buf, int count, Op op, int root, Comm const& comm,
     EL_DEBUG_CSE
     if (count == 0)
         return;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*sizeof(*buf),
+        size_t(Rank(comm) == root ? count : 0)*sizeof(*buf));
 
     const int commRank = mpi::Rank(comm);
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
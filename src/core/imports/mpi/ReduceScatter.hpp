@@ -43,6 +43,9 @@ void ReduceScatter(T const* sbuf, T* rbuf, int count, Op op, Comm const& comm,
     EL_DEBUG_CSE
     if (count == 0)
         return;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*Size(comm)*sizeof(*sbuf),
+        size_t(count)*sizeof(*rbuf));
     if (comm.Size() == 1)
         return LocalCopy(sbuf, rbuf, count, syncInfo);
 
@@ -60,6 +63,9 @@ void ReduceScatter(T const* sbuf, T* rbuf, int count, Op op, Comm const& comm,
     EL_DEBUG_CSE
     if (count == 0)
         return;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*Size(comm)*sizeof(*sbuf),
+        size_t(count)*sizeof(*rbuf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto size_c = Size(comm);
@@ -69,6 +75,14 @@ void ReduceScatter(T const* sbuf, T* rbuf, int count, Op op, Comm const& comm,
 #endif
 
     Synchronize(syncInfo);
+    if (D == Device::CPU &&
+        hierarchical::Use(
+            comm, size_t(count)*Size(comm)*sizeof(T), NativeOp<T>(op)))
+    {
+        hierarchical::ReduceScatter(
+            sbuf, rbuf, count, TypeMap<T>(), NativeOp<T>(op), comm);
+        return;
+    }
 
     EL_CHECK_MPI_CALL(
         MPI_Reduce_scatter_block(
@@ -82,6 +96,9 @@ void ReduceScatter(Complex<T> const* sbuf, Complex<T>* rbuf,
     EL_DEBUG_CSE
     if (count == 0)
         return;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*Size(comm)*sizeof(*sbuf),
+        size_t(count)*sizeof(*rbuf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto size_c = Size(comm);
@@ -91,6 +108,16 @@ void ReduceScatter(Complex<T> const* sbuf, Complex<T>* rbuf,
 #endif
 
     Synchronize(syncInfo);
+    if (D == Device::CPU &&
+        hierarchical::Use(
+            comm, size_t(count)*Size(comm)*sizeof(Complex<T>),
+            NativeOp<Complex<T>>(op)))
+    {
+        hierarchical::ReduceScatter(
+            sbuf, rbuf, count, TypeMap<Complex<T>>(),
+            NativeOp<Complex<T>>(op), comm);
+        return;
+    }
 
 # ifdef EL_AVOID_COMPLEX_MPI
     EL_CHECK_MPI_CALL(
@@ -112,6 +139,9 @@ void ReduceScatter(T const* sbuf, T* rbuf, int count, Op op, Comm const& comm,
     EL_DEBUG_CSE
     if (count == 0)
         return;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*Size(comm)*sizeof(*sbuf),
+        size_t(count)*sizeof(*rbuf));
 
     const int commSize = mpi::Size(comm);
     const int totalSend = count*commSize;
@@ -156,6 +186,9 @@ void ReduceScatter(T* buf, int count, Op op, Comm const& comm,
     EL_DEBUG_CSE
     if (count == 0 || Size(comm) == 1)
         return;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*Size(comm)*sizeof(*buf),
+        size_t(count)*sizeof(*buf));
 
     using Backend = BestBackend<T,D,Collective::REDUCESCATTER>;
     Al::Reduce_scatter<Backend>(
@@ -171,6 +204,9 @@ void ReduceScatter(T* buf, int count, Op op, Comm const& comm,
     EL_DEBUG_CSE
     if (count == 0 || Size(comm) == 1)
         return;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*Size(comm)*sizeof(*buf),
+        size_t(count)*sizeof(*buf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const size_c = Size(comm);
@@ -179,6 +215,14 @@ void ReduceScatter(T* buf, int count, Op op, Comm const& comm,
 #endif
 
     Synchronize(syncInfo);
+    if (D == Device::CPU &&
+        hierarchical::Use(
+            comm, size_t(count)*Size(comm)*sizeof(T), NativeOp<T>(op)))
+    {
+        hierarchical::ReduceScatter(
+            nullptr, buf, count, TypeMap<T>(), NativeOp<T>(op), comm);
+        return;
+    }
 
     EL_CHECK_MPI_CALL(
         MPI_Reduce_scatter_block(
@@ -193,6 +237,9 @@ void ReduceScatter(Complex<T>* buf, int count, Op op, Comm const& comm,
     EL_DEBUG_CSE
     if (count == 0 || Size(comm) == 1)
         return;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*Size(comm)*sizeof(*buf),
+        size_t(count)*sizeof(*buf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const size_c = Size(comm);
@@ -201,6 +248,16 @@ void ReduceScatter(Complex<T>* buf, int count, Op op, Comm const& comm,
 #endif
 
     Synchronize(syncInfo);
+    if (D == Device::CPU &&
+        hierarchical::Use(
+            comm, size_t(count)*Size(comm)*sizeof(Complex<T>),
+            NativeOp<Complex<T>>(op)))
+    {
+        hierarchical::ReduceScatter(
+            nullptr, buf, count, TypeMap<Complex<T>>(),
+            NativeOp<Complex<T>>(op), comm);
+        return;
+    }
 
 #ifdef EL_AVOID_COMPLEX_MPI
     EL_CHECK_MPI_CALL(
@@ -223,6 +280,9 @@ void ReduceScatter(T* buf, int count, Op op, Comm const& comm,
     EL_DEBUG_CSE
     if (count == 0)
         return;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*Size(comm)*sizeof(*buf),
+        size_t(count)*sizeof(*buf));
     const int commSize = mpi::Size(comm);
     const int totalSend = count*commSize;
     const int totalRecv = count;
@@ -13,6 +13,9 @@ void Scatter(
     T* rbuf, int rc, int root, Comm const& comm, SyncInfo<D> const& syncInfo )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_COMMUNICATION(
+        size_t(Rank(comm) == root ? sc*Size(comm) : 0)*sizeof(*sbuf),
+        size_t(rc)*sizeof(*rbuf));
 
     using Backend = BestBackend<T,D,Collective::GATHER>;
     Al::Scatter<Backend>(sbuf, rbuf, sc, root,
@@ -27,6 +30,10 @@ void Scatter(
     T* rbuf, int rc, int root, Comm const& comm,
     SyncInfo<D> const& syncInfo)
 {
+    EL_PROFILE_COMMUNICATION(
+        size_t(Rank(comm) == root ? sc*Size(comm) : 0)*sizeof(*sbuf),
+        size_t(rc)*sizeof(*rbuf));
+
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const commSize = Size(comm);
     auto const commRank = Rank(comm);
@@ -50,6 +57,9 @@ void Scatter(
     SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_PROFILE_COMMUNICATION(
+        size_t(Rank(comm) == root ? sc*Size(comm) : 0)*sizeof(*sbuf),
+        size_t(rc)*sizeof(*rbuf));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const commSize = Size(comm);
@@ -82,6 +92,9 @@ void Scatter(
     T* rbuf, int rc, int root, Comm const& comm, SyncInfo<D> const& syncInfo )
 {
     EL_DEBUG_CSE
+    EL_PROFILE_COMMUNICATION(
+        size_t(Rank(comm) == root ? sc*Size(comm) : 0)*sizeof(*sbuf),
+        size_t(rc)*sizeof(*rbuf));
 
     auto const commSize = Size(comm);
     auto const commRank = Rank(comm);
@@ -13,6 +13,9 @@ void SendRecv(const T* sbuf, int sc, int to,
               SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        size_t(sc)*sizeof(*sbuf),
+        size_t(rc)*sizeof(*rbuf));
 
     using Backend = BestBackend<T,D,Collective::SENDRECV>;
     Al::SendRecv<Backend>(
@@ -71,6 +74,9 @@ void SendRecv(T* buf, int count, int to, int from, Comm const& comm,
               SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE;
+    EL_PROFILE_COMMUNICATION(
+        size_t(count)*sizeof(*buf),
+        size_t(count)*sizeof(*buf));
     using Backend = BestBackend<T,D,Collective::SENDRECV>;
 
 #ifdef HYDROGEN_AL_SUPPORTS_INPLACE_SENDRECV
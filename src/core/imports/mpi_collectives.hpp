@@ -41,6 +41,7 @@ Al::ReductionOperator MPI_Op2ReductionOperator(MPI_Op op)
 
 } // namespace El
 
+#include "mpi/Hierarchical.hpp"
 #include "mpi/AllGather.hpp"
 #include "mpi/AllReduce.hpp"
 #include "mpi/AllToAll.hpp"
@@ -17,6 +17,20 @@ std::mt19937 generator;
 gmp_randstate_t gmpRandState;
 #endif
 
+// The state of the counter-based fills
+bool counterBased = true;
+std::uint64_t counterSeed = 0;
+std::uint64_t numDistFills = 0, numLocalFills = 0;
+
+// The SplitMix64 finalizer, used to decorrelate the keys of consecutive fills
+std::uint64_t Mix( std::uint64_t x )
+{
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
 }
 
 namespace El {
@@ -24,10 +38,15 @@ namespace El {
 void InitializeRandom( bool deterministic )
 {
     const unsigned rank = mpi::Rank( mpi::COMM_WORLD );
-    const long secs = ( deterministic ? 21 : time(NULL) );
+    long secs = ( deterministic ? 21 : time(NULL) );
+    if( !deterministic )
+        mpi::Broadcast
+        ( secs, 0, mpi::COMM_WORLD, SyncInfo<Device::CPU>() );
     const long seed = (secs<<16) | (rank & 0xFFFF);
 
     ::generator.seed( seed );
+    // Distributed counter-based fills require the same seed on every process
+    SetCounterBasedSeed( secs );
 
     srand( seed );
 
@@ -49,6 +68,33 @@ void FinalizeRandom()
 std::mt19937& Generator()
 { return ::generator; }
 
+void SetCounterBasedRandom( bool counterBased )
+{ ::counterBased = counterBased; }
+
+bool CounterBasedRandom()
+{ return ::counterBased; }
+
+void SetCounterBasedSeed( std::uint64_t seed )
+{
+    ::counterSeed = seed;
+    ::numDistFills = 0;
+    ::numLocalFills = 0;
+}
+
+std::uint64_t CounterBasedSeed()
+{ return ::counterSeed; }
+
+std::uint64_t NextCounterBasedKey( bool distributed )
+{
+    // Distributed fills must agree across processes, whereas local fills
+    // should differ between them
+    const std::uint64_t stream =
+      ( distributed ? 0 : 1 + std::uint64_t(mpi::Rank(mpi::COMM_WORLD)) );
+    const std::uint64_t fill =
+      ( distributed ? ::numDistFills++ : ::numLocalFills++ );
+    return Mix( Mix( ::counterSeed ^ Mix(stream) ) + fill );
+}
+
 #ifdef HYDROGEN_HAVE_MPC
 namespace mpfr {
 
@@ -0,0 +1,195 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_IO_COLLECTIVEBINARY_HPP
+#define EL_IO_COLLECTIVEBINARY_HPP
+
+#include <type_traits>
+
+namespace El {
+namespace collective_io {
+
+// The BINARY and BINARY_FLAT formats store the matrix in column-major
+// order (after an optional header), so the entries owned by a process
+// under an elemental distribution form a strided pattern in the file which
+// MPI-IO can describe with a single file view. This allows every process
+// to read or write its own entries with one collective call instead of
+// funneling the matrix through the root or seeking once per entry.
+template<typename T>
+bool Supported( const AbstractDistMatrix<T>& A )
+{
+    return A.Wrap() == ELEMENT &&
+           A.GetLocalDevice() == Device::CPU &&
+           std::is_trivially_copyable<T>::value;
+}
+
+// Unlike EL_CHECK_MPI_CALL, failed I/O operations are reported in release
+// builds as well, since they can fail for reasons outside of our control
+// (e.g., a full or unreachable filesystem).
+inline void CheckIO( int err, const char* operation )
+{
+    if( err != MPI_SUCCESS )
+        RuntimeError(operation," failed: ",mpi::GetErrorString(err));
+}
+
+// A collectively opened file over the viewing communicator of a grid
+class File
+{
+public:
+    File( const string& filename, const mpi::Comm& comm, bool write )
+    : comm_(comm)
+    {
+        EL_DEBUG_CSE
+        const int amode =
+          ( write ? MPI_MODE_CREATE|MPI_MODE_WRONLY : MPI_MODE_RDONLY );
+        const int err =
+          MPI_File_open
+          ( comm.GetMPIComm(), const_cast<char*>(filename.c_str()), amode,
+            MPI_INFO_NULL, &file_ );
+        if( err != MPI_SUCCESS )
+            RuntimeError
+            ("Could not open ",filename,": ",mpi::GetErrorString(err));
+    }
+
+    ~File()
+    {
+        if( !mpi::Finalized() )
+            MPI_File_close( &file_ );
+    }
+
+    File( const File& ) = delete;
+    File& operator=( const File& ) = delete;
+
+    Int Size() const
+    {
+        MPI_Offset size;
+        CheckIO( MPI_File_get_size( file_, &size ), "MPI_File_get_size" );
+        return size;
+    }
+
+    void Truncate( Int size )
+    { CheckIO( MPI_File_set_size( file_, size ), "MPI_File_set_size" ); }
+
+    // Read the leading integers of the file on the root of the
+    // communicator and broadcast them to the other processes
+    void ReadHeader( Int* header, int count )
+    {
+        EL_DEBUG_CSE
+        if( comm_.Rank() == 0 )
+        {
+            MPI_Status status;
+            CheckIO(
+              MPI_File_read_at
+              ( file_, 0, header, count*sizeof(Int), MPI_BYTE, &status ),
+              "MPI_File_read_at" );
+        }
+        mpi::Broadcast( header, count, 0, comm_, SyncInfo<Device::CPU>() );
+    }
+
+    void WriteHeader( const Int* header, int count )
+    {
+        EL_DEBUG_CSE
+        if( comm_.Rank() == 0 )
+        {
+            MPI_Status status;
+            CheckIO(
+              MPI_File_write_at
+              ( file_, 0, const_cast<Int*>(header), count*sizeof(Int),
+                MPI_BYTE, &status ),
+              "MPI_File_write_at" );
+        }
+    }
+
+    // Collectively read the local entries of A from the column-major
+    // matrix stored after headerBytes bytes
+    template<typename T>
+    void ReadAll( AbstractDistMatrix<T>& A, Int headerBytes )
+    {
+        EL_DEBUG_CSE
+        const bool participating = A.Participating();
+        MPI_Datatype memType = SetView( A, headerBytes, participating );
+        MPI_Status status;
+        CheckIO(
+          MPI_File_read_all
+          ( file_, A.Buffer(), participating ? 1 : 0, memType, &status ),
+          "MPI_File_read_all" );
+        EL_CHECK_MPI_CALL( MPI_Type_free( &memType ) );
+    }
+
+    // Collectively write the local entries of A. Only one member of each
+    // redundant group contributes.
+    template<typename T>
+    void WriteAll( const AbstractDistMatrix<T>& A, Int headerBytes )
+    {
+        EL_DEBUG_CSE
+        const bool participating =
+          A.Participating() && A.RedundantRank() == 0;
+        MPI_Datatype memType = SetView( A, headerBytes, participating );
+        MPI_Status status;
+        CheckIO(
+          MPI_File_write_all
+          ( file_, const_cast<T*>(A.LockedBuffer()), participating ? 1 : 0,
+            memType, &status ),
+          "MPI_File_write_all" );
+        EL_CHECK_MPI_CALL( MPI_Type_free( &memType ) );
+    }
+
+private:
+    // Set the file view of this process to the entries it owns and return
+    // the (committed) datatype describing them in the local buffer
+    template<typename T>
+    MPI_Datatype SetView
+    ( const AbstractDistMatrix<T>& A, Int headerBytes, bool participating )
+    {
+        EL_DEBUG_CSE
+        const Int localHeight = ( participating ? A.LocalHeight() : 0 );
+        const Int localWidth = ( participating ? A.LocalWidth() : 0 );
+        const MPI_Aint columnBytes = MPI_Aint(A.Height())*sizeof(T);
+
+        MPI_Datatype entryType, colType, fileType, memType;
+        EL_CHECK_MPI_CALL(
+          MPI_Type_contiguous( sizeof(T), MPI_BYTE, &entryType ) );
+        EL_CHECK_MPI_CALL( MPI_Type_commit( &entryType ) );
+        EL_CHECK_MPI_CALL(
+          MPI_Type_vector
+          ( localHeight, 1, A.ColStride(), entryType, &colType ) );
+        EL_CHECK_MPI_CALL(
+          MPI_Type_create_hvector
+          ( localWidth, 1, A.RowStride()*columnBytes, colType, &fileType ) );
+        EL_CHECK_MPI_CALL( MPI_Type_commit( &fileType ) );
+        EL_CHECK_MPI_CALL(
+          MPI_Type_create_hvector
+          ( localWidth, localHeight, MPI_Aint(A.LDim())*sizeof(T), entryType,
+            &memType ) );
+        EL_CHECK_MPI_CALL( MPI_Type_commit( &memType ) );
+
+        MPI_Offset displacement = headerBytes;
+        if( participating )
+            displacement +=
+              A.ColShift()*sizeof(T) + A.RowShift()*columnBytes;
+        char native[] = "native";
+        CheckIO(
+          MPI_File_set_view
+          ( file_, displacement, entryType, fileType, native,
+            MPI_INFO_NULL ),
+          "MPI_File_set_view" );
+
+        EL_CHECK_MPI_CALL( MPI_Type_free( &fileType ) );
+        EL_CHECK_MPI_CALL( MPI_Type_free( &colType ) );
+        EL_CHECK_MPI_CALL( MPI_Type_free( &entryType ) );
+        return memType;
+    }
+
+    MPI_File file_;
+    const mpi::Comm& comm_;
+};
+
+} // namespace collective_io
+} // namespace El
+
+#endif // ifndef EL_IO_COLLECTIVEBINARY_HPP
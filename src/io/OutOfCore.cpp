@@ -0,0 +1,230 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include "./TileStream.hpp"
+
+namespace El {
+
+namespace ooc {
+
+// The largest width such that 'numTiles' tiles of the given height fit in
+// the aggregate memory budget of the grid. If the height is zero, the tiles
+// are taken to be square.
+Int TileWidth
+( const OutOfCoreCtrl& ctrl, const Grid& g,
+  Int entrySize, Int numTiles, Int height=0 )
+{
+    if( ctrl.tileSize > 0 )
+        return ctrl.tileSize;
+    const double numEntries =
+      double(ctrl.memoryBudget)*g.Size() / double(numTiles*entrySize);
+    const Int width =
+      ( height > 0 ? Int(numEntries/height) : Int(Sqrt(numEntries)) );
+    if( width < 1 )
+        RuntimeError
+        ("A memory budget of ",ctrl.memoryBudget," bytes per process is too "
+         "small for even a single tile");
+    // Keep the tiles a multiple of the algorithmic blocksize when possible
+    const Int nb = Blocksize();
+    return ( width > nb ? (width/nb)*nb : width );
+}
+
+} // namespace ooc
+
+template<typename T>
+void OutOfCoreGemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const string& AFilename, const string& BFilename,
+  T beta, const string& CFilename,
+  const Grid& g, const OutOfCoreCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    ooc::BinaryFile<T> AFile( AFilename, false ), BFile( BFilename, false );
+    const bool normalA = ( orientA == NORMAL );
+    const bool normalB = ( orientB == NORMAL );
+    const Int m = ( normalA ? AFile.Height() : AFile.Width() );
+    const Int k = ( normalA ? AFile.Width() : AFile.Height() );
+    const Int n = ( normalB ? BFile.Width() : BFile.Height() );
+    if( k != ( normalB ? BFile.Height() : BFile.Width() ) )
+        LogicError("Nonconformal OutOfCoreGemm");
+
+    const bool readC = ( beta != T(0) );
+    if( !readC )
+    {
+        if( g.Rank() == 0 )
+            ooc::BinaryFile<T>::Create( CFilename, m, n );
+        mpi::Barrier( g.Comm() );
+    }
+    ooc::BinaryFile<T> CFile( CFilename, true );
+    if( CFile.Height() != m || CFile.Width() != n )
+        LogicError
+        ("C was ",CFile.Height()," x ",CFile.Width()," but should have been ",
+         m," x ",n);
+
+    // Each of the A, B and C tiles is double-buffered in the staging area
+    // and copied once more for the computation, while SUMMA needs roughly
+    // one more copy of the A and B tiles
+    const Int tileSize = ooc::TileWidth( ctrl, g, sizeof(T), 11 );
+    const Int mb = Max( Min(tileSize,m), Int(1) );
+    const Int nb = Max( Min(tileSize,n), Int(1) );
+    const Int kb = Max( Min(tileSize,k), Int(1) );
+    const Int numKTiles = Max( (k+kb-1)/kb, Int(1) );
+
+    vector<vector<ooc::TileRequest<T>>> steps;
+    for( Int i0=0; i0<m; i0+=mb )
+    {
+        const Int mTile = Min(mb,m-i0);
+        for( Int j0=0; j0<n; j0+=nb )
+        {
+            const Int nTile = Min(nb,n-j0);
+            for( Int kTile=0; kTile<numKTiles; ++kTile )
+            {
+                const Int k0 = kTile*kb;
+                const Int kSize = Min(kb,k-k0);
+                vector<ooc::TileRequest<T>> step;
+                if( readC && kTile == 0 )
+                    step.push_back( {&CFile,i0,j0,mTile,nTile} );
+                step.push_back
+                ( normalA ? ooc::TileRequest<T>{&AFile,i0,k0,mTile,kSize}
+                          : ooc::TileRequest<T>{&AFile,k0,i0,kSize,mTile} );
+                step.push_back
+                ( normalB ? ooc::TileRequest<T>{&BFile,k0,j0,kSize,nTile}
+                          : ooc::TileRequest<T>{&BFile,j0,k0,nTile,kSize} );
+                steps.push_back( step );
+            }
+        }
+    }
+
+    ooc::IOThread io;
+    ooc::TileReader<T> reader( g, io, std::move(steps) );
+    ooc::TileWriter<T> writer( g, io );
+    DistMatrix<T> ATile(g), BTile(g), CTile(g);
+    for( Int i0=0; i0<m; i0+=mb )
+    {
+        const Int mTile = Min(mb,m-i0);
+        for( Int j0=0; j0<n; j0+=nb )
+        {
+            const Int nTile = Min(nb,n-j0);
+            if( ctrl.progress )
+                OutputFromRoot
+                (g.Comm(),"Computing C(",i0,":",i0+mTile,",",j0,":",
+                 j0+nTile,")");
+            for( Int kTile=0; kTile<numKTiles; ++kTile )
+            {
+                const auto& tiles = reader.Next();
+                Int t = 0;
+                if( kTile == 0 )
+                {
+                    if( readC )
+                    {
+                        CTile = tiles[t++];
+                        Scale( beta, CTile );
+                    }
+                    else
+                        Zeros( CTile, mTile, nTile );
+                }
+                ATile = tiles[t++];
+                BTile = tiles[t++];
+                Gemm( orientA, orientB, alpha, ATile, BTile, T(1), CTile );
+            }
+            writer.Write( CFile, i0, j0, CTile );
+        }
+    }
+    writer.Flush();
+    mpi::Barrier( g.Comm() );
+}
+
+template<typename F>
+void OutOfCoreCholesky
+( UpperOrLower uplo, const string& filename,
+  const Grid& g, const OutOfCoreCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( uplo != LOWER )
+        LogicError("The out-of-core Cholesky is only implemented for LOWER");
+    ooc::BinaryFile<F> AFile( filename, true );
+    const Int n = AFile.Height();
+    if( AFile.Width() != n )
+        LogicError("Cholesky requires a square matrix");
+
+    // A left-looking factorization over column panels: panel k is updated
+    // by streaming in each previously factored panel j < k (restricted to
+    // rows k*nb:n), with the next one read while the current update runs.
+    // The panel being factored, the double-buffered staging area and the
+    // computational copies amount to roughly eight panels.
+    const Int nb =
+      Max( Min(ooc::TileWidth(ctrl,g,sizeof(F),8,Max(n,Int(1))),n), Int(1) );
+
+    vector<vector<ooc::TileRequest<F>>> steps;
+    for( Int k0=0; k0<n; k0+=nb )
+    {
+        const Int kb = Min(nb,n-k0);
+        steps.push_back( {{&AFile,k0,k0,n-k0,kb}} );
+        for( Int j0=0; j0<k0; j0+=nb )
+            steps.push_back( {{&AFile,k0,j0,n-k0,nb}} );
+    }
+
+    ooc::IOThread io;
+    ooc::TileReader<F> reader( g, io, std::move(steps) );
+    ooc::TileWriter<F> writer( g, io );
+    DistMatrix<F> P(g), L(g);
+    for( Int k0=0; k0<n; k0+=nb )
+    {
+        const Int kb = Min(nb,n-k0);
+        if( ctrl.progress )
+            OutputFromRoot(g.Comm(),"Factoring panel ",k0,":",k0+kb);
+        const Range<Int> ind1( 0, kb ), ind2( kb, END );
+
+        P = reader.Next()[0];
+        auto P11 = P( ind1, ALL );
+        auto P21 = P( ind2, ALL );
+        for( Int j0=0; j0<k0; j0+=nb )
+        {
+            // The panel of L was written before this read was queued, and
+            // the I/O thread processes its queue in order
+            L = reader.Next()[0];
+            auto L1 = L( ind1, ALL );
+            auto L2 = L( ind2, ALL );
+            Herk( LOWER, NORMAL, Base<F>(-1), L1, Base<F>(1), P11 );
+            Gemm( NORMAL, ADJOINT, F(-1), L2, L1, F(1), P21 );
+        }
+        Cholesky( LOWER, P11 );
+        Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), P11, P21 );
+        // The strictly upper triangle of P11 was neither updated nor
+        // factored, so writing the panel back leaves that of A untouched
+        writer.Write( AFile, k0, k0, P );
+    }
+    writer.Flush();
+    mpi::Barrier( g.Comm() );
+}
+
+#define GEMM_PROTO(T) \
+  template void OutOfCoreGemm \
+  ( Orientation orientA, Orientation orientB, \
+    T alpha, const string& AFilename, const string& BFilename, \
+    T beta, const string& CFilename, \
+    const Grid& g, const OutOfCoreCtrl& ctrl );
+
+#define CHOL_PROTO(F) \
+  template void OutOfCoreCholesky<F> \
+  ( UpperOrLower uplo, const string& filename, \
+    const Grid& g, const OutOfCoreCtrl& ctrl );
+
+// The files hold raw entries, so only types with a fixed-size
+// representation are supported
+#define PROTO(T) GEMM_PROTO(T) CHOL_PROTO(T)
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#include <El/macros/Instantiate.h>
+
+} // namespace El
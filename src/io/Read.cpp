@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 
+#include "./CollectiveBinary.hpp"
 #include "./Read/Ascii.hpp"
 #include "./Read/AsciiMatlab.hpp"
 #include "./Read/Binary.hpp"
@@ -81,8 +82,11 @@ void Read
     {
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
         {
-            Read( A.Matrix(), filename, format );
-            A.Resize( A.Matrix().Height(), A.Matrix().Width() );
+            // The local matrix of a DistMatrix cannot be resized directly
+            Matrix<T> ALoc;
+            Read( ALoc, filename, format );
+            A.Resize( ALoc.Height(), ALoc.Width() );
+            Copy( ALoc, A.Matrix() );
         }
         A.MakeSizeConsistent();
     }
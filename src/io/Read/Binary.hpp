@@ -45,6 +45,26 @@ inline void
 Binary( AbstractDistMatrix<T>& A, const string filename )
 {
     EL_DEBUG_CSE
+    if( collective_io::Supported( A ) )
+    {
+        collective_io::File file( filename, A.Grid().ViewingComm(), false );
+        Int header[2];
+        file.ReadHeader( header, 2 );
+        const Int height = header[0];
+        const Int width = header[1];
+        const Int numBytes = file.Size();
+        const Int metaBytes = 2*sizeof(Int);
+        const Int dataBytes = height*width*sizeof(T);
+        const Int numBytesExp = metaBytes + dataBytes;
+        if( numBytes != numBytesExp )
+            RuntimeError
+            ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+
+        A.Resize( height, width );
+        file.ReadAll( A, metaBytes );
+        return;
+    }
+
     std::ifstream file( filename.c_str(), std::ios::binary );
     if( !file.is_open() )
         RuntimeError("Could not open ",filename);
@@ -41,6 +41,20 @@ BinaryFlat
 ( AbstractDistMatrix<T>& A, Int height, Int width, const string filename )
 {
     EL_DEBUG_CSE
+    if( collective_io::Supported( A ) )
+    {
+        collective_io::File file( filename, A.Grid().ViewingComm(), false );
+        const Int numBytes = file.Size();
+        const Int numBytesExp = height*width*sizeof(T);
+        if( numBytes != numBytesExp )
+            RuntimeError
+            ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+
+        A.Resize( height, width );
+        file.ReadAll( A, 0 );
+        return;
+    }
+
     std::ifstream file( filename.c_str(), std::ios::binary );
     if( !file.is_open() )
         RuntimeError("Could not open ",filename);
@@ -0,0 +1,347 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_IO_TILESTREAM_HPP
+#define EL_IO_TILESTREAM_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+
+namespace El {
+namespace ooc {
+
+// Runs queued tasks, in the order they were queued, on a background thread.
+// Since the tasks only perform file I/O on buffers owned by the caller (and
+// never call MPI), no particular MPI threading level is required.
+class IOThread
+{
+public:
+    IOThread() : thread_( [this]() { Run(); } ) { }
+
+    // Finish any queued tasks before joining
+    ~IOThread()
+    {
+        {
+            std::lock_guard<std::mutex> lock( mutex_ );
+            done_ = true;
+        }
+        ready_.notify_one();
+        thread_.join();
+    }
+
+    IOThread( const IOThread& ) = delete;
+    IOThread& operator=( const IOThread& ) = delete;
+
+    std::future<void> Enqueue( std::function<void()> task )
+    {
+        std::packaged_task<void()> job( std::move(task) );
+        auto future = job.get_future();
+        {
+            std::lock_guard<std::mutex> lock( mutex_ );
+            queue_.push_back( std::move(job) );
+        }
+        ready_.notify_one();
+        return future;
+    }
+
+private:
+    void Run()
+    {
+        while( true )
+        {
+            std::packaged_task<void()> job;
+            {
+                std::unique_lock<std::mutex> lock( mutex_ );
+                ready_.wait
+                ( lock, [this]() { return done_ || !queue_.empty(); } );
+                if( queue_.empty() )
+                    return;
+                job = std::move(queue_.front());
+                queue_.pop_front();
+            }
+            // Exceptions are captured by the future of the task
+            job();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable ready_;
+    std::deque<std::packaged_task<void()>> queue_;
+    bool done_=false;
+    std::thread thread_;
+};
+
+// A matrix stored in the BINARY format (the height and width as two Int's
+// followed by the column-major entries). Each process holds its own handle
+// and only transfers the columns that it owns, so no two processes touch
+// the same bytes.
+template<typename T>
+class BinaryFile
+{
+public:
+    BinaryFile( const string& filename, bool write )
+    : filename_(filename),
+      file_
+      ( filename.c_str(),
+        write ? std::ios::binary|std::ios::in|std::ios::out :
+                std::ios::binary|std::ios::in )
+    {
+        EL_DEBUG_CSE
+        if( !file_.is_open() )
+            RuntimeError("Could not open ",filename);
+        Int header[2];
+        file_.read( reinterpret_cast<char*>(header), sizeof(header) );
+        if( !file_ )
+            RuntimeError("Could not read the header of ",filename);
+        height_ = header[0];
+        width_ = header[1];
+        file_.seekg( 0, std::ios::end );
+        const Int numBytes = file_.tellg();
+        const Int numBytesExp = MetaBytes() + height_*width_*sizeof(T);
+        if( numBytes != numBytesExp )
+            RuntimeError
+            ("Expected ",filename," to be ",numBytesExp," bytes but found ",
+             numBytes);
+    }
+
+    // Create (or truncate) a file holding a height x width matrix whose
+    // entries are left to be written later
+    static void Create( const string& filename, Int height, Int width )
+    {
+        EL_DEBUG_CSE
+        std::ofstream file
+        ( filename.c_str(), std::ios::binary|std::ios::trunc );
+        if( !file.is_open() )
+            RuntimeError("Could not open ",filename);
+        const Int header[2] = { height, width };
+        file.write( reinterpret_cast<const char*>(header), sizeof(header) );
+        if( height*width > 0 )
+        {
+            file.seekp( MetaBytes() + height*width*sizeof(T) - 1 );
+            file.put( 0 );
+        }
+        if( !file )
+            RuntimeError("Could not create ",filename);
+    }
+
+    Int Height() const EL_NO_EXCEPT { return height_; }
+    Int Width() const EL_NO_EXCEPT { return width_; }
+
+    // Transfer entries [i0,i0+height) of column j
+    void ReadColumn( Int i0, Int height, Int j, T* buffer )
+    {
+        file_.seekg( Offset(i0,j) );
+        file_.read( reinterpret_cast<char*>(buffer), height*sizeof(T) );
+        if( !file_ )
+            RuntimeError("Could not read column ",j," of ",filename_);
+    }
+    void WriteColumn( Int i0, Int height, Int j, const T* buffer )
+    {
+        file_.seekp( Offset(i0,j) );
+        file_.write
+        ( reinterpret_cast<const char*>(buffer), height*sizeof(T) );
+        if( !file_ )
+            RuntimeError("Could not write column ",j," of ",filename_);
+    }
+    void Flush() { file_.flush(); }
+
+private:
+    static Int MetaBytes() { return 2*sizeof(Int); }
+    Int Offset( Int i, Int j ) const
+    { return MetaBytes() + (i+j*height_)*sizeof(T); }
+
+    string filename_;
+    std::fstream file_;
+    Int height_, width_;
+};
+
+// Tiles are staged in a [STAR,VR] distribution so that each process
+// transfers whole (contiguous) column segments of the file. The alignment is
+// pinned so that tiles which start at the same column of the file are always
+// transferred by the same process, which is what orders a read after a
+// write of the same columns without any synchronization between processes.
+template<typename T>
+using StagedTile = DistMatrix<T,STAR,VR>;
+
+template<typename T>
+StagedTile<T> MakeStagedTile( const Grid& g )
+{
+    StagedTile<T> tile(g);
+    tile.Align( 0, 0 );
+    return tile;
+}
+
+template<typename T>
+struct TileRequest
+{
+    BinaryFile<T>* file;
+    Int i0, j0, height, width;
+};
+
+// Reads the tiles required by each step of an out-of-core algorithm, in
+// order, such that the tiles of the next step are read in the background
+// while the current step computes
+template<typename T>
+class TileReader
+{
+public:
+    TileReader
+    ( const Grid& g, IOThread& io, vector<vector<TileRequest<T>>> steps )
+    : io_(io), steps_(std::move(steps))
+    {
+        const Int maxTiles = MaxTilesPerStep();
+        for( Int buffer=0; buffer<2; ++buffer )
+        {
+            stages_[buffer].reserve( maxTiles );
+            for( Int t=0; t<maxTiles; ++t )
+                stages_[buffer].push_back( MakeStagedTile<T>(g) );
+        }
+    }
+
+    // Reads must not outlive the staging buffers
+    ~TileReader()
+    {
+        for( Int buffer=0; buffer<2; ++buffer )
+            for( auto& pending : pending_[buffer] )
+                if( pending.valid() )
+                    pending.wait();
+    }
+
+    // Return the tiles of the next step and begin reading those of the one
+    // after it. The tiles returned by the previous call are overwritten.
+    const vector<StagedTile<T>>& Next()
+    {
+        EL_DEBUG_CSE
+        if( step_ >= Int(steps_.size()) )
+            LogicError("Requested more steps than were scheduled");
+        if( step_ == 0 )
+            Issue( 0 );
+        const Int buffer = step_ % 2;
+        for( auto& pending : pending_[buffer] )
+            pending.get();
+        pending_[buffer].clear();
+        if( step_+1 < Int(steps_.size()) )
+            Issue( step_+1 );
+        ++step_;
+        return stages_[buffer];
+    }
+
+private:
+    Int MaxTilesPerStep() const
+    {
+        Int maxTiles = 0;
+        for( const auto& step : steps_ )
+            maxTiles = Max( maxTiles, Int(step.size()) );
+        return maxTiles;
+    }
+
+    void Issue( Int step )
+    {
+        const Int buffer = step % 2;
+        const Int numTiles = steps_[step].size();
+        for( Int t=0; t<numTiles; ++t )
+        {
+            const TileRequest<T> request = steps_[step][t];
+            auto& stage = stages_[buffer][t];
+            stage.Resize( request.height, request.width );
+            T* localBuf = stage.Buffer();
+            const Int localWidth = stage.LocalWidth();
+            const Int ldim = stage.LDim();
+            const Int rowShift = stage.RowShift();
+            const Int rowStride = stage.RowStride();
+            pending_[buffer].push_back
+            ( io_.Enqueue
+              ( [=]()
+                {
+                    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                        request.file->ReadColumn
+                        ( request.i0, request.height,
+                          request.j0+rowShift+jLoc*rowStride,
+                          &localBuf[jLoc*ldim] );
+                } ) );
+        }
+    }
+
+    IOThread& io_;
+    vector<vector<TileRequest<T>>> steps_;
+    Int step_=0;
+    vector<StagedTile<T>> stages_[2];
+    vector<std::future<void>> pending_[2];
+};
+
+// Writes tiles in the background, alternating between two staging buffers
+template<typename T>
+class TileWriter
+{
+public:
+    TileWriter( const Grid& g, IOThread& io )
+    : io_(io), stages_{ MakeStagedTile<T>(g), MakeStagedTile<T>(g) }
+    { }
+
+    // Writes must not outlive the staging buffers
+    ~TileWriter()
+    {
+        for( Int buffer=0; buffer<2; ++buffer )
+            if( pending_[buffer].valid() )
+                pending_[buffer].wait();
+    }
+
+    // Write A into the tile of 'file' whose top-left entry is (i0,j0)
+    void Write
+    ( BinaryFile<T>& file, Int i0, Int j0, const ElementalMatrix<T>& A )
+    {
+        EL_DEBUG_CSE
+        auto& stage = stages_[next_];
+        if( pending_[next_].valid() )
+            pending_[next_].get();
+        Copy( A, stage );
+
+        BinaryFile<T>* filePtr = &file;
+        const T* localBuf = stage.LockedBuffer();
+        const Int height = stage.Height();
+        const Int localWidth = stage.LocalWidth();
+        const Int ldim = stage.LDim();
+        const Int rowShift = stage.RowShift();
+        const Int rowStride = stage.RowStride();
+        pending_[next_] =
+          io_.Enqueue
+          ( [=]()
+            {
+                for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                    filePtr->WriteColumn
+                    ( i0, height, j0+rowShift+jLoc*rowStride,
+                      &localBuf[jLoc*ldim] );
+                filePtr->Flush();
+            } );
+        next_ = 1 - next_;
+    }
+
+    // Wait for (and check) every outstanding write
+    void Flush()
+    {
+        EL_DEBUG_CSE
+        for( Int buffer=0; buffer<2; ++buffer )
+            if( pending_[buffer].valid() )
+                pending_[buffer].get();
+    }
+
+private:
+    IOThread& io_;
+    StagedTile<T> stages_[2];
+    std::future<void> pending_[2];
+    Int next_=0;
+};
+
+} // namespace ooc
+} // namespace El
+
+#endif // ifndef EL_IO_TILESTREAM_HPP
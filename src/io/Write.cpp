@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 
+#include "./CollectiveBinary.hpp"
 #include "./Write/Ascii.hpp"
 #include "./Write/AsciiMatlab.hpp"
 #include "./Write/Binary.hpp"
@@ -78,6 +79,14 @@ void Write
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
             Write( A.LockedMatrix(), basename, format, title );
     }
+    else if( format == BINARY && collective_io::Supported( A ) )
+    {
+        write::Binary( A, basename );
+    }
+    else if( format == BINARY_FLAT && collective_io::Supported( A ) )
+    {
+        write::BinaryFlat( A, basename );
+    }
     else
     {
         DistMatrix<T,CIRC,CIRC> A_CIRC_CIRC( A );
@@ -35,6 +35,21 @@ Binary( const Matrix<T>& A, string basename="matrix" )
             file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
 }
 
+// NOTE: A must satisfy collective_io::Supported
+template<typename T>
+inline void
+Binary( const AbstractDistMatrix<T>& A, string basename="matrix" )
+{
+    EL_DEBUG_CSE
+    string filename = basename + "." + FileExtension(BINARY);
+    collective_io::File file( filename, A.Grid().ViewingComm(), true );
+    const Int metaBytes = 2*sizeof(Int);
+    file.Truncate( metaBytes + A.Height()*A.Width()*sizeof(T) );
+    const Int header[2] = { A.Height(), A.Width() };
+    file.WriteHeader( header, 2 );
+    file.WriteAll( A, metaBytes );
+}
+
 } // namespace write
 } // namespace El
 
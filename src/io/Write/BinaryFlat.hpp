@@ -30,6 +30,18 @@ BinaryFlat( const Matrix<T>& A, string basename="matrix" )
             file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
 }
 
+// NOTE: A must satisfy collective_io::Supported
+template<typename T>
+inline void
+BinaryFlat( const AbstractDistMatrix<T>& A, string basename="matrix" )
+{
+    EL_DEBUG_CSE
+    string filename = basename + "." + FileExtension(BINARY_FLAT);
+    collective_io::File file( filename, A.Grid().ViewingComm(), true );
+    file.Truncate( A.Height()*A.Width()*sizeof(T) );
+    file.WriteAll( A, 0 );
+}
+
 } // namespace write
 } // namespace El
 
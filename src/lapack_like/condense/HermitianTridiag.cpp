@@ -51,6 +51,7 @@ void Ger2Sub
 // #include "./HermitianTridiag/UpperBlockedSquare.hpp"
 
 #include "./HermitianTridiag/ApplyQ.hpp"
+#include "./HermitianTridiag/TwoStage.hpp"
 
 namespace El {
 
@@ -180,6 +181,27 @@ void ExplicitCondensed( UpperOrLower uplo, Matrix<F>& A )
         MakeTrapezoidal( UPPER, A, -1 );
 }
 
+template<typename F>
+void ExplicitCondensed
+( UpperOrLower uplo, Matrix<F>& A, const HermitianTridiagCtrl<F>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.twoStage )
+    {
+        TwoStageReflectors<F> reflectors;
+        TwoStage( uplo, A, reflectors, ctrl.bandwidth );
+    }
+    else
+    {
+        Matrix<F> householderScalars;
+        HermitianTridiag( uplo, A, householderScalars );
+    }
+    if( uplo == UPPER )
+        MakeTrapezoidal( LOWER, A, 1 );
+    else
+        MakeTrapezoidal( UPPER, A, -1 );
+}
+
 #if 0 // TOM
 
 template<typename F>
@@ -208,12 +230,27 @@ void ExplicitCondensed
     Matrix<F>& householderScalars ); \
   template void herm_tridiag::ExplicitCondensed \
   ( UpperOrLower uplo, Matrix<F>& A ); \
+  template void herm_tridiag::ExplicitCondensed \
+  ( UpperOrLower uplo, Matrix<F>& A, \
+    const HermitianTridiagCtrl<F>& ctrl ); \
   template void herm_tridiag::ApplyQ \
   ( LeftOrRight side, \
     UpperOrLower uplo, \
     Orientation orientation, \
     const Matrix<F>& A, \
     const Matrix<F>& householderScalars, \
+          Matrix<F>& B ); \
+  template void herm_tridiag::TwoStage \
+  ( UpperOrLower uplo, \
+    Matrix<F>& A, \
+    herm_tridiag::TwoStageReflectors<F>& reflectors, \
+    Int bandwidth ); \
+  template void herm_tridiag::ApplyQ \
+  ( LeftOrRight side, \
+    UpperOrLower uplo, \
+    Orientation orientation, \
+    const Matrix<F>& A, \
+    const herm_tridiag::TwoStageReflectors<F>& reflectors, \
           Matrix<F>& B );
 
 /*
@@ -0,0 +1,424 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
+#define EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
+
+namespace El {
+namespace herm_tridiag {
+
+// The two-stage reduction first applies the Gemm-rich blocked transformation
+// G1 that reduces A to a Hermitian band matrix of half-bandwidth b, and then
+// chases the bulges of the band with a sequence G2 of short reflectors,
+// H_0, H_1, ..., to reach T = G2 G1 A G1^H G2^H.
+//
+// The reflectors of G1 are packed beneath the b'th subdiagonal of A, exactly
+// as those of the one-stage reduction are packed beneath the first, and the
+// reflectors of G2 are stored one per column of reflectors.chaseReflectors.
+// The reflector H_{s,k} which chases the k'th bulge of the s'th sweep acts
+// upon rows [s+1+k b, s+(k+1) b] and is stored in column
+// ChaseOffset(s,n,b)+k.
+
+// Every reflector is of the form H = I - tau v v^H with H [chi; x] = [beta; 0]
+// (see LeftReflector).
+
+// Return sum_{m=1}^{M} ceil(m/b)
+inline Int CeilSum( Int M, Int b )
+{
+    const Int q = M / b;
+    const Int r = M - q*b;
+    return b*q*(q+1)/2 + r*(q+1);
+}
+
+// Return the number of bulge-chasing reflectors which precede the s'th sweep
+inline Int ChaseOffset( Int s, Int n, Int b )
+{
+    // Sweep t contains ceil((n-1-t)/b) reflectors
+    return CeilSum( n-1, b ) - CeilSum( n-1-s, b );
+}
+
+// Form the upper-triangular T such that
+//
+//   H_0^H H_1^H ... H_{k-1}^H = I - V T V^H,
+//
+// where column j of V is the (explicit) vector of the reflector H_j. Since
+// a scalar of zero is allowed (H_j = I), this avoids inverting the scalars.
+template<typename F>
+void FormBlockReflector
+( const Matrix<F>& V, const Matrix<F>& householderScalars, Matrix<F>& T )
+{
+    EL_DEBUG_CSE
+    const Int k = V.Width();
+    Zeros( T, k, k );
+    Matrix<F> z;
+    for( Int j=0; j<k; ++j )
+    {
+        const F tau = Conj(householderScalars(j));
+        T(j,j) = tau;
+        if( j == 0 )
+            continue;
+        // T(0:j,j) := -tau T(0:j,0:j) V(:,0:j)^H v_j
+        auto V0 = V( ALL, IR(0,j) );
+        auto vj = V( ALL, IR(j) );
+        auto T00 = T( IR(0,j), IR(0,j) );
+        auto t01 = T( IR(0,j), IR(j) );
+        Gemv( ADJOINT, F(1), V0, vj, z );
+        Gemv( NORMAL, -tau, T00, z, F(0), t01 );
+    }
+}
+
+// B := (I - V T V^H) B if orientation is NORMAL, else B := (I - V T^H V^H) B
+template<typename F>
+void ApplyBlockReflector
+( Orientation orientation,
+  const Matrix<F>& V, const Matrix<F>& T, Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    Matrix<F> Z, TZ;
+    Gemm( ADJOINT, NORMAL, F(1), V, B, Z );
+    Gemm( orientation, NORMAL, F(1), T, Z, TZ );
+    Gemm( NORMAL, NORMAL, F(-1), V, TZ, F(1), B );
+}
+
+// Overwrite the Hermitian matrix D (only its lower triangle is referenced)
+// with H D H^H, where H = I - tau v v^H
+template<typename F>
+void TwoSidedReflector( Matrix<F>& D, const Matrix<F>& v, const F& tau )
+{
+    EL_DEBUG_CSE
+    if( tau == F(0) )
+        return;
+    Matrix<F> w;
+    Zeros( w, v.Height(), 1 );
+    Hemv( LOWER, Conj(tau), D, v, F(0), w );
+    const F alpha = -Conj(tau)*Dot( w, v )/F(2);
+    Axpy( alpha, v, w );
+    Her2( LOWER, F(-1), v, w, D );
+}
+
+// Reduce the lower triangle of A to a band of half-bandwidth b using one
+// blocked reflector per panel of b columns
+template<typename F>
+void LowerToBand( Matrix<F>& A, Matrix<F>& householderScalars, Int b )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    householderScalars.Resize( Max(n-b,Int(0)), 1 );
+
+    Matrix<F> V, T, X, Z, W, z;
+    for( Int k=0; k<n-b; k+=b )
+    {
+        // The panel A(k+b:n,k:k+b) is reduced to upper-triangular form by
+        // the reflectors of its first nb columns
+        const Int nb = Min(b,n-b-k);
+        auto APan = A( IR(k+b,n), IR(k,k+b) );
+        auto A22 = A( IR(k+b,n), IR(k+b,n) );
+        auto householderScalars1 = householderScalars( IR(k,k+nb), ALL );
+        for( Int c=0; c<nb; ++c )
+        {
+            auto alpha11 = APan( IR(c), IR(c) );
+            auto a21 = APan( IR(c+1,END), IR(c) );
+            const F tau = LeftReflector( alpha11, a21 );
+            householderScalars1(c) = tau;
+            if( c+1 == b )
+                continue;
+
+            // APan(c:end,c+1:b) := (I - tau v v^H) APan(c:end,c+1:b)
+            const F beta = alpha11(0);
+            alpha11(0) = F(1);
+            auto v = APan( IR(c,END), IR(c) );
+            auto APanR = APan( IR(c,END), IR(c+1,b) );
+            Gemv( ADJOINT, F(1), APanR, v, z );
+            Ger( -tau, v, z, APanR );
+            alpha11(0) = beta;
+        }
+
+        // With P = H_0^H ... H_{nb-1}^H = I - V T V^H, overwrite A22 with
+        // P^H A22 P = A22 - V W^H - W V^H, where
+        //
+        //   X = A22 V T and W = X - (1/2) V T^H V^H X.
+        //
+        Copy( APan( ALL, IR(0,nb) ), V );
+        MakeTrapezoidal( LOWER, V );
+        FillDiagonal( V, F(1) );
+        FormBlockReflector( V, householderScalars1, T );
+
+        Zeros( Z, A22.Height(), nb );
+        Hemm( LEFT, LOWER, F(1), A22, V, F(0), Z );
+        Gemm( NORMAL, NORMAL, F(1), Z, T, X );
+        Gemm( ADJOINT, NORMAL, F(1), V, X, Z );
+        Gemm( ADJOINT, NORMAL, F(1), T, Z, W );
+        Z = X;
+        Gemm( NORMAL, NORMAL, F(-1)/F(2), V, W, F(1), Z );
+        Trrk( LOWER, NORMAL, ADJOINT, F(-1), V, Z, F(1), A22 );
+        Trrk( LOWER, NORMAL, ADJOINT, F(-1), Z, V, F(1), A22 );
+    }
+}
+
+// Chase the band of half-bandwidth b in the lower triangle of A down to
+// tridiagonal form. The band is copied into LAPACK-style band storage with
+// room for the bulges, so that the reflectors of the first stage, packed
+// beneath the band of A, are left untouched.
+template<typename F>
+void BandToTridiag
+( Matrix<F>& A, Int b,
+  Matrix<F>& chaseReflectors, Matrix<F>& chaseScalars )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Int numReflectors = ChaseOffset( Max(n-1,Int(0)), n, b );
+    Zeros( chaseReflectors, b, numReflectors );
+    Zeros( chaseScalars, numReflectors, 1 );
+
+    // Entry (i,j) of the band, with 0 <= i-j <= 2b, lives in ABand(i-j,j),
+    // so that, with a leading dimension of 2b, the submatrix with top-left
+    // entry (i,j) starts at ABand(i-j,j).
+    const Int bandLDim = 2*b+1;
+    Matrix<F> ABand;
+    Zeros( ABand, bandLDim, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=j; i<Min(j+b+1,n); ++i )
+            ABand(i-j,j) = A(i,j);
+    F* bandBuf = ABand.Buffer();
+    auto block = [&]( Int i, Int j, Int height, Int width )
+    { return Matrix<F>( height, width, &bandBuf[(i-j)+j*bandLDim], 2*b ); };
+
+    // Generate the reflector annihilating x in [chi; x], store it, and
+    // return a view of its explicit vector
+    Matrix<F> v;
+    auto reflect = [&]( Matrix<F>& x1, Int index ) -> F
+    {
+        const Int length = x1.Height();
+        auto chi = x1( IR(0), ALL );
+        auto x = x1( IR(1,END), ALL );
+        const F tau = ( length > 1 ? LeftReflector( chi, x ) : F(0) );
+        chaseScalars(index) = tau;
+        auto vStore = chaseReflectors( IR(0,length), IR(index) );
+        vStore(0) = F(1);
+        for( Int i=1; i<length; ++i )
+        {
+            vStore(i) = x(i-1);
+            x(i-1) = F(0);
+        }
+        v = vStore;
+        return tau;
+    };
+
+    Matrix<F> w, z;
+    for( Int s=0; s<n-1; ++s )
+    {
+        Int index = ChaseOffset( s, n, b );
+        Int st = s+1;
+        Int ed = Min(s+b,n-1);
+
+        // Annihilate A(st+1:ed,s) and apply the reflector to the diagonal
+        // block A(st:ed,st:ed)
+        auto a1 = block( st, s, ed-st+1, 1 );
+        F tau = reflect( a1, index );
+        auto D = block( st, st, ed-st+1, ed-st+1 );
+        TwoSidedReflector( D, v, tau );
+
+        while( ed+1 < n )
+        {
+            const Int j1 = ed+1;
+            const Int j2 = Min(ed+b,n-1);
+
+            // Apply the reflector from the right to the block beneath the
+            // diagonal block, B := B H^H, which creates a bulge
+            auto B = block( j1, st, j2-j1+1, ed-st+1 );
+            if( tau != F(0) )
+            {
+                Gemv( NORMAL, F(1), B, v, w );
+                Ger( -Conj(tau), w, v, B );
+            }
+
+            // Annihilate the first column of the bulge and apply the new
+            // reflector to the rest of it and to the next diagonal block
+            auto b1 = B( ALL, IR(0) );
+            tau = reflect( b1, ++index );
+            if( tau != F(0) && ed > st )
+            {
+                auto BR = B( ALL, IR(1,END) );
+                Gemv( ADJOINT, F(1), BR, v, z );
+                Ger( -tau, v, z, BR );
+            }
+            auto DNext = block( j1, j1, j2-j1+1, j2-j1+1 );
+            TwoSidedReflector( DNext, v, tau );
+
+            st = j1;
+            ed = j2;
+        }
+    }
+
+    // Return the tridiagonal matrix and clear the rest of the band
+    for( Int j=0; j<n; ++j )
+    {
+        A(j,j) = ABand(0,j);
+        if( j+1 < n )
+            A(j+1,j) = ABand(1,j);
+        for( Int i=j+2; i<Min(j+b,n); ++i )
+            A(i,j) = F(0);
+    }
+}
+
+// Apply G2^H (or, if orientation is ADJOINT, G2) from the left. Groups of
+// b consecutive sweeps are applied at once, as their reflectors for the same
+// bulge form a staircase of b columns which can be applied using the UT
+// transform. Within a group, the reflectors for different bulges may be
+// reordered by increasing bulge index since those that do not commute
+// overlap by at most one row in the required order.
+template<typename F>
+void ApplyChase
+( Orientation orientation, Int b,
+  const Matrix<F>& chaseReflectors, const Matrix<F>& chaseScalars,
+  Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const Int n = B.Height();
+    const Int numSweeps = Max(n-1,Int(0));
+    const Int numGroups = (numSweeps+b-1)/b;
+    const bool normal = (orientation == NORMAL);
+
+    Matrix<F> V, householderScalars1, T;
+    for( Int groupIndex=0; groupIndex<numGroups; ++groupIndex )
+    {
+        const Int group = ( normal ? numGroups-1-groupIndex : groupIndex );
+        const Int s0 = group*b;
+        const Int g = Min(b,numSweeps-s0);
+        const Int numBulges = (n-1-s0+b-1)/b;
+        for( Int bulgeIndex=0; bulgeIndex<numBulges; ++bulgeIndex )
+        {
+            const Int k = ( normal ? bulgeIndex : numBulges-1-bulgeIndex );
+            const Int rowOff = s0+1+k*b;
+            const Int height = Min(g-1+b,n-rowOff);
+            Zeros( V, height, g );
+            Zeros( householderScalars1, g, 1 );
+            for( Int c=0; c<g; ++c )
+            {
+                const Int s = s0 + c;
+                if( s+1+k*b >= n )
+                    break;
+                const Int length = Min(s+(k+1)*b,n-1) - (s+1+k*b) + 1;
+                const Int index = ChaseOffset( s, n, b ) + k;
+                for( Int i=0; i<length; ++i )
+                    V(c+i,c) = chaseReflectors(i,index);
+                householderScalars1(c) = chaseScalars(index);
+            }
+            FormBlockReflector( V, householderScalars1, T );
+            auto B1 = B( IR(rowOff,rowOff+height), ALL );
+            ApplyBlockReflector( orientation, V, T, B1 );
+        }
+    }
+}
+
+template<typename F>
+void LowerTwoStage
+( Matrix<F>& A, TwoStageReflectors<F>& reflectors, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Int b = Max(Min(bandwidth,n-1),Int(1));
+    reflectors.bandwidth = b;
+    if( b == 1 )
+    {
+        // The band reduction would already produce a tridiagonal matrix
+        LowerBlocked( A, reflectors.householderScalars );
+        reflectors.chaseReflectors.Resize( 1, 0 );
+        reflectors.chaseScalars.Resize( 0, 1 );
+        return;
+    }
+    LowerToBand( A, reflectors.householderScalars, b );
+    BandToTridiag
+    ( A, b, reflectors.chaseReflectors, reflectors.chaseScalars );
+}
+
+template<typename F>
+void TwoStage
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  TwoStageReflectors<F>& reflectors,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+    )
+    if( bandwidth <= 0 )
+        bandwidth = Blocksize();
+    if( uplo == LOWER )
+    {
+        LowerTwoStage( A, reflectors, bandwidth );
+    }
+    else
+    {
+        // The lower triangle of A^H holds the same Hermitian matrix
+        Matrix<F> AAdj;
+        Adjoint( A, AAdj );
+        LowerTwoStage( AAdj, reflectors, bandwidth );
+        Adjoint( AAdj, A );
+    }
+}
+
+template<typename F>
+void LowerApplyQ
+( Orientation orientation,
+  const Matrix<F>& A,
+  const TwoStageReflectors<F>& reflectors,
+        Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    // Q = G1^H G2^H, where G1 is packed like the one-stage reflectors
+    const Int b = reflectors.bandwidth;
+    const bool normal = (orientation == NORMAL);
+    if( normal && b > 1 )
+        ApplyChase
+        ( NORMAL, b, reflectors.chaseReflectors, reflectors.chaseScalars, B );
+    ApplyPackedReflectors
+    ( LEFT, LOWER, VERTICAL, ( normal ? BACKWARD : FORWARD ),
+      ( normal ? CONJUGATED : UNCONJUGATED ), -b,
+      A, reflectors.householderScalars, B );
+    if( !normal && b > 1 )
+        ApplyChase
+        ( ADJOINT, b, reflectors.chaseReflectors, reflectors.chaseScalars, B );
+}
+
+template<typename F>
+void ApplyQ
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  const Matrix<F>& A,
+  const TwoStageReflectors<F>& reflectors,
+        Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    Matrix<F> AAdj;
+    if( uplo == UPPER )
+        Adjoint( A, AAdj );
+    const Matrix<F>& ALower = ( uplo == LOWER ? A : AAdj );
+    if( side == LEFT )
+    {
+        LowerApplyQ( orientation, ALower, reflectors, B );
+    }
+    else
+    {
+        // B Q = (Q^H B^H)^H and B Q^H = (Q B^H)^H
+        const Orientation adjOrient =
+          ( orientation==NORMAL ? ADJOINT : NORMAL );
+        Matrix<F> BAdj;
+        Adjoint( B, BAdj );
+        LowerApplyQ( adjOrient, ALower, reflectors, BAdj );
+        Adjoint( BAdj, B );
+    }
+}
+
+} // namespace herm_tridiag
+} // namespace El
+
+#endif // ifndef EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include <El/core/Profiling.hpp>
 
 // HACK
 #ifdef HYDROGEN_HAVE_GPU
@@ -26,6 +27,26 @@ void LocalGPUCholesky(hydrogen::FillMode uplo,
 }// namespace
 #endif // HYDROGEN_HAVE_GPU
 
+namespace {
+
+El::Int choleskyLookahead = 1;
+
+}// namespace <anon>
+
+namespace El {
+
+void SetCholeskyLookahead(Int depth)
+{
+    if (depth < 0)
+        LogicError("Cholesky lookahead depth must be non-negative");
+    ::choleskyLookahead = depth;
+}
+
+Int CholeskyLookahead()
+{ return ::choleskyLookahead; }
+
+} // namespace El
+
 #include "./Cholesky/LowerVariant3.hpp"
 #include "./Cholesky/UpperVariant3.hpp"
 #include "./Cholesky/ReverseLowerVariant3.hpp"
@@ -33,6 +54,7 @@ void LocalGPUCholesky(hydrogen::FillMode uplo,
 #include "./Cholesky/PivotedLowerVariant3.hpp"
 #include "./Cholesky/PivotedUpperVariant3.hpp"
 #include "./Cholesky/SolveAfter.hpp"
+#include "./Cholesky/Batched.hpp"
 
 #include "./Cholesky/LowerMod.hpp"
 #include "./Cholesky/UpperMod.hpp"
@@ -144,6 +166,7 @@ template <typename F>
 void Cholesky(UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack)
 {
     EL_DEBUG_CSE;
+    AUTO_NOSYNC_PROFILE_REGION("Cholesky.Dist");
     if (scalapack)
     {
         cholesky::ScaLAPACKHelper(uplo, A);
@@ -262,7 +285,23 @@ void HPSDCholesky(UpperOrLower uplo, AbstractDistMatrix<F>& APre)
     template void Cholesky(                                             \
         UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack);   \
     template void Cholesky(                                             \
-        UpperOrLower uplo, DistMatrix<F,STAR,STAR>& A);
+        UpperOrLower uplo, DistMatrix<F,STAR,STAR>& A);                 \
+    template void cholesky::SolveAfter(                                 \
+        UpperOrLower uplo, Orientation orientation,                     \
+        const Matrix<F>& A, Matrix<F>& B);                              \
+    template void cholesky::SolveAfter(                                 \
+        UpperOrLower uplo, Orientation orientation,                     \
+        const AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& B);      \
+    template void CholeskyBatched(                                      \
+        UpperOrLower uplo, Int n, F* const* A, Int ALDim,               \
+        Int batchCount);                                                \
+    template void CholeskyStridedBatched(                               \
+        UpperOrLower uplo, Int n, F* A, Int ALDim, Int strideA,         \
+        Int batchCount);                                                \
+    template void CholeskyBatched(                                      \
+        UpperOrLower uplo, vector<Matrix<F>>& A);                       \
+    template void CholeskyInterleavedBatched(                           \
+        UpperOrLower uplo, Int n, F* A, Int ALDim, Int batchCount);
 
 #ifdef HYDROGEN_ENABLE_ALL_CHOLESKY
 #define PROTO_BASE(F) \
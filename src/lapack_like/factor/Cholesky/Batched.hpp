@@ -0,0 +1,199 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CHOLESKY_BATCHED_HPP
+#define EL_CHOLESKY_BATCHED_HPP
+
+namespace El {
+namespace cholesky {
+
+// Factor the n x n matrix held in A, recording rather than throwing a
+// failure since nothing may be thrown from within a threaded loop
+template<typename F>
+bool BatchMember( UpperOrLower uplo, Int n, F* A, Int ALDim )
+{
+    Matrix<F> AView;
+    AView.Attach( n, n, A, ALDim );
+    try
+    {
+        if( uplo == LOWER )
+            LowerVariant3Blocked( AView );
+        else
+            UpperVariant3Blocked( AView );
+    }
+    catch( NonHPDMatrixException& )
+    {
+        return false;
+    }
+    return true;
+}
+
+// Throw on behalf of the first batch member that was not numerically HPD
+inline void ReportBatchFailures( const vector<Int>& failed )
+{
+    const Int batchCount = failed.size();
+    for( Int b=0; b<batchCount; ++b )
+        if( failed[b] )
+        {
+            const string msg =
+              BuildString("Batch member ",b," was not numerically HPD");
+            throw NonHPDMatrixException( msg.c_str() );
+        }
+}
+
+} // namespace cholesky
+
+template<typename F>
+void CholeskyBatched
+( UpperOrLower uplo, Int n,
+  F* const* A, Int ALDim,
+  Int batchCount )
+{
+    EL_DEBUG_CSE
+    if( ALDim < Max(n,Int(1)) )
+        LogicError("Leading dimension was ",ALDim," but n was ",n);
+    vector<Int> failed( batchCount, 0 );
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchCount; ++b )
+        failed[b] = !cholesky::BatchMember( uplo, n, A[b], ALDim );
+    cholesky::ReportBatchFailures( failed );
+}
+
+template<typename F>
+void CholeskyStridedBatched
+( UpperOrLower uplo, Int n,
+  F* A, Int ALDim, Int strideA,
+  Int batchCount )
+{
+    EL_DEBUG_CSE
+    if( ALDim < Max(n,Int(1)) )
+        LogicError("Leading dimension was ",ALDim," but n was ",n);
+    vector<Int> failed( batchCount, 0 );
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchCount; ++b )
+        failed[b] = !cholesky::BatchMember( uplo, n, &A[b*strideA], ALDim );
+    cholesky::ReportBatchFailures( failed );
+}
+
+template<typename F>
+void CholeskyBatched( UpperOrLower uplo, vector<Matrix<F>>& A )
+{
+    EL_DEBUG_CSE
+    const Int batchCount = A.size();
+    for( Int b=0; b<batchCount; ++b )
+        if( A[b].Height() != A[b].Width() )
+            LogicError("Batch member ",b," was not square");
+    vector<Int> failed( batchCount, 0 );
+    EL_PARALLEL_FOR
+    for( Int b=0; b<batchCount; ++b )
+        failed[b] =
+          !cholesky::BatchMember
+          ( uplo, A[b].Height(), A[b].Buffer(), A[b].LDim() );
+    cholesky::ReportBatchFailures( failed );
+}
+
+namespace cholesky {
+
+// A right-looking unblocked factorization over the chunk [b0,b1) of an
+// interleaved batch. Members that are not numerically HPD are flagged and
+// factored with unit pivots so that the remaining lanes stay in lockstep.
+template<typename F>
+void InterleavedChunk
+( UpperOrLower uplo, Int n,
+  F* A, Int ALDim,
+  Int b0, Int b1, Int batchCount,
+  vector<Int>& failed )
+{
+    typedef Base<F> Real;
+    auto entry = [&]( Int i, Int j ) { return &A[(i+j*ALDim)*batchCount]; };
+    for( Int k=0; k<n; ++k )
+    {
+        F* alpha11 = entry(k,k);
+        EL_SIMD
+        for( Int b=b0; b<b1; ++b )
+        {
+            const Real delta = RealPart(alpha11[b]);
+            const bool positive = ( delta > Real(0) );
+            failed[b] = failed[b] || !positive;
+            alpha11[b] = Sqrt( positive ? delta : Real(1) );
+        }
+        if( uplo == LOWER )
+        {
+            for( Int i=k+1; i<n; ++i )
+            {
+                F* alpha21 = entry(i,k);
+                EL_SIMD
+                for( Int b=b0; b<b1; ++b )
+                    alpha21[b] /= RealPart(alpha11[b]);
+            }
+            for( Int j=k+1; j<n; ++j )
+            {
+                const F* alphaj1 = entry(j,k);
+                for( Int i=j; i<n; ++i )
+                {
+                    const F* alphai1 = entry(i,k);
+                    F* alpha22 = entry(i,j);
+                    EL_SIMD
+                    for( Int b=b0; b<b1; ++b )
+                        alpha22[b] -= alphai1[b]*Conj(alphaj1[b]);
+                }
+            }
+        }
+        else
+        {
+            for( Int j=k+1; j<n; ++j )
+            {
+                F* alpha12 = entry(k,j);
+                EL_SIMD
+                for( Int b=b0; b<b1; ++b )
+                    alpha12[b] /= RealPart(alpha11[b]);
+            }
+            for( Int j=k+1; j<n; ++j )
+            {
+                const F* alpha1j = entry(k,j);
+                for( Int i=k+1; i<=j; ++i )
+                {
+                    const F* alpha1i = entry(k,i);
+                    F* alpha22 = entry(i,j);
+                    EL_SIMD
+                    for( Int b=b0; b<b1; ++b )
+                        alpha22[b] -= Conj(alpha1i[b])*alpha1j[b];
+                }
+            }
+        }
+    }
+}
+
+} // namespace cholesky
+
+template<typename F>
+void CholeskyInterleavedBatched
+( UpperOrLower uplo, Int n,
+  F* A, Int ALDim,
+  Int batchCount )
+{
+    EL_DEBUG_CSE
+    if( ALDim < Max(n,Int(1)) )
+        LogicError("Leading dimension was ",ALDim," but n was ",n);
+    const Int chunkSize = 128;
+    const Int numChunks = (batchCount+chunkSize-1) / chunkSize;
+    vector<Int> failed( batchCount, 0 );
+    EL_PARALLEL_FOR
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        const Int b0 = chunk*chunkSize;
+        const Int b1 = Min(b0+chunkSize,batchCount);
+        cholesky::InterleavedChunk
+        ( uplo, n, A, ALDim, b0, b1, batchCount, failed );
+    }
+    cholesky::ReportBatchFailures( failed );
+}
+
+} // namespace El
+
+#endif // ifndef EL_CHOLESKY_BATCHED_HPP
@@ -76,6 +76,13 @@ void LowerVariant3Blocked(Matrix<F,D>& A)
     }
 }
 
+// The trailing update of each panel is split into the "lookahead"
+// window, the next CholeskyLookahead() block columns, which is applied
+// immediately, and the remainder, which is deferred until the next
+// panel has been factored. On GPUs the remainder runs on its own
+// stream, so it overlaps with the factorization and redistribution of
+// the next panel; the [* ,MC] and [* ,MR] copies of L21 are
+// double-buffered so that the deferred update can still read them.
 template <typename F, Device D>
 void LowerVariant3Blocked(AbstractDistMatrix<F>& APre, DeviceTag<D>)
 {
@@ -92,12 +99,49 @@ void LowerVariant3Blocked(AbstractDistMatrix<F>& APre, DeviceTag<D>)
     DistMatrix<F,STAR,STAR,ELEMENT,D> A11_STAR_STAR(grid);
     DistMatrix<F,VC,  STAR,ELEMENT,D> A21_VC_STAR(grid);
     DistMatrix<F,VR,  STAR,ELEMENT,D> A21_VR_STAR(grid);
-    DistMatrix<F,STAR,MC  ,ELEMENT,D> A21Trans_STAR_MC(grid);
-    DistMatrix<F,STAR,MR  ,ELEMENT,D> A21Adj_STAR_MR(grid);
+    std::vector<DistMatrix<F,STAR,MC,ELEMENT,D>> A21Trans_STAR_MC;
+    std::vector<DistMatrix<F,STAR,MR,ELEMENT,D>> A21Adj_STAR_MR;
+    for (int buffer=0; buffer<2; ++buffer)
+    {
+        A21Trans_STAR_MC.emplace_back(grid);
+        A21Adj_STAR_MR.emplace_back(grid);
+    }
 
     const Int n = A.Height();
     const Int bsize = Blocksize();
-    for(Int k=0; k<n; k+=bsize)
+    const Int lookahead = CholeskyLookahead();
+
+    auto const& mainSync = SyncInfoFromMatrix(A.LockedMatrix());
+    auto sideSync =
+      (lookahead > 0 ? CreateNewSyncInfo<D>() : mainSync);
+
+    // The deferred trailing update, A22(rem,rem) -= L21(rem) L21(rem)^H,
+    // of the panel whose redistributions are in pendingBuffer
+    Int pendingOffset = -1, pendingBuffer = 0, pendingWindow = 0;
+    auto applyPending = [&]()
+    {
+        if (pendingOffset < 0)
+            return;
+        auto& L21Trans = A21Trans_STAR_MC[pendingBuffer];
+        auto& L21Adj = A21Adj_STAR_MR[pendingBuffer];
+        const Range<Int> indRem(pendingOffset+pendingWindow, n);
+        if (indRem.beg < indRem.end)
+        {
+            const Range<Int> indRemLoc(pendingWindow, L21Trans.Width());
+            auto L21Trans_Rem = L21Trans(ALL, indRemLoc);
+            auto L21Adj_Rem = L21Adj(ALL, indRemLoc);
+            auto ARem = A(indRem, indRem);
+            SetSyncInfo(L21Trans_Rem.Matrix(), sideSync);
+            SetSyncInfo(L21Adj_Rem.Matrix(), sideSync);
+            SetSyncInfo(ARem.Matrix(), sideSync);
+            LocalTrrk(
+                LOWER, TRANSPOSE,
+                F(-1), L21Trans_Rem, L21Adj_Rem, F(1), ARem);
+        }
+        pendingOffset = -1;
+    };
+
+    for(Int k=0, buffer=0; k<n; k+=bsize, buffer=1-buffer)
     {
         const Int nb = Min(bsize,n-k);
 
@@ -107,6 +151,8 @@ void LowerVariant3Blocked(AbstractDistMatrix<F>& APre, DeviceTag<D>)
         auto A11 = A(ind1, ind1);
         auto A21 = A(ind2, ind1);
         auto A22 = A(ind2, ind2);
+        auto& A21Trans_STAR_MC_k = A21Trans_STAR_MC[buffer];
+        auto& A21Adj_STAR_MR_k = A21Adj_STAR_MR[buffer];
 
         A11_STAR_STAR = A11;
         Cholesky(LOWER, A11_STAR_STAR);
@@ -119,18 +165,57 @@ void LowerVariant3Blocked(AbstractDistMatrix<F>& APre, DeviceTag<D>)
 
         A21_VR_STAR.AlignWith(A22);
         A21_VR_STAR = A21_VC_STAR;
-        A21Trans_STAR_MC.AlignWith(A22);
-        A21Adj_STAR_MR.AlignWith(A22);
-        Transpose(A21_VC_STAR, A21Trans_STAR_MC);
-        Adjoint(A21_VR_STAR, A21Adj_STAR_MR);
+        A21Trans_STAR_MC_k.AlignWith(A22);
+        A21Adj_STAR_MR_k.AlignWith(A22);
+        Transpose(A21_VC_STAR, A21Trans_STAR_MC_k);
+        Adjoint(A21_VR_STAR, A21Adj_STAR_MR_k);
+
+        // Now that this panel is out of the way, let the previous
+        // panel's deferred update proceed; the side stream waits for
+        // this panel's redistributions, and the window below waits for
+        // the deferred update, which overlaps the window's last block
+        if (lookahead > 0)
+        {
+            applyPending();
+            AddSynchronizationPoint(mainSync, sideSync);
+            AddSynchronizationPoint(sideSync, mainSync);
+        }
 
         // (A21^T[* ,MC])^T A21^H[* ,MR] = A21[MC,* ] A21^H[* ,MR]
         //                               = (A21 A21^H)[MC,MR]
-        LocalTrrk(
-            LOWER, TRANSPOSE,
-            F(-1), A21Trans_STAR_MC, A21Adj_STAR_MR, F(1), A22);
+        const Int window = Min(lookahead*bsize, n-(k+nb));
+        if (lookahead == 0)
+        {
+            LocalTrrk(
+                LOWER, TRANSPOSE,
+                F(-1), A21Trans_STAR_MC_k, A21Adj_STAR_MR_k, F(1), A22);
+        }
+        else if (window > 0)
+        {
+            const Range<Int> indW(0, window), indB(window, n-(k+nb));
+            auto A22WW = A22(indW, indW);
+            auto A22BW = A22(indB, indW);
+            LocalTrrk(
+                LOWER, TRANSPOSE,
+                F(-1), A21Trans_STAR_MC_k(ALL, indW),
+                A21Adj_STAR_MR_k(ALL, indW), F(1), A22WW);
+            LocalGemm(
+                TRANSPOSE, NORMAL,
+                F(-1), A21Trans_STAR_MC_k(ALL, indB),
+                A21Adj_STAR_MR_k(ALL, indW), F(1), A22BW);
+
+            pendingOffset = k+nb;
+            pendingBuffer = buffer;
+            pendingWindow = window;
+        }
 
-        Transpose(A21Trans_STAR_MC, A21);
+        Transpose(A21Trans_STAR_MC_k, A21);
+    }
+    if (lookahead > 0)
+    {
+        applyPending();
+        AddSynchronizationPoint(sideSync, mainSync);
+        DestroySyncInfo(sideSync);
     }
 }
 
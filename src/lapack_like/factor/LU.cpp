@@ -151,6 +151,14 @@ void LU
     lu::Full( A, P, Q );
 }
 
+// Communication-avoiding LU (CALU): the pivots of each panel are chosen by
+// a tournament over a reduction tree (see lu::Panel) rather than by one
+// reduction per column, and are then applied to the entire block row with a
+// single exchange. The panel is then factored without further pivoting.
+//
+// The next panel is updated, and its pivots are selected, before the rest of
+// the trailing matrix is updated, so that the latency-bound tournament is
+// not stuck behind the bulk of the Gemm.
 template<typename F>
 void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
 {
@@ -161,7 +169,7 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
 
     const Grid& g = A.Grid();
     DistMatrix<F,  STAR,STAR> A11_STAR_STAR(g);
-    DistMatrix<F,  MC,  STAR> A21_MC_STAR(g);
+    DistMatrix<F,  MC,  STAR> APan_MC_STAR(g), A21_MC_STAR(g);
     DistMatrix<F,  STAR,VR  > A12_STAR_VR(g);
     DistMatrix<F,  STAR,MR  > A12_STAR_MR(g);
 
@@ -175,8 +183,14 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
 
     DistPermutation PB(g);
 
-    vector<F> panelBuf, pivotBuf;
     const Int bsize = Blocksize();
+    if( minDim > 0 )
+    {
+        auto APan = A( IR(0,m), IR(0,Min(bsize,minDim)) );
+        APan_MC_STAR.AlignWith( APan );
+        APan_MC_STAR = APan;
+        lu::Panel( APan_MC_STAR, PB );
+    }
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -189,19 +203,16 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
 
         auto AB  = A( indB, ALL );
 
-        const Int A21Height = A21.Height();
-        const Int A21LocHeight = A21.LocalHeight();
-        const Int panelLDim = nb+A21LocHeight;
-        FastResize( panelBuf, panelLDim*nb );
-        A11_STAR_STAR.Attach
-        ( nb, nb, g, 0, 0, &panelBuf[0], panelLDim, 0 );
-        A21_MC_STAR.Attach
-        ( A21Height, nb, g, A21.ColAlign(), 0, &panelBuf[nb], panelLDim, 0 );
+        PB.PermuteRows( AB );
+        P.SwapSequence( PB, k );
+
         A11_STAR_STAR = A11;
-        A21_MC_STAR = A21;
-        lu::Panel( A11_STAR_STAR, A21_MC_STAR, P, PB, k, pivotBuf );
+        LU( A11_STAR_STAR );
 
-        PB.PermuteRows( AB );
+        A21_MC_STAR.AlignWith( A22 );
+        A21_MC_STAR = A21;
+        LocalTrsm
+        ( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), A11_STAR_STAR, A21_MC_STAR );
 
         // Perhaps we should give up perfectly distributing this operation since
         // it's total contribution is only O(n^2)
@@ -212,7 +223,30 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
 
         A12_STAR_MR.AlignWith( A22 );
         A12_STAR_MR = A12_STAR_VR;
-        LocalGemm( NORMAL, NORMAL, F(-1), A21_MC_STAR, A12_STAR_MR, F(1), A22 );
+
+        const Int nbNext = Min(bsize,minDim-(k+nb));
+        if( nbNext > 0 )
+        {
+            const IR indL( 0, nbNext ), indR( nbNext, END );
+            auto A22L = A22( ALL, indL );
+            auto A22R = A22( ALL, indR );
+            LocalGemm
+            ( NORMAL, NORMAL,
+              F(-1), A21_MC_STAR, A12_STAR_MR( ALL, indL ), F(1), A22L );
+
+            APan_MC_STAR.AlignWith( A22L );
+            APan_MC_STAR = A22L;
+            lu::Panel( APan_MC_STAR, PB );
+
+            LocalGemm
+            ( NORMAL, NORMAL,
+              F(-1), A21_MC_STAR, A12_STAR_MR( ALL, indR ), F(1), A22R );
+        }
+        else
+        {
+            LocalGemm
+            ( NORMAL, NORMAL, F(-1), A21_MC_STAR, A12_STAR_MR, F(1), A22 );
+        }
 
         A11 = A11_STAR_STAR;
         A12 = A12_STAR_MR;
@@ -268,12 +302,8 @@ void LU
     Permutation& PB, \
     Int offset ); \
   template void lu::Panel \
-  ( DistMatrix<F,  STAR,STAR>& A11, \
-    DistMatrix<F,  MC,  STAR>& A21, \
-    DistPermutation& P, \
-    DistPermutation& PB, \
-    Int offset, \
-    vector<F>& pivotBuf ); \
+  ( const DistMatrix<F,MC,STAR>& APan, \
+    DistPermutation& PB ); \
   template void lu::SolveAfter \
   ( Orientation orientation, \
     const Matrix<F>& A, \
@@ -52,7 +52,7 @@ Full
         if( alpha11 == F(0) )
             throw SingularMatrixException();
         const F alpha11Inv = F(1) / alpha11;
-        a21 *= alpha11Inv;
+        Scale( alpha11Inv, a21 );
         Geru( F(-1), a21, a12, A22 );
     }
 }
@@ -100,7 +100,7 @@ Full
         if( alpha11 == F(0) )
             throw SingularMatrixException();
         const F alpha11Inv = F(1) / alpha11;
-        a21 *= alpha11Inv;
+        Scale( alpha11Inv, a21 );
         Geru( F(-1), a21, a12, A22 );
     }
 }
@@ -34,7 +34,7 @@ UnbObj( Matrix<F>& A )
         F alpha = alpha11(0);
         if( alpha == F(0) )
             throw SingularMatrixException();
-        a21 *= 1/alpha;
+        Scale( 1/alpha, a21 );
         Geru( F(-1), a21, a12, A22 );
     }
 }
@@ -59,100 +59,258 @@ void Panel( Matrix<F>& A, Permutation& P, Permutation& PB, Int offset )
     }
 }
 
-// NOTE: It is assumed that the local buffers of A[*,*] and B[MC,*] can be
-//       verticially stacked, so that the top-left local entry of B is 
-//       the n'th local entry of A[*,*]'s local buffer.
-//       Also, on entry, it is only required that process row 0 has the correct
-//       data for A.
+namespace tournament {
+
+// A set of candidate pivot rows of a panel, along with their indices within
+// the panel
+template<typename F>
+struct Candidates
+{
+    vector<Int> indices;
+    Matrix<F> rows;
+};
+
+// Run Gaussian elimination with partial pivoting on a copy of the rows of C
+// and keep the (original) rows which it selects as pivots, in pivot order.
+// Columns without a nonzero pivot are skipped rather than reported as
+// singular, since a subset of the rows of a nonsingular panel can be
+// rank-deficient.
 template<typename F>
-void Panel
-( DistMatrix<F,  STAR,STAR>& A, 
-  DistMatrix<F,  MC,  STAR>& B, 
-  DistPermutation& P,
-  DistPermutation& PB,
-  Int offset,
-  vector<F>& pivotBuffer )
+void Select
+( const Matrix<F>& C, const vector<Int>& indices, Candidates<F>& winners )
 {
     EL_DEBUG_CSE
-    typedef Base<F> Real;
-    const Int n = A.Width();
-    const Int BLocHeight = B.LocalHeight();
-    F* ABuf = A.Buffer();
-    F* BBuf = B.Buffer();
-    const Int ALDim = A.LDim();
-    const Int BLDim = B.LDim();
-    mpi::Comm colComm = B.ColComm();
-    mpi::Op maxLocOp = mpi::MaxLocOp<Real>();
-    EL_DEBUG_ONLY(
-      AssertSameGrids( A, B );
-      if( n != B.Width() )
-          LogicError("A and B must be the same width");
-      if( A.Buffer()+n != B.Buffer() )
-          LogicError("Buffers of A and B did not properly align");
-    )
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int numSelect = Min(m,n);
 
-    PB.MakeIdentity( A.Height()+B.Height() );
-    PB.ReserveSwaps( n );
+    Matrix<F> W( C );
+    F* WBuf = W.Buffer();
+    const Int WLDim = W.LDim();
+    vector<Int> order(m);
+    for( Int i=0; i<m; ++i )
+        order[i] = i;
+    for( Int k=0; k<numSelect; ++k )
+    {
+        const Int iPiv = k + blas::MaxInd( m-k, &WBuf[k+k*WLDim], 1 );
+        if( iPiv != k )
+        {
+            blas::Swap( n, &WBuf[k], WLDim, &WBuf[iPiv], WLDim );
+            std::swap( order[k], order[iPiv] );
+        }
+        const F alpha = WBuf[k+k*WLDim];
+        if( alpha == F(0) )
+            continue;
+        blas::Scal( m-(k+1), F(1)/alpha, &WBuf[(k+1)+k*WLDim], 1 );
+        blas::Geru
+        ( m-(k+1), n-(k+1),
+          F(-1), &WBuf[(k+1)+k*WLDim], 1, &WBuf[k+(k+1)*WLDim], WLDim,
+                 &WBuf[(k+1)+(k+1)*WLDim], WLDim );
+    }
 
-    pivotBuffer.resize( n );
-    for( Int k=0; k<n; ++k )
+    winners.indices.resize( numSelect );
+    winners.rows.Resize( numSelect, n );
+    for( Int i=0; i<numSelect; ++i )
     {
-        const Int ind2Size = n-k-1;
-        const F* a12Buf = &ABuf[ k    + (k+1)*ALDim];
-        const F* aB1Buf = &ABuf[ k    +  k   *ALDim];
-              F* a21Buf = &ABuf[(k+1) +  k   *ALDim];
-              F* A22Buf = &ABuf[(k+1) + (k+1)*ALDim];
+        winners.indices[i] = indices[order[i]];
+        for( Int j=0; j<n; ++j )
+            winners.rows(i,j) = C(order[i],j);
+    }
+}
 
-        // Store the index/value of the local pivot candidate
-        Int aB1LocalInd = blas::MaxInd( ind2Size+1+BLocHeight, aB1Buf, 1 ); 
-        ValueInt<Real> localPivot;
-        localPivot.value = Abs(aB1Buf[aB1LocalInd]);
-        if( aB1LocalInd+k < n )
-            localPivot.index = aB1LocalInd + k;
-        else
-            localPivot.index = B.GlobalRow(aB1LocalInd-(n-k)) + n;
+// Play the candidates of two processes against each other; both processes
+// stack the candidates in the same order so that they pick the same winners
+template<typename F>
+void Play
+( const Candidates<F>& first, const Candidates<F>& second,
+  Candidates<F>& winners )
+{
+    EL_DEBUG_CSE
+    const Int firstSize = first.indices.size();
+    const Int secondSize = second.indices.size();
+    const Int n = first.rows.Width();
+    Matrix<F> C( firstSize+secondSize, n );
+    vector<Int> indices( firstSize+secondSize );
+    for( Int i=0; i<firstSize; ++i )
+    {
+        indices[i] = first.indices[i];
+        for( Int j=0; j<n; ++j )
+            C(i,j) = first.rows(i,j);
+    }
+    for( Int i=0; i<secondSize; ++i )
+    {
+        indices[firstSize+i] = second.indices[i];
+        for( Int j=0; j<n; ++j )
+            C(firstSize+i,j) = second.rows(i,j);
+    }
+    Select( C, indices, winners );
+}
 
-        // Compute and store the location of the new pivot
-        const auto pivot = mpi::AllReduce( localPivot, maxLocOp, colComm );
-        const Int iPiv = pivot.index;
-        P.Swap( k+offset, iPiv+offset );
-        PB.Swap( k, iPiv );
+// Candidates are shipped as fixed-size messages of n+1 indices (the count
+// followed by the indices) and n x n entries, so that no sizes need to be
+// exchanged beforehand
+template<typename F>
+void Pack
+( const Candidates<F>& candidates, Int n,
+  vector<Int>& indexBuf, vector<F>& rowBuf )
+{
+    const Int count = candidates.indices.size();
+    indexBuf.assign( n+1, 0 );
+    rowBuf.assign( n*n, F(0) );
+    indexBuf[0] = count;
+    for( Int i=0; i<count; ++i )
+    {
+        indexBuf[i+1] = candidates.indices[i];
+        for( Int j=0; j<n; ++j )
+            rowBuf[i+j*n] = candidates.rows(i,j);
+    }
+}
 
-        // Perform the pivot within this panel
-        if( iPiv < n )
-        {
-            blas::Swap( n, &ABuf[iPiv], ALDim, &ABuf[k], ALDim );
-        }
+template<typename F>
+void Unpack
+( const vector<Int>& indexBuf, const vector<F>& rowBuf, Int n,
+  Candidates<F>& candidates )
+{
+    const Int count = indexBuf[0];
+    candidates.indices.resize( count );
+    candidates.rows.Resize( count, n );
+    for( Int i=0; i<count; ++i )
+    {
+        candidates.indices[i] = indexBuf[i+1];
+        for( Int j=0; j<n; ++j )
+            candidates.rows(i,j) = rowBuf[i+j*n];
+    }
+}
+
+// Select the pivot rows of the panel with a tournament over a butterfly
+// reduction tree within each process column, so that the selection costs
+// O(log p) messages rather than one reduction per column. When the number
+// of process rows is not a power of two, the extra processes first hand
+// their candidates to a partner and later receive the winners from it.
+template<typename F>
+void Tournament( const DistMatrix<F,MC,STAR>& APan, vector<Int>& pivots )
+{
+    EL_DEBUG_CSE
+    const Int n = APan.Width();
+    mpi::Comm const& comm = APan.ColComm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    SyncInfo<Device::CPU> syncInfo;
+
+    // The local round
+    Candidates<F> mine, theirs, winners;
+    {
+        const Int localHeight = APan.LocalHeight();
+        vector<Int> indices( localHeight );
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            indices[iLoc] = APan.GlobalRow( iLoc );
+        Select( APan.LockedMatrix(), indices, mine );
+    }
+
+    vector<Int> sendIndices, recvIndices(n+1);
+    vector<F> sendRows, recvRows(n*n);
+    auto play = [&]( bool mineFirst )
+    {
+        Unpack( recvIndices, recvRows, n, theirs );
+        if( mineFirst )
+            Play( mine, theirs, winners );
         else
+            Play( theirs, mine, winners );
+        std::swap( mine, winners );
+    };
+
+    int pow2 = 1;
+    while( 2*pow2 <= commSize )
+        pow2 *= 2;
+    const int numExtra = commSize - pow2;
+    if( commRank >= pow2 )
+    {
+        Pack( mine, n, sendIndices, sendRows );
+        mpi::Send( sendIndices.data(), n+1, commRank-pow2, comm, syncInfo );
+        mpi::Send( sendRows.data(), n*n, commRank-pow2, comm, syncInfo );
+    }
+    else if( commRank < numExtra )
+    {
+        mpi::Recv( recvIndices.data(), n+1, commRank+pow2, comm, syncInfo );
+        mpi::Recv( recvRows.data(), n*n, commRank+pow2, comm, syncInfo );
+        play( true );
+    }
+
+    if( commRank < pow2 )
+    {
+        for( int mask=1; mask<pow2; mask<<=1 )
         {
-            // The owning row of the pivot row packs it into the row buffer
-            // and then overwrites with the current row
-            const Int relIndex = iPiv - n;
-            const int ownerRow = B.RowOwner(relIndex);
-            if( B.IsLocalRow(relIndex) )
-            {
-                const Int iLoc = B.LocalRow(relIndex);
-                for( Int j=0; j<n; ++j )
-                    pivotBuffer[j] = BBuf[iLoc+j*BLDim];
-                for( Int j=0; j<n; ++j )
-                    BBuf[iLoc+j*BLDim] = ABuf[k+j*ALDim];
-            }
-            // The owning row broadcasts within process columns
-            mpi::Broadcast( pivotBuffer.data(), n, ownerRow, colComm );
-            // Overwrite the current row with the pivot row
-            for( Int j=0; j<n; ++j )
-                ABuf[k+j*ALDim] = pivotBuffer[j];
+            const int partner = commRank ^ mask;
+            Pack( mine, n, sendIndices, sendRows );
+            mpi::SendRecv
+            ( sendIndices.data(), n+1, partner,
+              recvIndices.data(), n+1, partner, comm, syncInfo );
+            mpi::SendRecv
+            ( sendRows.data(), n*n, partner,
+              recvRows.data(), n*n, partner, comm, syncInfo );
+            play( commRank < partner );
         }
+    }
 
-        // Now we can perform the update of the current panel
-        const F alpha = aB1Buf[0];
-        if( alpha == F(0) )
-            throw SingularMatrixException();
-        const F alpha11Inv = F(1) / alpha;
-        blas::Scal( ind2Size+BLocHeight, alpha11Inv, a21Buf, 1 );
-        blas::Geru
-        ( ind2Size+BLocHeight, ind2Size, F(-1),
-          a21Buf, 1, a12Buf, ALDim, A22Buf, ALDim );
+    if( commRank < numExtra )
+    {
+        mpi::Send
+        ( mine.indices.data(), Int(mine.indices.size()), commRank+pow2,
+          comm, syncInfo );
+        pivots = mine.indices;
+    }
+    else if( commRank >= pow2 )
+    {
+        pivots.resize( Min(APan.Height(),n) );
+        mpi::Recv
+        ( pivots.data(), Int(pivots.size()), commRank-pow2, comm, syncInfo );
+    }
+    else
+    {
+        pivots = mine.indices;
+    }
+}
+
+} // namespace tournament
+
+// Select the pivots of the [MC,* ] panel by tournament pivoting and return
+// them as the sequence of swaps, PB, which brings the winning rows (in their
+// pivot order) to the top of the panel. The panel itself is left untouched;
+// after applying PB, its leading square block may be factored without
+// pivoting.
+template<typename F>
+void Panel( const DistMatrix<F,MC,STAR>& APan, DistPermutation& PB )
+{
+    EL_DEBUG_CSE
+    const Int n = APan.Width();
+    EL_DEBUG_ONLY(
+      if( APan.Height() < n )
+          LogicError("Must be a column panel");
+    )
+    vector<Int> winners;
+    tournament::Tournament( APan, winners );
+
+    PB.SetGrid( APan.Grid() );
+    PB.MakeIdentity( APan.Height() );
+    PB.ReserveSwaps( n );
+
+    // Track the rows which have been moved by the swaps so far
+    std::map<Int,Int> rowAt, positionOf;
+    auto lookup = []( const std::map<Int,Int>& map, Int i )
+    {
+        auto it = map.find( i );
+        return ( it == map.end() ? i : it->second );
+    };
+    for( Int j=0; j<Int(winners.size()); ++j )
+    {
+        const Int row = winners[j];
+        const Int position = lookup( positionOf, row );
+        const Int displaced = lookup( rowAt, j );
+        PB.Swap( j, position );
+        rowAt[position] = displaced;
+        positionOf[displaced] = position;
+        rowAt[j] = row;
+        positionOf[row] = j;
     }
 }
 
@@ -20,7 +20,7 @@ void PermuteCols
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
-      if( A.RowComm() != oldMeta.comm )
+      if( A.RowComm().GetMPIComm() != oldMeta.comm->GetMPIComm() )
           LogicError("Invalid communicator in metadata");
       if( A.RowAlign() != oldMeta.align )
           LogicError("Invalid alignment in metadata");
@@ -58,7 +58,7 @@ void PermuteCols
         mpi::AllToAll
         ( sendData.data(), meta.recvCounts.data(), meta.recvDispls.data(),
           recvData.data(), meta.sendCounts.data(), meta.sendDispls.data(),
-          meta.comm );
+          *meta.comm, SyncInfo<Device::CPU>() );
 
         // Unpack the recv data
         offsets = meta.sendDispls;
@@ -94,7 +94,7 @@ void PermuteCols
         mpi::AllToAll
         ( sendData.data(), meta.sendCounts.data(), meta.sendDispls.data(),
           recvData.data(), meta.recvCounts.data(), meta.recvDispls.data(),
-          meta.comm );
+          *meta.comm, SyncInfo<Device::CPU>() );
 
         // Unpack the recv data
         offsets = meta.recvDispls;
@@ -117,7 +117,7 @@ void PermuteRows
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
-      if( A.ColComm() != oldMeta.comm )
+      if( A.ColComm().GetMPIComm() != oldMeta.comm->GetMPIComm() )
           LogicError("Invalid communicator in metadata");
       if( A.ColAlign() != oldMeta.align )
           LogicError("Invalid alignment in metadata");
@@ -157,7 +157,7 @@ void PermuteRows
         mpi::AllToAll
         ( sendData.data(), meta.recvCounts.data(), meta.recvDispls.data(),
           recvData.data(), meta.sendCounts.data(), meta.sendDispls.data(),
-          meta.comm );
+          *meta.comm, SyncInfo<Device::CPU>() );
 
         // Unpack the recv data
         offsets = meta.sendDispls;
@@ -196,7 +196,7 @@ void PermuteRows
         mpi::AllToAll
         ( sendData.data(), meta.sendCounts.data(), meta.sendDispls.data(),
           recvData.data(), meta.recvCounts.data(), meta.recvDispls.data(),
-          meta.comm );
+          *meta.comm, SyncInfo<Device::CPU>() );
 
         // Unpack the recv data
         offsets = meta.recvDispls;
@@ -212,6 +212,112 @@ void PermuteRows
     }
 }
 
+// Apply a sequence of row (or column) swaps with a single exchange: the
+// swaps are first composed into the map from each moved index to the index
+// whose data it receives, and then each process ships the rows it owns
+// directly to their final owners, instead of performing one point-to-point
+// exchange per swap.
+template<typename T>
+void ApplySwaps
+( AbstractDistMatrix<T>& A, const vector<std::pair<Int,Int>>& swaps,
+  bool rows )
+{
+    EL_DEBUG_CSE
+    std::map<Int,Int> source;
+    auto lookup = [&]( Int i )
+    {
+        auto it = source.find( i );
+        return ( it == source.end() ? i : it->second );
+    };
+    for( const auto& swap : swaps )
+    {
+        if( swap.first == swap.second )
+            continue;
+        const Int sourceFirst = lookup( swap.first );
+        const Int sourceSecond = lookup( swap.second );
+        source[swap.first] = sourceSecond;
+        source[swap.second] = sourceFirst;
+    }
+    if( source.empty() || !A.Participating() )
+        return;
+
+    const Dist dist = ( rows ? A.ColDist() : A.RowDist() );
+    if( A.Wrap() != ELEMENT || A.CrossSize() != 1 ||
+        dist == MD || dist == CIRC )
+    {
+        for( const auto& swap : swaps )
+        {
+            if( rows )
+                El::RowSwap( A, swap.first, swap.second );
+            else
+                El::ColSwap( A, swap.first, swap.second );
+        }
+        return;
+    }
+
+    mpi::Comm const& comm = ( rows ? A.ColComm() : A.RowComm() );
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const Int length = ( rows ? A.LocalWidth() : A.LocalHeight() );
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    auto owner = [&]( Int i ) { return rows ? A.RowOwner(i) : A.ColOwner(i); };
+    auto local = [&]( Int i ) { return rows ? A.LocalRow(i) : A.LocalCol(i); };
+
+    // Every process knows the full map, so the counts need no exchange
+    vector<int> sendCounts(commSize,0), recvCounts(commSize,0);
+    for( const auto& entry : source )
+    {
+        if( entry.first == entry.second )
+            continue;
+        const int sender = owner( entry.second );
+        const int receiver = owner( entry.first );
+        if( sender == commRank )
+            sendCounts[receiver] += length;
+        if( receiver == commRank )
+            recvCounts[sender] += length;
+    }
+    vector<int> sendDispls, recvDispls;
+    const int totalSend = Scan( sendCounts, sendDispls );
+    const int totalRecv = Scan( recvCounts, recvDispls );
+
+    vector<T> sendBuf, recvBuf;
+    FastResize( sendBuf, totalSend );
+    FastResize( recvBuf, totalRecv );
+    auto offsets = sendDispls;
+    for( const auto& entry : source )
+    {
+        if( entry.first == entry.second ||
+            owner( entry.second ) != commRank )
+            continue;
+        const Int sourceLoc = local( entry.second );
+        T* sendPtr = &sendBuf[offsets[owner(entry.first)]];
+        if( rows )
+            StridedMemCopy( sendPtr, 1, &ABuf[sourceLoc], ALDim, length );
+        else
+            MemCopy( sendPtr, &ABuf[sourceLoc*ALDim], length );
+        offsets[owner(entry.first)] += length;
+    }
+    mpi::AllToAll
+    ( sendBuf.data(), sendCounts.data(), sendDispls.data(),
+      recvBuf.data(), recvCounts.data(), recvDispls.data(), comm,
+      SyncInfo<Device::CPU>() );
+
+    offsets = recvDispls;
+    for( const auto& entry : source )
+    {
+        if( entry.first == entry.second || owner( entry.first ) != commRank )
+            continue;
+        const Int destLoc = local( entry.first );
+        const T* recvPtr = &recvBuf[offsets[owner(entry.second)]];
+        if( rows )
+            StridedMemCopy( &ABuf[destLoc], ALDim, recvPtr, 1, length );
+        else
+            MemCopy( &ABuf[destLoc*ALDim], recvPtr, length );
+        offsets[owner(entry.second)] += length;
+    }
+}
+
 void InvertPermutation
 ( const AbstractDistMatrix<Int>& pPre,
         AbstractDistMatrix<Int>& pInvPre )
@@ -243,7 +349,7 @@ void InvertPermutation
     )
 
     // Compute the send counts
-    const mpi::Comm colComm = p.ColComm();
+    mpi::Comm const& colComm = p.ColComm();
     const Int commSize = mpi::Size( colComm );
     vector<int> sendSizes(commSize,0), recvSizes(commSize,0);
     for( Int iLoc=0; iLoc<p.LocalHeight(); ++iLoc )
@@ -253,7 +359,9 @@ void InvertPermutation
         sendSizes[owner] += 2; // we'll send the global index and the value
     }
     // Perform a small AllToAll to get the receive counts
-    mpi::AllToAll( sendSizes.data(), 1, recvSizes.data(), 1, colComm );
+    mpi::AllToAll
+    ( sendSizes.data(), 1, recvSizes.data(), 1, colComm,
+      SyncInfo<Device::CPU>() );
     vector<int> sendOffs, recvOffs;
     const int sendTotal = Scan( sendSizes, sendOffs );
     const int recvTotal = Scan( recvSizes, recvOffs );
@@ -274,7 +382,8 @@ void InvertPermutation
     vector<Int> recvBuf(recvTotal);
     mpi::AllToAll
     ( sendBuf.data(), sendSizes.data(), sendOffs.data(),
-      recvBuf.data(), recvSizes.data(), recvOffs.data(), colComm );
+      recvBuf.data(), recvSizes.data(), recvOffs.data(), colComm,
+      SyncInfo<Device::CPU>() );
     SwapClear( sendBuf );
     SwapClear( sendSizes );
     SwapClear( sendOffs );
@@ -293,13 +402,9 @@ void InvertPermutation
 } // anonymous namespace
 
 DistPermutation::DistPermutation( const Grid& g )
-: grid_(&g)
+: grid_(&g), swapDests_(g), swapOrigins_(g), perm_(g), invPerm_(g)
 {
     EL_DEBUG_CSE
-    swapDests_.SetGrid( g );
-    swapOrigins_.SetGrid( g );
-    perm_.SetGrid( g );
-    invPerm_.SetGrid( g );
 }
 
 void DistPermutation::SetGrid( const Grid& g )
@@ -742,27 +847,21 @@ void DistPermutation::PermuteCols( AbstractDistMatrix<T>& A, Int offset ) const
 
         DistMatrix<Int,STAR,STAR> dests_STAR_STAR( swapDests_(activeInd,ALL) );
         auto& destsLoc = dests_STAR_STAR.Matrix();
-        if( implicitSwapOrigins_ )
-        {
-            for( Int j=0; j<numSwaps_; ++j )
-            {
-                const Int origin = j+offset;
-                const Int dest = destsLoc(j)+offset;
-                ColSwap( A, origin, dest );
-            }
-        }
-        else
+        DistMatrix<Int,STAR,STAR> origins_STAR_STAR( *grid_ );
+        if( !implicitSwapOrigins_ )
+            origins_STAR_STAR = swapOrigins_(activeInd,ALL);
+        auto& originsLoc = origins_STAR_STAR.Matrix();
+
+        vector<std::pair<Int,Int>> swaps;
+        swaps.reserve( numSwaps_ );
+        for( Int j=0; j<numSwaps_; ++j )
         {
-            DistMatrix<Int,STAR,STAR> origins_STAR_STAR =
-              swapOrigins_(activeInd,ALL);
-            auto& originsLoc = origins_STAR_STAR.Matrix();
-            for( Int j=0; j<numSwaps_; ++j )
-            {
-                const Int origin = originsLoc(j)+offset;
-                const Int dest = destsLoc(j)+offset;
-                ColSwap( A, origin, dest );
-            }
+            const Int origin =
+              ( implicitSwapOrigins_ ? j : originsLoc(j) ) + offset;
+            const Int dest = destsLoc(j)+offset;
+            swaps.emplace_back( origin, dest );
         }
+        ApplySwaps( A, swaps, false );
     }
     else
     {
@@ -786,8 +885,8 @@ void DistPermutation::PermuteCols( AbstractDistMatrix<T>& A, Int offset ) const
 
         // TODO(poulson): Query/maintain the unordered_map
         const Int align = A.RowAlign();
-        mpi::Comm comm = A.RowComm();
-        keyType_ key = std::pair<Int,mpi::Comm>(align,comm);
+        mpi::Comm const& comm = A.RowComm();
+        keyType_ key( align, comm.GetMPIComm() );
         auto data = colMeta_.find( key );
         if( data == colMeta_.end() )
         {
@@ -821,27 +920,21 @@ void DistPermutation::InversePermuteCols
 
         DistMatrix<Int,STAR,STAR> dests_STAR_STAR( swapDests_(activeInd,ALL) );
         auto& destsLoc = dests_STAR_STAR.Matrix();
-        if( implicitSwapOrigins_ )
-        {
-            for( Int j=numSwaps_-1; j>=0; --j )
-            {
-                const Int origin = j+offset;
-                const Int dest = destsLoc(j)+offset;
-                ColSwap( A, origin, dest );
-            }
-        }
-        else
+        DistMatrix<Int,STAR,STAR> origins_STAR_STAR( *grid_ );
+        if( !implicitSwapOrigins_ )
+            origins_STAR_STAR = swapOrigins_(activeInd,ALL);
+        auto& originsLoc = origins_STAR_STAR.Matrix();
+
+        vector<std::pair<Int,Int>> swaps;
+        swaps.reserve( numSwaps_ );
+        for( Int j=numSwaps_-1; j>=0; --j )
         {
-            DistMatrix<Int,STAR,STAR> origins_STAR_STAR =
-              swapOrigins_(activeInd,ALL);
-            auto& originsLoc = origins_STAR_STAR.Matrix();
-            for( Int j=numSwaps_-1; j>=0; --j )
-            {
-                const Int origin = originsLoc(j)+offset;
-                const Int dest = destsLoc(j)+offset;
-                ColSwap( A, origin, dest );
-            }
+            const Int origin =
+              ( implicitSwapOrigins_ ? j : originsLoc(j) ) + offset;
+            const Int dest = destsLoc(j)+offset;
+            swaps.emplace_back( origin, dest );
         }
+        ApplySwaps( A, swaps, false );
     }
     else
     {
@@ -865,8 +958,8 @@ void DistPermutation::InversePermuteCols
 
         // TODO(poulson): Query/maintain the unordered_map
         const Int align = A.RowAlign();
-        mpi::Comm comm = A.RowComm();
-        keyType_ key = std::pair<Int,mpi::Comm>(align,comm);
+        mpi::Comm const& comm = A.RowComm();
+        keyType_ key( align, comm.GetMPIComm() );
         auto data = colMeta_.find( key );
         if( data == colMeta_.end() )
         {
@@ -897,29 +990,23 @@ void DistPermutation::PermuteRows( AbstractDistMatrix<T>& A, Int offset ) const
 
         auto activeInd = IR(0,numSwaps_);
 
-        DistMatrix<Int,STAR,STAR> dests_STAR_STAR = swapDests_(activeInd,ALL);
+        DistMatrix<Int,STAR,STAR> dests_STAR_STAR( swapDests_(activeInd,ALL) );
         auto& destsLoc = dests_STAR_STAR.Matrix();
-        if( implicitSwapOrigins_ )
+        DistMatrix<Int,STAR,STAR> origins_STAR_STAR( *grid_ );
+        if( !implicitSwapOrigins_ )
+            origins_STAR_STAR = swapOrigins_(activeInd,ALL);
+        auto& originsLoc = origins_STAR_STAR.Matrix();
+
+        vector<std::pair<Int,Int>> swaps;
+        swaps.reserve( numSwaps_ );
+        for( Int j=0; j<numSwaps_; ++j )
         {
-            for( Int j=0; j<numSwaps_; ++j )
-            {
-                const Int origin = j+offset;
-                const Int dest = destsLoc(j)+offset;
-                El::RowSwap( A, origin, dest );
-            }
-        }
-        else
-        {
-            DistMatrix<Int,STAR,STAR> origins_STAR_STAR =
-              swapOrigins_(activeInd,ALL);
-            auto& originsLoc = origins_STAR_STAR.Matrix();
-            for( Int j=0; j<numSwaps_; ++j )
-            {
-                const Int origin = originsLoc(j)+offset;
-                const Int dest = destsLoc(j)+offset;
-                El::RowSwap( A, origin, dest );
-            }
+            const Int origin =
+              ( implicitSwapOrigins_ ? j : originsLoc(j) ) + offset;
+            const Int dest = destsLoc(j)+offset;
+            swaps.emplace_back( origin, dest );
         }
+        ApplySwaps( A, swaps, true );
     }
     else
     {
@@ -943,8 +1030,8 @@ void DistPermutation::PermuteRows( AbstractDistMatrix<T>& A, Int offset ) const
 
         // TODO(poulson): Query/maintain the unordered_map
         const Int align = A.ColAlign();
-        mpi::Comm comm = A.ColComm();
-        keyType_ key = std::pair<Int,mpi::Comm>(align,comm);
+        mpi::Comm const& comm = A.ColComm();
+        keyType_ key( align, comm.GetMPIComm() );
         auto data = rowMeta_.find( key );
         if( data == rowMeta_.end() )
         {
@@ -977,29 +1064,23 @@ void DistPermutation::InversePermuteRows
 
         auto activeInd = IR(0,numSwaps_);
 
-        DistMatrix<Int,STAR,STAR> dests_STAR_STAR = swapDests_(activeInd,ALL);
+        DistMatrix<Int,STAR,STAR> dests_STAR_STAR( swapDests_(activeInd,ALL) );
         auto& destsLoc = dests_STAR_STAR.Matrix();
-        if( implicitSwapOrigins_ )
-        {
-            for( Int j=numSwaps_-1; j>=0; --j )
-            {
-                const Int origin = j+offset;
-                const Int dest = destsLoc(j)+offset;
-                El::RowSwap( A, origin, dest );
-            }
-        }
-        else
+        DistMatrix<Int,STAR,STAR> origins_STAR_STAR( *grid_ );
+        if( !implicitSwapOrigins_ )
+            origins_STAR_STAR = swapOrigins_(activeInd,ALL);
+        auto& originsLoc = origins_STAR_STAR.Matrix();
+
+        vector<std::pair<Int,Int>> swaps;
+        swaps.reserve( numSwaps_ );
+        for( Int j=numSwaps_-1; j>=0; --j )
         {
-            DistMatrix<Int,STAR,STAR> origins_STAR_STAR =
-              swapOrigins_(activeInd,ALL);
-            auto& originsLoc = origins_STAR_STAR.Matrix();
-            for( Int j=numSwaps_-1; j>=0; --j )
-            {
-                const Int origin = originsLoc(j)+offset;
-                const Int dest = destsLoc(j)+offset;
-                El::RowSwap( A, origin, dest );
-            }
+            const Int origin =
+              ( implicitSwapOrigins_ ? j : originsLoc(j) ) + offset;
+            const Int dest = destsLoc(j)+offset;
+            swaps.emplace_back( origin, dest );
         }
+        ApplySwaps( A, swaps, true );
     }
     else
     {
@@ -1023,8 +1104,8 @@ void DistPermutation::InversePermuteRows
 
         // TODO(poulson): Query/maintain the unordered_map
         const Int align = A.ColAlign();
-        mpi::Comm comm = A.ColComm();
-        keyType_ key = std::pair<Int,mpi::Comm>(align,comm);
+        mpi::Comm const& comm = A.ColComm();
+        keyType_ key( align, comm.GetMPIComm() );
         auto data = rowMeta_.find( key );
         if( data == rowMeta_.end() )
         {
@@ -47,8 +47,6 @@ Base<Ring> SymmetricInfinityNorm( UpperOrLower uplo, const Matrix<Ring>& A )
     return HermitianInfinityNorm( uplo, A );
 }
 
-#if 0 // TOM
-
 template<typename Ring>
 Base<Ring> InfinityNorm( const AbstractDistMatrix<Ring>& A )
 {
@@ -61,7 +59,9 @@ Base<Ring> InfinityNorm( const AbstractDistMatrix<Ring>& A )
     {
         const Int localHeight = A.LocalHeight();
         const Int localWidth = A.LocalWidth();
-        const Matrix<Ring>& ALoc = A.LockedMatrix();
+        AbstractMatrixReadDeviceProxy<Ring,Device::CPU>
+          ALocProxy( A.LockedMatrix() );
+        const auto& ALoc = ALocProxy.GetLocked();
 
         vector<Real> myPartialRowSums( localHeight );
         for( Int iLoc=0; iLoc<localHeight; ++iLoc )
@@ -74,7 +74,8 @@ Base<Ring> InfinityNorm( const AbstractDistMatrix<Ring>& A )
         // Sum our partial row sums to get the row sums over A[U,* ]
         vector<Real> myRowSums( localHeight );
         mpi::AllReduce
-        ( myPartialRowSums.data(), myRowSums.data(), localHeight, A.RowComm() );
+        ( myPartialRowSums.data(), myRowSums.data(), localHeight, A.RowComm(),
+          SyncInfo<Device::CPU>() );
 
         // Find the maximum out of the row sums
         Real myMaxRowSum = 0;
@@ -87,9 +88,11 @@ Base<Ring> InfinityNorm( const AbstractDistMatrix<Ring>& A )
         }
 
         // Find the global maximum row sum by searching over the U team
-        norm = mpi::AllReduce( myMaxRowSum, mpi::MAX, A.ColComm() );
+        norm = mpi::AllReduce
+        ( myMaxRowSum, mpi::MAX, A.ColComm(), SyncInfo<Device::CPU>() );
     }
-    mpi::Broadcast( norm, A.Root(), A.CrossComm() );
+    mpi::Broadcast
+    ( norm, A.Root(), A.CrossComm(), SyncInfo<Device::CPU>() );
     return norm;
 }
 
@@ -109,8 +112,6 @@ Base<Ring> SymmetricInfinityNorm
     return HermitianInfinityNorm( uplo, A );
 }
 
-#endif // 0 TOM
-
 template<typename Ring>
 Base<Ring> HermitianTridiagInfinityNorm
 ( const Matrix<Base<Ring>>& d, const Matrix<Ring>& e )
@@ -121,20 +122,17 @@ Base<Ring> HermitianTridiagInfinityNorm
 
 #define PROTO(Ring) \
   template Base<Ring> InfinityNorm( const Matrix<Ring>& A ); \
+  template Base<Ring> InfinityNorm ( const AbstractDistMatrix<Ring>& A ); \
   template Base<Ring> HermitianInfinityNorm \
   ( UpperOrLower uplo, const Matrix<Ring>& A ); \
-  template Base<Ring> SymmetricInfinityNorm \
-  ( UpperOrLower uplo, const Matrix<Ring>& A ); \
-  template Base<Ring> HermitianTridiagInfinityNorm \
-  ( const Matrix<Base<Ring>>& d, const Matrix<Ring>& e );
-
-/*
-  template Base<Ring> InfinityNorm ( const AbstractDistMatrix<Ring>& A ); \
   template Base<Ring> HermitianInfinityNorm \
   ( UpperOrLower uplo, const AbstractDistMatrix<Ring>& A ); \
   template Base<Ring> SymmetricInfinityNorm \
+  ( UpperOrLower uplo, const Matrix<Ring>& A ); \
+  template Base<Ring> SymmetricInfinityNorm \
   ( UpperOrLower uplo, const AbstractDistMatrix<Ring>& A ); \
-*/
+  template Base<Ring> HermitianTridiagInfinityNorm \
+  ( const Matrix<Base<Ring>>& d, const Matrix<Ring>& e );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -53,8 +53,6 @@ Base<Ring> HermitianMaxNorm( UpperOrLower uplo, const Matrix<Ring>& A )
     return maxAbs;
 }
 
-#if 0 // TOM
-
 template<typename Ring>
 Base<Ring> SymmetricMaxNorm( UpperOrLower uplo, const Matrix<Ring>& A )
 {
@@ -69,10 +67,14 @@ Base<Ring> MaxNorm( const AbstractDistMatrix<Ring>& A )
     Base<Ring> norm=0;
     if( A.Participating() )
     {
-        Base<Ring> localMaxAbs = MaxNorm( A.LockedMatrix() );
-        norm = mpi::AllReduce( localMaxAbs, mpi::MAX, A.DistComm() );
+        AbstractMatrixReadDeviceProxy<Ring,Device::CPU>
+          ALocProxy( A.LockedMatrix() );
+        Base<Ring> localMaxAbs = MaxNorm( ALocProxy.GetLocked() );
+        norm = mpi::AllReduce
+        ( localMaxAbs, mpi::MAX, A.DistComm(), SyncInfo<Device::CPU>() );
     }
-    mpi::Broadcast( norm, A.Root(), A.CrossComm() );
+    mpi::Broadcast
+    ( norm, A.Root(), A.CrossComm(), SyncInfo<Device::CPU>() );
     return norm;
 }
 
@@ -90,7 +92,9 @@ HermitianMaxNorm( UpperOrLower uplo, const AbstractDistMatrix<Ring>& A )
     {
         const Int localWidth = A.LocalWidth();
         const Int localHeight = A.LocalHeight();
-        const Matrix<Ring>& ALoc = A.LockedMatrix();
+        AbstractMatrixReadDeviceProxy<Ring,Device::CPU>
+          ALocProxy( A.LockedMatrix() );
+        const auto& ALoc = ALocProxy.GetLocked();
 
         Real localMaxAbs = 0;
         if( uplo == UPPER )
@@ -113,9 +117,11 @@ HermitianMaxNorm( UpperOrLower uplo, const AbstractDistMatrix<Ring>& A )
                     localMaxAbs = Max(localMaxAbs,Abs(ALoc(iLoc,jLoc)));
             }
         }
-        norm = mpi::AllReduce( localMaxAbs, mpi::MAX, A.DistComm() );
+        norm = mpi::AllReduce
+        ( localMaxAbs, mpi::MAX, A.DistComm(), SyncInfo<Device::CPU>() );
     }
-    mpi::Broadcast( norm, A.Root(), A.CrossComm() );
+    mpi::Broadcast
+    ( norm, A.Root(), A.CrossComm(), SyncInfo<Device::CPU>() );
     return norm;
 }
 
@@ -127,22 +133,17 @@ SymmetricMaxNorm( UpperOrLower uplo, const AbstractDistMatrix<Ring>& A )
     return HermitianMaxNorm( uplo, A );
 }
 
-#endif // 0 TOM
-
 #define PROTO(Ring) \
   template Base<Ring> MaxNorm( const Matrix<Ring>& A ); \
-  template Base<Ring> HermitianMaxNorm \
-  ( UpperOrLower uplo, const Matrix<Ring>& A );
-
-/*
   template Base<Ring> MaxNorm ( const AbstractDistMatrix<Ring>& A ); \
   template Base<Ring> HermitianMaxNorm \
+  ( UpperOrLower uplo, const Matrix<Ring>& A ); \
+  template Base<Ring> HermitianMaxNorm \
   ( UpperOrLower uplo, const AbstractDistMatrix<Ring>& A ); \
   template Base<Ring> SymmetricMaxNorm \
   ( UpperOrLower uplo, const Matrix<Ring>& A ); \
   template Base<Ring> SymmetricMaxNorm \
   ( UpperOrLower uplo, const AbstractDistMatrix<Ring>& A );
-*/
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -74,8 +74,6 @@ Base<Ring> SymmetricOneNorm( UpperOrLower uplo, const Matrix<Ring>& A )
     return HermitianOneNorm( uplo, A );
 }
 
-#if 0 // TOM
-
 template<typename Ring>
 Base<Ring> OneNorm( const AbstractDistMatrix<Ring>& A )
 {
@@ -87,7 +85,9 @@ Base<Ring> OneNorm( const AbstractDistMatrix<Ring>& A )
         // Compute the partial column sums defined by our local matrix, A[U,V]
         const Int localHeight = A.LocalHeight();
         const Int localWidth = A.LocalWidth();
-        const Matrix<Ring>& ALoc = A.LockedMatrix();
+        AbstractMatrixReadDeviceProxy<Ring,Device::CPU>
+          ALocProxy( A.LockedMatrix() );
+        const auto& ALoc = ALocProxy.GetLocked();
 
         vector<Real> myPartialColSums( localWidth );
         for( Int jLoc=0; jLoc<localWidth; ++jLoc )
@@ -100,7 +100,8 @@ Base<Ring> OneNorm( const AbstractDistMatrix<Ring>& A )
         // Sum our partial column sums to get the column sums over A[* ,V]
         vector<Real> myColSums( localWidth );
         mpi::AllReduce
-        ( myPartialColSums.data(), myColSums.data(), localWidth, A.ColComm() );
+        ( myPartialColSums.data(), myColSums.data(), localWidth, A.ColComm(),
+          SyncInfo<Device::CPU>() );
 
         // Find the maximum out of the column sums
         Real myMaxColSum = 0;
@@ -108,9 +109,11 @@ Base<Ring> OneNorm( const AbstractDistMatrix<Ring>& A )
             myMaxColSum = Max( myMaxColSum, myColSums[jLoc] );
 
         // Find the global maximum column sum by searching the row team
-        norm = mpi::AllReduce( myMaxColSum, mpi::MAX, A.RowComm() );
+        norm = mpi::AllReduce
+        ( myMaxColSum, mpi::MAX, A.RowComm(), SyncInfo<Device::CPU>() );
     }
-    mpi::Broadcast( norm, A.Root(), A.CrossComm() );
+    mpi::Broadcast
+    ( norm, A.Root(), A.CrossComm(), SyncInfo<Device::CPU>() );
     return norm;
 }
 
@@ -133,7 +136,9 @@ HermitianOneNorm( UpperOrLower uplo, const AbstractDistMatrix<Ring>& A )
     {
         const Int localHeight = A.LocalHeight();
         const Int localWidth = A.LocalWidth();
-        const Matrix<Ring>& ALoc = A.LockedMatrix();
+        AbstractMatrixReadDeviceProxy<Ring,Device::CPU>
+          ALocProxy( A.LockedMatrix() );
+        const auto& ALoc = ALocProxy.GetLocked();
 
         if( uplo == UPPER )
         {
@@ -172,7 +177,8 @@ HermitianOneNorm( UpperOrLower uplo, const AbstractDistMatrix<Ring>& A )
             }
             vector<Real> colSums( height );
             mpi::AllReduce
-            ( partialColSums.data(), colSums.data(), height, A.DistComm() );
+            ( partialColSums.data(), colSums.data(), height, A.DistComm(),
+              SyncInfo<Device::CPU>() );
 
             // Find the maximum sum
             for( Int j=0; j<height; ++j )
@@ -215,14 +221,16 @@ HermitianOneNorm( UpperOrLower uplo, const AbstractDistMatrix<Ring>& A )
             }
             vector<Real> colSums( height );
             mpi::AllReduce
-            ( partialColSums.data(), colSums.data(), height, A.DistComm() );
+            ( partialColSums.data(), colSums.data(), height, A.DistComm(),
+              SyncInfo<Device::CPU>() );
 
             // Find the maximum sum
             for( Int j=0; j<height; ++j )
                 maxColSum = Max( maxColSum, colSums[j] );
         }
     }
-    mpi::Broadcast( maxColSum, A.Root(), A.CrossComm() );
+    mpi::Broadcast
+    ( maxColSum, A.Root(), A.CrossComm(), SyncInfo<Device::CPU>() );
     return maxColSum;
 }
 
@@ -234,8 +242,6 @@ SymmetricOneNorm( UpperOrLower uplo, const AbstractDistMatrix<Ring>& A )
     return HermitianOneNorm( uplo, A );
 }
 
-#endif // 0 TOM
-
 template<typename Ring>
 Base<Ring> HermitianTridiagOneNorm
 ( const Matrix<Base<Ring>>& d, const Matrix<Ring>& e )
@@ -265,20 +271,17 @@ Base<Ring> HermitianTridiagOneNorm
 
 #define PROTO(Ring) \
   template Base<Ring> OneNorm( const Matrix<Ring>& A ); \
+  template Base<Ring> OneNorm ( const AbstractDistMatrix<Ring>& A ); \
   template Base<Ring> HermitianOneNorm \
   ( UpperOrLower uplo, const Matrix<Ring>& A ); \
-  template Base<Ring> SymmetricOneNorm \
-  ( UpperOrLower uplo, const Matrix<Ring>& A ); \
-  template Base<Ring> HermitianTridiagOneNorm \
-  ( const Matrix<Base<Ring>>& d, const Matrix<Ring>& e );
-
-/*
-  template Base<Ring> OneNorm ( const AbstractDistMatrix<Ring>& A ); \
   template Base<Ring> HermitianOneNorm \
   ( UpperOrLower uplo, const AbstractDistMatrix<Ring>& A ); \
   template Base<Ring> SymmetricOneNorm \
+  ( UpperOrLower uplo, const Matrix<Ring>& A ); \
+  template Base<Ring> SymmetricOneNorm \
   ( UpperOrLower uplo, const AbstractDistMatrix<Ring>& A ); \
-*/
+  template Base<Ring> HermitianTridiagOneNorm \
+  ( const Matrix<Base<Ring>>& d, const Matrix<Ring>& e );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
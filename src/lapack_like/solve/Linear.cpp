@@ -16,13 +16,7 @@ template<typename Field>
 void Panel( Matrix<Field>& APan, Permutation& P, Permutation& p1, Int offset );
 
 template<typename Field>
-void Panel
-( DistMatrix<Field,STAR,STAR>& A11,
-  DistMatrix<Field,MC,  STAR>& A21,
-  DistPermutation& P,
-  DistPermutation& PB,
-  Int offset,
-  vector<Field>& pivotBuf );
+void Panel( const DistMatrix<Field,MC,STAR>& APan, DistPermutation& PB );
 
 } // namespace lu
 
@@ -100,13 +94,12 @@ void RowEchelon( DistMatrix<Field>& A, DistMatrix<Field>& B )
     DistMatrix<Field,STAR,STAR> A11_STAR_STAR(grid);
     DistMatrix<Field,STAR,VR  > A12_STAR_VR(grid), B1_STAR_VR(grid);
     DistMatrix<Field,STAR,MR  > A12_STAR_MR(grid), B1_STAR_MR(grid);
-    DistMatrix<Field,MC,  STAR> A21_MC_STAR(grid);
+    DistMatrix<Field,MC,  STAR> APan_MC_STAR(grid), A21_MC_STAR(grid);
 
     // In case B's columns are not aligned with A's
     const bool BAligned = ( B.ColShift() == A.ColShift() );
     DistMatrix<Field,MC,STAR> A21_MC_STAR_B(grid);
 
-    vector<Field> panelBuf, pivotBuf;
     for( Int k=0; k<minDimA; k+=bsize )
     {
         const Int nb = Min(bsize,minDimA-k);
@@ -115,25 +108,27 @@ void RowEchelon( DistMatrix<Field>& A, DistMatrix<Field>& B )
         auto A12 = A( ind1, ind2 );
         auto A21 = A( ind2, ind1 );
         auto A22 = A( ind2, ind2 );
-        auto AB2 = A( indB, ind2 );
+        auto APan = A( indB, ind1 );
+        auto AB  = A( indB, indB );
         auto B1  = B( ind1, ALL  );
         auto B2  = B( ind2, ALL  );
         auto BB  = B( indB, ALL  );
 
-        const Int A21Height = A21.Height();
-        const Int A21LocHeight = A21.LocalHeight();
-        const Int panelLDim = nb+A21LocHeight;
-        FastResize( panelBuf, panelLDim*nb );
-        A11_STAR_STAR.Attach
-        ( nb, nb, grid, 0, 0, &panelBuf[0], panelLDim, 0 );
-        A21_MC_STAR.Attach
-        ( A21Height, nb, grid, A21.ColAlign(), 0,
-          &panelBuf[nb], panelLDim, 0 );
+        // Choose the pivots by a tournament and apply them to both sides
+        APan_MC_STAR.AlignWith( APan );
+        APan_MC_STAR = APan;
+        lu::Panel( APan_MC_STAR, PB );
+        PB.PermuteRows( AB );
+        PB.PermuteRows( BB );
+        P.SwapSequence( PB, k );
+
         A11_STAR_STAR = A11;
+        LU( A11_STAR_STAR );
+        A21_MC_STAR.AlignWith( A22 );
         A21_MC_STAR = A21;
-        lu::Panel( A11_STAR_STAR, A21_MC_STAR, P, PB, k, pivotBuf );
-        PB.PermuteRows( AB2 );
-        PB.PermuteRows( BB );
+        LocalTrsm
+        ( RIGHT, UPPER, NORMAL, NON_UNIT, Field(1), A11_STAR_STAR,
+          A21_MC_STAR );
 
         A12_STAR_VR.AlignWith( A22 );
         A12_STAR_VR = A12;
@@ -167,6 +162,7 @@ void RowEchelon( DistMatrix<Field>& A, DistMatrix<Field>& B )
 
         A11 = A11_STAR_STAR;
         A12 = A12_STAR_MR;
+        A21 = A21_MC_STAR;
         B1 = B1_STAR_MR;
     }
 }
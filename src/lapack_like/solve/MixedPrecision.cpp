@@ -0,0 +1,528 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// The classical refinement follows LAPACK's [d,z]sgesv, while the GMRES-based
+// refinement (GMRES-IR) is that of
+//
+//   Erin Carson and Nicholas J. Higham,
+//   "Accelerating the solution of linear systems by iterative refinement in
+//    three precisions",
+//   SIAM J. Sci. Comput., Vol. 40, No. 2, pp. A817--A847, 2018.
+//
+// Every routine below is templated over the matrix type so that the same
+// code drives both the sequential and the distributed solvers. In either
+// case, 'applyA' should have the form
+//
+//   void applyA( Field alpha, const MatType& X, Field beta, MatType& Y )
+//
+// and overwrite Y := alpha A X + beta Y, while 'applyMInv' should have the
+// form
+//
+//   void applyMInv( MatType& R )
+//
+// and overwrite R with inv(M) R, where M is the low-precision factorization.
+
+namespace El {
+
+namespace mixed_solve {
+
+// Whether this process should report progress
+template<typename Field>
+bool IsRoot( const Matrix<Field>& A ) { return true; }
+template<typename Field>
+bool IsRoot( const DistMatrix<Field>& A ) { return A.Grid().Rank() == 0; }
+
+// Return the largest normwise backward error over the columns of X (and
+// store each of them in 'errors')
+template<typename Field,class MatType>
+Base<Field> BackwardError
+( Base<Field> normA,
+  const MatType& B,
+  const MatType& X,
+  const MatType& R,
+  Matrix<Base<Field>>& errors )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int width = B.Width();
+    Zeros( errors, width, 1 );
+    // MaxNorm silently skips NaNs, so check for them explicitly
+    if( !limits::IsFinite(FrobeniusNorm(X)) ||
+        !limits::IsFinite(FrobeniusNorm(R)) )
+        return limits::Infinity<Real>();
+    Real maxError = Real(0);
+    for( Int j=0; j<width; ++j )
+    {
+        const Real residNorm = MaxNorm( R( ALL, IR(j) ) );
+        const Real scale =
+          normA*MaxNorm( X( ALL, IR(j) ) ) + MaxNorm( B( ALL, IR(j) ) );
+        const Real error = ( scale == Real(0) ? residNorm : residNorm/scale );
+        if( !limits::IsFinite(error) )
+            return limits::Infinity<Real>();
+        errors(j) = error;
+        maxError = Max( maxError, error );
+    }
+    return maxError;
+}
+
+// Solve the correction equation A d = r with restarted GMRES applied to the
+// left-preconditioned system inv(M) A d = inv(M) r, starting from d = 0.
+// The number of iterations is returned. The Krylov basis is kept as separate
+// copies of 'r' so that every vector shares its alignment.
+template<typename Field,class MatType,class ApplyAType,class ApplyMInvType>
+Int GMRES
+( const ApplyAType& applyA,
+  const ApplyMInvType& applyMInv,
+  const MatType& r,
+        MatType& d,
+        Base<Field> relTol,
+        Int restart,
+        Int maxIts )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = r.Height();
+    Zeros( d, n, 1 );
+
+    // w := inv(M) r
+    MatType w( r );
+    applyMInv( w );
+    const Real origNorm = FrobeniusNorm( w );
+    if( origNorm == Real(0) )
+        return 0;
+
+    Int its = 0;
+    Matrix<Real> cs;
+    Matrix<Field> sn, H, t;
+    vector<MatType> V( restart+1, r );
+    while( its < maxIts )
+    {
+        const Real beta = FrobeniusNorm( w );
+        if( beta <= relTol*origNorm )
+            break;
+
+        Zeros( cs, restart, 1 );
+        Zeros( sn, restart, 1 );
+        Zeros( H, restart, restart );
+        Zeros( t, restart+1, 1 );
+        t(0) = beta;
+
+        // v_0 := w / beta
+        V[0] = w;
+        Scale( Field(1/beta), V[0] );
+
+        Int k = 0;
+        for( Int j=0; j<restart && its<maxIts; ++j )
+        {
+            // w := inv(M) A v_j
+            applyA( Field(1), V[j], Field(0), w );
+            applyMInv( w );
+
+            // Run the j'th step of (modified Gram-Schmidt) Arnoldi
+            for( Int i=0; i<=j; ++i )
+            {
+                H(i,j) = Dot( V[i], w );
+                Axpy( -H(i,j), V[i], w );
+            }
+            const Real delta = FrobeniusNorm( w );
+            if( !limits::IsFinite(delta) )
+                RuntimeError("Arnoldi step produced a non-finite number");
+
+            // Apply the existing rotations to the new column of H
+            for( Int i=0; i<j; ++i )
+            {
+                const Real c = cs(i);
+                const Field s = sn(i);
+                const Field eta_i_j = H(i,j);
+                const Field eta_ip1_j = H(i+1,j);
+                H(i,  j) =  c       *eta_i_j + s*eta_ip1_j;
+                H(i+1,j) = -Conj(s)*eta_i_j + c*eta_ip1_j;
+            }
+
+            // Generate and apply a new rotation to both H and t
+            Real c;
+            Field s;
+            H(j,j) = Givens( H(j,j), Field(delta), c, s );
+            cs(j) = c;
+            sn(j) = s;
+            const Field tau_j = t(j);
+            t(j)   =  c       *tau_j;
+            t(j+1) = -Conj(s)*tau_j;
+
+            ++its;
+            k = j+1;
+            if( delta == Real(0) || Abs(t(j+1)) <= relTol*origNorm )
+                break;
+
+            // v_{j+1} := w / delta
+            V[j+1] = w;
+            Scale( Field(1/delta), V[j+1] );
+        }
+
+        // d := d + V_k inv(H_k) t_k
+        auto y = t( IR(0,k), ALL );
+        Trsm
+        ( LEFT, UPPER, NORMAL, NON_UNIT,
+          Field(1), H( IR(0,k), IR(0,k) ), y );
+        for( Int i=0; i<k; ++i )
+            Axpy( y(i), V[i], d );
+
+        // w := inv(M) (r - A d)
+        w = r;
+        applyA( Field(-1), d, Field(1), w );
+        applyMInv( w );
+    }
+    return its;
+}
+
+// Overwrite B with inv(A) B. If 'factored' is false, the low-precision
+// factorization failed and 'fallback', which should overwrite its argument
+// with its product with inv(A) using a working-precision factorization, is
+// used immediately.
+template<typename Field,class MatType,
+         class ApplyAType,class ApplyMInvType,class FallbackType>
+MixedPrecisionInfo<Base<Field>> Refine
+( const ApplyAType& applyA,
+  const ApplyMInvType& applyMInv,
+  const FallbackType& fallback,
+        bool factored,
+        Base<Field> normA,
+        MatType& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = B.Height();
+    const Int width = B.Width();
+    const Real eps = limits::Epsilon<Real>();
+    const Real relTol =
+      ( ctrl.relTol > Real(0) ? ctrl.relTol : Sqrt(Real(Max(n,Int(1))))*eps );
+
+    MixedPrecisionInfo<Real> info;
+    info.backwardError = limits::Infinity<Real>();
+    MatType X( B ), R( B ), D( B );
+    Matrix<Real> errors;
+    auto residual = [&]()
+    {
+        R = B;
+        applyA( Field(-1), X, Field(1), R );
+        info.backwardError = BackwardError<Field>( normA, B, X, R, errors );
+    };
+
+    if( factored )
+    {
+        // Classical iterative refinement
+        // ==============================
+        applyMInv( X );
+        residual();
+        while( true )
+        {
+            if( ctrl.progress && IsRoot(B) )
+                Output
+                ("refinement step ",info.refineIts,
+                 ": backward error = ",info.backwardError);
+            if( info.backwardError <= relTol )
+            {
+                info.converged = true;
+                break;
+            }
+            if( !limits::IsFinite(info.backwardError) ||
+                info.refineIts >= ctrl.maxRefineIts )
+                break;
+
+            D = R;
+            applyMInv( D );
+            Axpy( Field(1), D, X );
+            ++info.refineIts;
+
+            const Real lastError = info.backwardError;
+            residual();
+            if( info.backwardError > ctrl.stagnationRatio*lastError )
+            {
+                if( info.backwardError <= relTol )
+                {
+                    info.converged = true;
+                    break;
+                }
+                if( !(info.backwardError < lastError) )
+                {
+                    // Roll back the step that increased the error
+                    Axpy( Field(-1), D, X );
+                    residual();
+                }
+                break;
+            }
+        }
+
+        // GMRES-based iterative refinement
+        // ================================
+        if( !info.converged && ctrl.gmres &&
+            limits::IsFinite(info.backwardError) )
+        {
+            while( info.gmresRefineIts < ctrl.maxRefineIts )
+            {
+                Zeros( D, n, width );
+                for( Int j=0; j<width; ++j )
+                {
+                    if( errors(j) <= relTol )
+                        continue;
+                    auto rj = R( ALL, IR(j) );
+                    auto dj = D( ALL, IR(j) );
+                    info.gmresIts +=
+                      GMRES<Field>
+                      ( applyA, applyMInv, rj, dj,
+                        ctrl.gmresRelTol, ctrl.gmresRestart,
+                        ctrl.maxGMRESIts );
+                }
+                Axpy( Field(1), D, X );
+                ++info.gmresRefineIts;
+
+                const Real lastError = info.backwardError;
+                residual();
+                if( ctrl.progress && IsRoot(B) )
+                    Output
+                    ("GMRES-IR step ",info.gmresRefineIts,
+                     ": backward error = ",info.backwardError);
+                if( info.backwardError <= relTol )
+                {
+                    info.converged = true;
+                    break;
+                }
+                if( !(info.backwardError < lastError) )
+                {
+                    Axpy( Field(-1), D, X );
+                    residual();
+                    break;
+                }
+            }
+        }
+    }
+
+    if( !info.converged && ctrl.fullPrecisionFallback )
+    {
+        if( ctrl.progress && IsRoot(B) )
+            Output("Falling back to a ",TypeName<Field>()," factorization");
+        X = B;
+        fallback( X );
+        info.fullPrecisionFallback = true;
+        residual();
+        info.converged = ( info.backwardError <= relTol );
+    }
+
+    B = X;
+    return info;
+}
+
+} // namespace mixed_solve
+
+template<typename Field>
+MixedPrecisionInfo<Base<Field>> LinearSolve
+( const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Demote<Field> FieldLow;
+
+    Matrix<FieldLow> ALow;
+    Permutation P;
+    Copy( A, ALow );
+    LU( ALow, P );
+
+    auto applyA =
+      [&]( Field alpha, const Matrix<Field>& X, Field beta, Matrix<Field>& Y )
+      { Gemm( NORMAL, NORMAL, alpha, A, X, beta, Y ); };
+    Matrix<FieldLow> RLow;
+    auto applyMInv =
+      [&]( Matrix<Field>& R )
+      {
+          Copy( R, RLow );
+          lu::SolveAfter( NORMAL, ALow, P, RLow );
+          Copy( RLow, R );
+      };
+    auto fallback =
+      [&]( Matrix<Field>& X ) { LinearSolve( A, X ); };
+
+    return mixed_solve::Refine<Field>
+      ( applyA, applyMInv, fallback, true, InfinityNorm(A), B, ctrl );
+}
+
+template<typename Field>
+MixedPrecisionInfo<Base<Field>> LinearSolve
+( const AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Field>& BPre,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Demote<Field> FieldLow;
+
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> BProx( BPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.Get();
+    const Grid& grid = A.Grid();
+
+    DistMatrix<FieldLow> ALow(grid);
+    DistPermutation P(grid);
+    Copy( A, ALow );
+    LU( ALow, P );
+
+    auto applyA =
+      [&]( Field alpha, const DistMatrix<Field>& X,
+           Field beta,        DistMatrix<Field>& Y )
+      { Gemm( NORMAL, NORMAL, alpha, A, X, beta, Y ); };
+    DistMatrix<FieldLow> RLow(grid);
+    auto applyMInv =
+      [&]( DistMatrix<Field>& R )
+      {
+          Copy( R, RLow );
+          lu::SolveAfter( NORMAL, ALow, P, RLow );
+          Copy( RLow, R );
+      };
+    auto fallback =
+      [&]( DistMatrix<Field>& X ) { LinearSolve( A, X ); };
+
+    return mixed_solve::Refine<Field>
+      ( applyA, applyMInv, fallback, true, InfinityNorm(A), B, ctrl );
+}
+
+namespace mixed_solve {
+
+// Since A^T = conj(A) when A is Hermitian, A^T X = B is equivalent to
+// A conj(X) = conj(B)
+template<typename Field,class MatType,class SolveType>
+MixedPrecisionInfo<Base<Field>> HPDOrient
+( Orientation orientation, MatType& B, const SolveType& solve )
+{
+    if( orientation == TRANSPOSE )
+        Conjugate( B );
+    auto info = solve( B );
+    if( orientation == TRANSPOSE )
+        Conjugate( B );
+    return info;
+}
+
+} // namespace mixed_solve
+
+template<typename Field>
+MixedPrecisionInfo<Base<Field>> HPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Demote<Field> FieldLow;
+
+    // The low-precision copy of A need not be positive-definite
+    Matrix<FieldLow> ALow;
+    Copy( A, ALow );
+    bool factored = true;
+    try { Cholesky( uplo, ALow ); }
+    catch( std::exception& ) { factored = false; }
+
+    auto applyA =
+      [&]( Field alpha, const Matrix<Field>& X, Field beta, Matrix<Field>& Y )
+      { Hemm( LEFT, uplo, alpha, A, X, beta, Y ); };
+    Matrix<FieldLow> RLow;
+    auto applyMInv =
+      [&]( Matrix<Field>& R )
+      {
+          Copy( R, RLow );
+          cholesky::SolveAfter( uplo, NORMAL, ALow, RLow );
+          Copy( RLow, R );
+      };
+    auto fallback =
+      [&]( Matrix<Field>& X ) { HPDSolve( uplo, NORMAL, A, X ); };
+
+    const Base<Field> normA = HermitianInfinityNorm( uplo, A );
+    return mixed_solve::HPDOrient<Field>
+      ( orientation, B,
+        [&]( Matrix<Field>& BOrient )
+        { return mixed_solve::Refine<Field>
+            ( applyA, applyMInv, fallback, factored, normA, BOrient, ctrl ); }
+      );
+}
+
+template<typename Field>
+MixedPrecisionInfo<Base<Field>> HPDSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  const AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Field>& BPre,
+  const MixedPrecisionCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Demote<Field> FieldLow;
+
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> BProx( BPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.Get();
+    const Grid& grid = A.Grid();
+
+    // The low-precision copy of A need not be positive-definite
+    DistMatrix<FieldLow> ALow(grid);
+    Copy( A, ALow );
+    bool factored = true;
+    try { Cholesky( uplo, ALow ); }
+    catch( std::exception& ) { factored = false; }
+
+    auto applyA =
+      [&]( Field alpha, const DistMatrix<Field>& X,
+           Field beta,        DistMatrix<Field>& Y )
+      { Hemm( LEFT, uplo, alpha, A, X, beta, Y ); };
+    DistMatrix<FieldLow> RLow(grid);
+    auto applyMInv =
+      [&]( DistMatrix<Field>& R )
+      {
+          Copy( R, RLow );
+          cholesky::SolveAfter( uplo, NORMAL, ALow, RLow );
+          Copy( RLow, R );
+      };
+    auto fallback =
+      [&]( DistMatrix<Field>& X ) { HPDSolve( uplo, NORMAL, A, X ); };
+
+    const Base<Field> normA = HermitianInfinityNorm( uplo, A );
+    return mixed_solve::HPDOrient<Field>
+      ( orientation, B,
+        [&]( DistMatrix<Field>& BOrient )
+        { return mixed_solve::Refine<Field>
+            ( applyA, applyMInv, fallback, factored, normA, BOrient, ctrl ); }
+      );
+}
+
+#define PROTO(Field) \
+  template MixedPrecisionInfo<Base<Field>> LinearSolve \
+  ( const Matrix<Field>& A, \
+          Matrix<Field>& B, \
+    const MixedPrecisionCtrl<Base<Field>>& ctrl ); \
+  template MixedPrecisionInfo<Base<Field>> LinearSolve \
+  ( const AbstractDistMatrix<Field>& A, \
+          AbstractDistMatrix<Field>& B, \
+    const MixedPrecisionCtrl<Base<Field>>& ctrl ); \
+  template MixedPrecisionInfo<Base<Field>> HPDSolve \
+  ( UpperOrLower uplo, \
+    Orientation orientation, \
+    const Matrix<Field>& A, \
+          Matrix<Field>& B, \
+    const MixedPrecisionCtrl<Base<Field>>& ctrl ); \
+  template MixedPrecisionInfo<Base<Field>> HPDSolve \
+  ( UpperOrLower uplo, \
+    Orientation orientation, \
+    const AbstractDistMatrix<Field>& A, \
+          AbstractDistMatrix<Field>& B, \
+    const MixedPrecisionCtrl<Base<Field>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include <El/core/Profiling.hpp>
 
 //#include "./HermitianEig/SDC.hpp"
 
@@ -241,8 +242,7 @@ BlackBox
         SafeScaleTrapezoid( maxNormA, normMin, uplo, A );
     }
 
-    // TODO(poulson): Extend interface to support accepting ctrl.tridiagCtrl
-    herm_tridiag::ExplicitCondensed( uplo, A );
+    herm_tridiag::ExplicitCondensed( uplo, A, ctrl.tridiagCtrl );
 
     auto d = GetRealPartOfDiagonal(A);
     auto dSub = GetDiagonal( A, (uplo==LOWER?-1:1) );
@@ -291,6 +291,7 @@ HermitianEig
   const HermitianEigCtrl<F>& ctrl )
 {
     EL_DEBUG_CSE
+    AUTO_NOSYNC_PROFILE_REGION("HermitianEig");
     if( A.Height() != A.Width() )
         LogicError("Hermitian matrices must be square");
     if( ctrl.useSDC )
@@ -605,7 +606,21 @@ BlackBox
     EL_DEBUG_CSE
     HermitianEigInfo info;
 
-    // TODO(poulson): Extend interface to support ctrl.tridiagCtrl
+    if( ctrl.tridiagCtrl.twoStage )
+    {
+        herm_tridiag::TwoStageReflectors<F> reflectors;
+        herm_tridiag::TwoStage
+        ( uplo, A, reflectors, ctrl.tridiagCtrl.bandwidth );
+
+        auto d = GetRealPartOfDiagonal(A);
+        auto dSub = GetDiagonal( A, (uplo==LOWER?-1:1) );
+        info.tridiagEigInfo =
+          HermitianTridiagEig( d, dSub, w, Q, ctrl.tridiagEigCtrl );
+
+        herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, reflectors, Q );
+        return info;
+    }
+
     Matrix<F> householderScalars;
     HermitianTridiag( uplo, A, householderScalars );
 
@@ -680,6 +695,7 @@ HermitianEig
   const HermitianEigCtrl<F>& ctrl )
 {
     EL_DEBUG_CSE
+    AUTO_NOSYNC_PROFILE_REGION("HermitianEig");
     typedef Base<F> Real;
     const Int n = A.Height();
     auto subset = ctrl.tridiagEigCtrl.subset;
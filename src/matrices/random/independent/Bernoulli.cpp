@@ -10,6 +10,8 @@
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
 
+#include "./CounterBased.hpp"
+
 namespace El {
 
 template<typename T>
@@ -20,6 +22,14 @@ void Bernoulli( Matrix<T>& A, Int m, Int n, double p )
         LogicError
         ("Invalid choice of parameter p for Bernoulli distribution: ",p);
     A.Resize( m, n );
+    if constexpr( counter_based::IsSupported<T>::value )
+    {
+        if( CounterBasedRandom() )
+        {
+            counter_based::Fill( A, counter_based::Binary<T>{p} );
+            return;
+        }
+    }
     const double q = 1-p;
     auto doubleCoin = [=]() -> T
     {
@@ -38,6 +48,14 @@ void Bernoulli( AbstractDistMatrix<T>& A, Int m, Int n, double p )
         LogicError
         ("Invalid choice of parameter p for Bernoulli distribution: ",p);
     A.Resize( m, n );
+    if constexpr( counter_based::IsSupported<T>::value )
+    {
+        if( counter_based::Enabled( A ) )
+        {
+            counter_based::Fill( A, counter_based::Binary<T>{p} );
+            return;
+        }
+    }
     const double q = 1-p;
     auto doubleCoin = [=]() -> T
     {
@@ -0,0 +1,198 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_RANDOM_INDEPENDENT_COUNTERBASED_HPP
+#define EL_RANDOM_INDEPENDENT_COUNTERBASED_HPP
+
+namespace El {
+namespace counter_based {
+
+// The types whose fills are drawn from the counter-based generator
+template<typename T> struct IsSupported : std::false_type {};
+template<> struct IsSupported<Int> : std::true_type {};
+template<> struct IsSupported<float> : std::true_type {};
+template<> struct IsSupported<double> : std::true_type {};
+template<> struct IsSupported<Complex<float>> : std::true_type {};
+template<> struct IsSupported<Complex<double>> : std::true_type {};
+
+template<typename T>
+bool Enabled( const AbstractDistMatrix<T>& A )
+{ return CounterBasedRandom() && A.GetLocalDevice() == Device::CPU; }
+
+const double twoPi = 6.283185307179586476925286766559;
+
+// A uniform sample from the open interval (0,1) with 53 random bits
+inline double Unit( std::uint32_t hi, std::uint32_t lo )
+{
+    const std::uint64_t bits = ((std::uint64_t(hi) << 32) | lo) >> 11;
+    return (double(bits) + 0.5) * (1./9007199254740992.);
+}
+
+// Overwrite A(iLoc,jLoc) with sample(philox(rowMap(iLoc),colMap(jLoc)))
+template<typename T,class RowMap,class ColMap,class Sampler>
+void Fill
+( Matrix<T>& A, std::uint64_t key,
+  RowMap rowMap, ColMap colMap, Sampler sample )
+{
+    EL_DEBUG_CSE
+    const Philox4x32 philox( key );
+    const Int m = A.Height();
+    const Int n = A.Width();
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    EL_PARALLEL_FOR
+    for( Int jLoc=0; jLoc<n; ++jLoc )
+    {
+        const std::uint64_t j = colMap(jLoc);
+        T* ACol = &ABuf[jLoc*ALDim];
+        EL_SIMD
+        for( Int iLoc=0; iLoc<m; ++iLoc )
+            ACol[iLoc] = sample( philox( rowMap(iLoc), j ) );
+    }
+}
+
+// Local matrices are keyed by the rank so that processes draw independently
+template<typename T,class Sampler>
+void Fill( Matrix<T>& A, Sampler sample )
+{
+    auto identity = []( Int k ) { return std::uint64_t(k); };
+    Fill( A, NextCounterBasedKey(false), identity, identity, sample );
+}
+
+// Distributed matrices are indexed globally, so that every process computes
+// its own entries (including the redundant copies) without communication
+template<typename T,class Sampler>
+void Fill( AbstractDistMatrix<T>& A, Sampler sample )
+{
+    EL_DEBUG_CSE
+    const std::uint64_t key = NextCounterBasedKey( true );
+    if( !A.Participating() )
+        return;
+    auto& ALoc = static_cast<Matrix<T>&>( A.Matrix() );
+    if( A.Wrap() == ELEMENT )
+    {
+        const Int colShift = A.ColShift(), colStride = A.ColStride();
+        const Int rowShift = A.RowShift(), rowStride = A.RowStride();
+        Fill
+        ( ALoc, key,
+          [=]( Int iLoc ) { return std::uint64_t(colShift+iLoc*colStride); },
+          [=]( Int jLoc ) { return std::uint64_t(rowShift+jLoc*rowStride); },
+          sample );
+    }
+    else
+    {
+        vector<std::uint64_t> rows(A.LocalHeight()), cols(A.LocalWidth());
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            rows[iLoc] = A.GlobalRow( iLoc );
+        for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+            cols[jLoc] = A.GlobalCol( jLoc );
+        const std::uint64_t* rowBuf = rows.data();
+        const std::uint64_t* colBuf = cols.data();
+        Fill
+        ( ALoc, key,
+          [=]( Int iLoc ) { return rowBuf[iLoc]; },
+          [=]( Int jLoc ) { return colBuf[jLoc]; },
+          sample );
+    }
+}
+
+// Samplers
+// ========
+// Each sampler maps the four words drawn for an entry to a sample
+
+// A uniform sample from the closed ball of the given radius about the center
+template<typename T>
+struct Ball
+{
+    T center;
+    Base<T> radius;
+
+    T operator()( const std::array<std::uint32_t,4>& w ) const
+    {
+        const double u = Unit( w[0], w[1] );
+        if constexpr( IsIntegral<T>::value )
+        {
+            // Match SampleUniform over [center-radius,center+radius)
+            if( radius <= 0 )
+                return center;
+            return center - radius + Min( Int(u*(2*radius)), 2*radius-1 );
+        }
+        else if constexpr( IsComplex<T>::value )
+        {
+            typedef Base<T> Real;
+            const double r = double(radius)*u;
+            const double theta = twoPi*Unit( w[2], w[3] );
+            return center +
+              T(Real(r*std::cos(theta)),Real(r*std::sin(theta)));
+        }
+        else
+        {
+            return center + T(double(radius)*(2*u-1));
+        }
+    }
+};
+
+// A normal sample via the Box-Muller transform; as in SampleNormal, the
+// components of complex samples each have deviation stddev/sqrt(2)
+template<typename F>
+struct Normal
+{
+    F mean;
+    Base<F> stddev;
+
+    F operator()( const std::array<std::uint32_t,4>& w ) const
+    {
+        const double r = std::sqrt(-2*std::log(Unit( w[0], w[1] )));
+        const double theta = twoPi*Unit( w[2], w[3] );
+        if constexpr( IsComplex<F>::value )
+        {
+            typedef Base<F> Real;
+            const double s = double(stddev)/std::sqrt(2.);
+            return mean +
+              F(Real(s*r*std::cos(theta)),Real(s*r*std::sin(theta)));
+        }
+        else
+        {
+            return mean + F(double(stddev)*r*std::cos(theta));
+        }
+    }
+};
+
+// -1 with probability p/2, 1 with probability p/2, and 0 otherwise
+template<typename T>
+struct Trinary
+{
+    double p;
+
+    T operator()( const std::array<std::uint32_t,4>& w ) const
+    {
+        const double alpha = Unit( w[0], w[1] );
+        if( alpha <= p/2 ) return T(-1);
+        else if( alpha <= p ) return T(1);
+        else return T(0);
+    }
+};
+
+// 1 with probability p and 0 otherwise
+template<typename T>
+struct Binary
+{
+    double p;
+
+    T operator()( const std::array<std::uint32_t,4>& w ) const
+    {
+        const double alpha = Unit( w[0], w[1] );
+        if( alpha <= 1-p ) return T(0);
+        else return T(1);
+    }
+};
+
+} // namespace counter_based
+} // namespace El
+
+#endif // ifndef EL_RANDOM_INDEPENDENT_COUNTERBASED_HPP
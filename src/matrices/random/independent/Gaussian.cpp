@@ -10,6 +10,8 @@
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
 
+#include "./CounterBased.hpp"
+
 namespace El {
 
 
@@ -18,6 +20,14 @@ template<typename F,Device D,typename>
 void MakeGaussian( Matrix<F,D>& A, F mean, Base<F> stddev )
 {
     EL_DEBUG_CSE
+    if constexpr( D == Device::CPU && counter_based::IsSupported<F>::value )
+    {
+        if( CounterBasedRandom() )
+        {
+            counter_based::Fill( A, counter_based::Normal<F>{mean,stddev} );
+            return;
+        }
+    }
     auto sampleNormal = [=]() { return SampleNormal(mean,stddev); };
     EntrywiseFill( A, function<F()>(sampleNormal) );
 }
@@ -51,6 +61,14 @@ template<typename F>
 void MakeGaussian( AbstractDistMatrix<F>& A, F mean, Base<F> stddev )
 {
     EL_DEBUG_CSE
+    if constexpr( counter_based::IsSupported<F>::value )
+    {
+        if( counter_based::Enabled( A ) )
+        {
+            counter_based::Fill( A, counter_based::Normal<F>{mean,stddev} );
+            return;
+        }
+    }
     if( A.RedundantRank() == 0 )
         MakeGaussian( A.Matrix(), mean, stddev );
     Broadcast( A, A.RedundantComm(), 0 );
@@ -10,6 +10,8 @@
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
 
+#include "./CounterBased.hpp"
+
 namespace El {
 
 template <typename T>
@@ -29,6 +31,14 @@ void ThreeValued( Matrix<T>& A, Int m, Int n, double p )
 {
     EL_DEBUG_CSE
     A.Resize( m, n );
+    if constexpr( counter_based::IsSupported<T>::value )
+    {
+        if( CounterBasedRandom() )
+        {
+            counter_based::Fill( A, counter_based::Trinary<T>{p} );
+            return;
+        }
+    }
     auto tripleCoin = [=]() -> T
     {
         const double alpha = SampleUniform<double>(0,1);
@@ -44,6 +54,14 @@ void ThreeValued( AbstractDistMatrix<T>& A, Int m, Int n, double p )
 {
     EL_DEBUG_CSE
     A.Resize( m, n );
+    if constexpr( counter_based::IsSupported<T>::value )
+    {
+        if( counter_based::Enabled( A ) )
+        {
+            counter_based::Fill( A, counter_based::Trinary<T>{p} );
+            return;
+        }
+    }
     if( A.RedundantRank() == 0 )
         ThreeValued( A.Matrix(), A.LocalHeight(), A.LocalWidth(), p );
     Broadcast( A, A.RedundantComm(), 0 );
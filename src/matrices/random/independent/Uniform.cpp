@@ -10,6 +10,8 @@
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
 
+#include "./CounterBased.hpp"
+
 namespace El {
 
 // Draw each entry from a uniform PDF over a closed ball.
@@ -37,6 +39,14 @@ template<typename T, Device D>
 void MakeUniform( Matrix<T,D>& A, T center, Base<T> radius )
 {
     EL_DEBUG_CSE
+    if constexpr( D == Device::CPU && counter_based::IsSupported<T>::value )
+    {
+        if( CounterBasedRandom() )
+        {
+            counter_based::Fill( A, counter_based::Ball<T>{center,radius} );
+            return;
+        }
+    }
     auto sampleBall = [=]() { return SampleBall(center,radius); };
     EntrywiseFill( A, function<T()>(sampleBall) );
 }
@@ -53,6 +63,14 @@ template<typename T>
 void MakeUniform( AbstractDistMatrix<T>& A, T center, Base<T> radius )
 {
     EL_DEBUG_CSE
+    if constexpr( counter_based::IsSupported<T>::value )
+    {
+        if( counter_based::Enabled( A ) )
+        {
+            counter_based::Fill( A, counter_based::Ball<T>{center,radius} );
+            return;
+        }
+    }
     if( A.RedundantRank() == 0 )
         MakeUniform( A.Matrix(), center, radius );
     Broadcast( A, A.RedundantComm(), 0 );
@@ -0,0 +1,418 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+/*
+  Testing the strided, pointer-array, Matrix-vector and interleaved variants
+  of the batched Gemm, Herk, Trsm and Cholesky against the same operation
+  applied to each batch member in turn.
+*/
+#include <El.hpp>
+using namespace El;
+
+// A strided batch of 'batchCount' members whose entries all live in a single
+// column vector; member b begins at entry b*stride
+template<typename T>
+struct StridedBatch
+{
+    Int height, width, ldim, stride, batchCount;
+    Matrix<T> data;
+
+    StridedBatch( Int h, Int w, Int count )
+    : height(h), width(w), ldim(Max(h,Int(1))), stride(ldim*w),
+      batchCount(count)
+    { Uniform( data, stride*count, 1 ); }
+
+    T* Buffer( Int b ) { return data.Buffer() + b*stride; }
+    const T* LockedBuffer( Int b ) const
+    { return data.LockedBuffer() + b*stride; }
+
+    Matrix<T> Member( Int b )
+    {
+        Matrix<T> view;
+        view.Attach( height, width, Buffer(b), ldim );
+        return view;
+    }
+
+    vector<T*> Pointers()
+    {
+        vector<T*> pointers( batchCount );
+        for( Int b=0; b<batchCount; ++b )
+            pointers[b] = Buffer(b);
+        return pointers;
+    }
+
+    vector<const T*> LockedPointers() const
+    {
+        vector<const T*> pointers( batchCount );
+        for( Int b=0; b<batchCount; ++b )
+            pointers[b] = LockedBuffer(b);
+        return pointers;
+    }
+
+    // Member b's entry e moves to position e*batchCount+b
+    Matrix<T> Interleaved() const
+    {
+        Matrix<T> interleaved( stride*batchCount, 1 );
+        for( Int b=0; b<batchCount; ++b )
+            for( Int e=0; e<stride; ++e )
+                interleaved(e*batchCount+b) = data(b*stride+e);
+        return interleaved;
+    }
+
+    void Deinterleave( const Matrix<T>& interleaved )
+    {
+        for( Int b=0; b<batchCount; ++b )
+            for( Int e=0; e<stride; ++e )
+                data(b*stride+e) = interleaved(e*batchCount+b);
+    }
+};
+
+template<typename T>
+void CheckAgainst
+( const Matrix<T>& truth, const Matrix<T>& computed, const string& variant )
+{
+    typedef Base<T> Real;
+    const Real eps = limits::Epsilon<Real>();
+    Matrix<T> E( computed );
+    Axpy( T(-1), truth, E );
+    const Real relErr = MaxNorm( E ) / Max( MaxNorm(truth), Real(1) );
+    if( relErr > Real(100)*eps )
+        LogicError(variant," had a relative error of ",relErr);
+}
+
+template<typename T>
+void MakeHPD( StridedBatch<T>& batch )
+{
+    const Int n = batch.height;
+    for( Int b=0; b<batch.batchCount; ++b )
+    {
+        auto A = batch.Member( b );
+        Matrix<T> X( A );
+        Herk( LOWER, NORMAL, Base<T>(1), X, Base<T>(0), A );
+        MakeHermitian( LOWER, A );
+        ShiftDiagonal( A, T(n) );
+    }
+}
+
+template<typename T>
+void TestGemm( Orientation orientA, Orientation orientB, Int batchCount )
+{
+    const Int m = 5, n = 4, k = 3;
+    const T alpha = T(2), beta = T(-1);
+    StridedBatch<T>
+      A( orientA==NORMAL ? m : k, orientA==NORMAL ? k : m, batchCount ),
+      B( orientB==NORMAL ? k : n, orientB==NORMAL ? n : k, batchCount ),
+      C( m, n, batchCount );
+
+    auto truth = C;
+    for( Int b=0; b<batchCount; ++b )
+    {
+        auto CMember = truth.Member( b );
+        Gemm
+        ( orientA, orientB,
+          alpha, A.Member(b), B.Member(b), beta, CMember );
+    }
+
+    auto strided = C;
+    GemmStridedBatched
+    ( orientA, orientB, m, n, k,
+      alpha, A.data.LockedBuffer(), A.ldim, A.stride,
+             B.data.LockedBuffer(), B.ldim, B.stride,
+      beta,  strided.data.Buffer(), strided.ldim, strided.stride,
+      batchCount );
+    CheckAgainst( truth.data, strided.data, "GemmStridedBatched" );
+
+    auto pointers = C;
+    GemmBatched
+    ( orientA, orientB, m, n, k,
+      alpha, A.LockedPointers().data(), A.ldim,
+             B.LockedPointers().data(), B.ldim,
+      beta,  pointers.Pointers().data(), pointers.ldim,
+      batchCount );
+    CheckAgainst( truth.data, pointers.data, "GemmBatched" );
+
+    Matrix<T> CInter = C.Interleaved();
+    GemmInterleavedBatched
+    ( orientA, orientB, m, n, k,
+      alpha, A.Interleaved().LockedBuffer(), A.ldim,
+             B.Interleaved().LockedBuffer(), B.ldim,
+      beta,  CInter.Buffer(), C.ldim,
+      batchCount );
+    auto interleaved = C;
+    interleaved.Deinterleave( CInter );
+    CheckAgainst( truth.data, interleaved.data, "GemmInterleavedBatched" );
+
+    // Members of varying sizes
+    vector<Matrix<T>> AVar(batchCount), BVar(batchCount), CVar(batchCount);
+    for( Int b=0; b<batchCount; ++b )
+    {
+        const Int mb = 1 + b % 7, nb = 1 + b % 5, kb = 1 + b % 3;
+        if( orientA == NORMAL )
+            Uniform( AVar[b], mb, kb );
+        else
+            Uniform( AVar[b], kb, mb );
+        if( orientB == NORMAL )
+            Uniform( BVar[b], kb, nb );
+        else
+            Uniform( BVar[b], nb, kb );
+        Uniform( CVar[b], mb, nb );
+    }
+    auto CVarTruth = CVar;
+    for( Int b=0; b<batchCount; ++b )
+        Gemm( orientA, orientB, alpha, AVar[b], BVar[b], beta, CVarTruth[b] );
+    GemmBatched( orientA, orientB, alpha, AVar, BVar, beta, CVar );
+    for( Int b=0; b<batchCount; ++b )
+        CheckAgainst( CVarTruth[b], CVar[b], "GemmBatched (variable)" );
+}
+
+template<typename T>
+void TestHerk( UpperOrLower uplo, Orientation orientation, Int batchCount )
+{
+    typedef Base<T> Real;
+    const Int n = 6, k = 4;
+    const Real alpha = Real(3), beta = Real(2);
+    StridedBatch<T>
+      A( orientation==NORMAL ? n : k, orientation==NORMAL ? k : n,
+         batchCount ),
+      C( n, n, batchCount );
+    for( Int b=0; b<batchCount; ++b )
+    {
+        auto CMember = C.Member( b );
+        MakeDiagonalReal( CMember );
+    }
+
+    auto truth = C;
+    for( Int b=0; b<batchCount; ++b )
+    {
+        auto CMember = truth.Member( b );
+        Herk( uplo, orientation, alpha, A.Member(b), beta, CMember );
+    }
+
+    auto strided = C;
+    HerkStridedBatched
+    ( uplo, orientation, n, k,
+      alpha, A.data.LockedBuffer(), A.ldim, A.stride,
+      beta,  strided.data.Buffer(), strided.ldim, strided.stride,
+      batchCount );
+    CheckAgainst( truth.data, strided.data, "HerkStridedBatched" );
+
+    auto pointers = C;
+    HerkBatched
+    ( uplo, orientation, n, k,
+      alpha, A.LockedPointers().data(), A.ldim,
+      beta,  pointers.Pointers().data(), pointers.ldim,
+      batchCount );
+    CheckAgainst( truth.data, pointers.data, "HerkBatched" );
+
+    Matrix<T> CInter = C.Interleaved();
+    HerkInterleavedBatched
+    ( uplo, orientation, n, k,
+      alpha, A.Interleaved().LockedBuffer(), A.ldim,
+      beta,  CInter.Buffer(), C.ldim,
+      batchCount );
+    auto interleaved = C;
+    interleaved.Deinterleave( CInter );
+    CheckAgainst( truth.data, interleaved.data, "HerkInterleavedBatched" );
+
+    vector<Matrix<T>> AVec(batchCount), CVec(batchCount);
+    for( Int b=0; b<batchCount; ++b )
+    {
+        Copy( A.Member(b), AVec[b] );
+        Copy( C.Member(b), CVec[b] );
+    }
+    HerkBatched( uplo, orientation, alpha, AVec, beta, CVec );
+    for( Int b=0; b<batchCount; ++b )
+        CheckAgainst( truth.Member(b), CVec[b], "HerkBatched (Matrix)" );
+}
+
+template<typename T>
+void TestTrsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag, Int batchCount )
+{
+    const Int m = 5, n = 3;
+    const Int order = ( side == LEFT ? m : n );
+    const T alpha = T(2);
+    StridedBatch<T> A( order, order, batchCount ), B( m, n, batchCount );
+    for( Int b=0; b<batchCount; ++b )
+    {
+        auto AMember = A.Member( b );
+        ShiftDiagonal( AMember, T(order) );
+    }
+
+    auto truth = B;
+    for( Int b=0; b<batchCount; ++b )
+    {
+        auto BMember = truth.Member( b );
+        Trsm( side, uplo, orientation, diag, alpha, A.Member(b), BMember );
+    }
+
+    auto strided = B;
+    TrsmStridedBatched
+    ( side, uplo, orientation, diag, m, n,
+      alpha, A.data.LockedBuffer(), A.ldim, A.stride,
+             strided.data.Buffer(), strided.ldim, strided.stride,
+      batchCount );
+    CheckAgainst( truth.data, strided.data, "TrsmStridedBatched" );
+
+    auto pointers = B;
+    TrsmBatched
+    ( side, uplo, orientation, diag, m, n,
+      alpha, A.LockedPointers().data(), A.ldim,
+             pointers.Pointers().data(), pointers.ldim,
+      batchCount );
+    CheckAgainst( truth.data, pointers.data, "TrsmBatched" );
+
+    Matrix<T> BInter = B.Interleaved();
+    TrsmInterleavedBatched
+    ( side, uplo, orientation, diag, m, n,
+      alpha, A.Interleaved().LockedBuffer(), A.ldim,
+             BInter.Buffer(), B.ldim,
+      batchCount );
+    auto interleaved = B;
+    interleaved.Deinterleave( BInter );
+    CheckAgainst( truth.data, interleaved.data, "TrsmInterleavedBatched" );
+
+    vector<Matrix<T>> AVec(batchCount), BVec(batchCount);
+    for( Int b=0; b<batchCount; ++b )
+    {
+        Copy( A.Member(b), AVec[b] );
+        Copy( B.Member(b), BVec[b] );
+    }
+    TrsmBatched( side, uplo, orientation, diag, alpha, AVec, BVec );
+    for( Int b=0; b<batchCount; ++b )
+        CheckAgainst( truth.Member(b), BVec[b], "TrsmBatched (Matrix)" );
+}
+
+template<typename T>
+void TestCholesky( UpperOrLower uplo, Int batchCount )
+{
+    const Int n = 8;
+    StridedBatch<T> A( n, n, batchCount );
+    MakeHPD( A );
+
+    auto truth = A;
+    for( Int b=0; b<batchCount; ++b )
+    {
+        auto AMember = truth.Member( b );
+        Cholesky( uplo, AMember );
+    }
+
+    auto strided = A;
+    CholeskyStridedBatched
+    ( uplo, n, strided.data.Buffer(), strided.ldim, strided.stride,
+      batchCount );
+    CheckAgainst( truth.data, strided.data, "CholeskyStridedBatched" );
+
+    auto pointers = A;
+    CholeskyBatched
+    ( uplo, n, pointers.Pointers().data(), pointers.ldim, batchCount );
+    CheckAgainst( truth.data, pointers.data, "CholeskyBatched" );
+
+    Matrix<T> AInter = A.Interleaved();
+    CholeskyInterleavedBatched
+    ( uplo, n, AInter.Buffer(), A.ldim, batchCount );
+    auto interleaved = A;
+    interleaved.Deinterleave( AInter );
+    CheckAgainst( truth.data, interleaved.data, "CholeskyInterleavedBatched" );
+
+    vector<Matrix<T>> AVec(batchCount);
+    for( Int b=0; b<batchCount; ++b )
+        Copy( A.Member(b), AVec[b] );
+    CholeskyBatched( uplo, AVec );
+    for( Int b=0; b<batchCount; ++b )
+        CheckAgainst( truth.Member(b), AVec[b], "CholeskyBatched (Matrix)" );
+
+    // Every variant should single out a member that is not HPD
+    const Int badMember = batchCount / 2;
+    auto badBatch = A;
+    auto badView = badBatch.Member( badMember );
+    badView(n-1,n-1) = T(-1);
+    Matrix<T> badInter = badBatch.Interleaved();
+    bool caught = false;
+    try
+    {
+        CholeskyInterleavedBatched
+        ( uplo, n, badInter.Buffer(), A.ldim, batchCount );
+    }
+    catch( NonHPDMatrixException& ) { caught = true; }
+    if( !caught )
+        LogicError("Interleaved batch with a non-HPD member was accepted");
+    caught = false;
+    try
+    {
+        CholeskyStridedBatched
+        ( uplo, n, badBatch.data.Buffer(), A.ldim, A.stride, batchCount );
+    }
+    catch( NonHPDMatrixException& ) { caught = true; }
+    if( !caught )
+        LogicError("Strided batch with a non-HPD member was accepted");
+}
+
+template<typename T>
+void TestBatched( Int batchCount )
+{
+    OutputFromRoot
+    (mpi::COMM_WORLD,"Testing batches of ",batchCount," with ",TypeName<T>());
+    PushIndent();
+    const vector<Orientation> orients = { NORMAL, TRANSPOSE, ADJOINT };
+    for( const auto orientA : orients )
+        for( const auto orientB : orients )
+            TestGemm<T>( orientA, orientB, batchCount );
+    OutputFromRoot(mpi::COMM_WORLD,"Gemm passed");
+
+    for( const auto uplo : { LOWER, UPPER } )
+    {
+        TestHerk<T>( uplo, NORMAL, batchCount );
+        TestHerk<T>( uplo, ADJOINT, batchCount );
+    }
+    OutputFromRoot(mpi::COMM_WORLD,"Herk passed");
+
+    for( const auto side : { LEFT, RIGHT } )
+        for( const auto uplo : { LOWER, UPPER } )
+            for( const auto orientation : orients )
+                for( const auto diag : { NON_UNIT, UNIT } )
+                    TestTrsm<T>( side, uplo, orientation, diag, batchCount );
+    OutputFromRoot(mpi::COMM_WORLD,"Trsm passed");
+
+    for( const auto uplo : { LOWER, UPPER } )
+        TestCholesky<T>( uplo, batchCount );
+    OutputFromRoot(mpi::COMM_WORLD,"Cholesky passed");
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        // More than one interleaved chunk, the last of which is partial
+        const Int batchCount =
+          Input("--batchCount","number of matrices in each batch",300);
+        ProcessInput();
+        PrintInputReport();
+
+        TestBatched<float>( batchCount );
+        TestBatched<double>( batchCount );
+        TestBatched<Complex<float>>( batchCount );
+        TestBatched<Complex<double>>( batchCount );
+
+        if( mpi::Rank() == 0 )
+            Output("Passed");
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return EXIT_FAILURE;
+    }
+
+    return 0;
+}
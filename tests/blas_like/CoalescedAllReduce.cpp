@@ -0,0 +1,154 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+/*
+  Testing the bucketed AllReduce of a list of matrices (including views,
+  empty matrices and matrices which straddle several buckets) against one
+  AllReduce per matrix.
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void CheckReduced
+( const vector<Matrix<T>>& A, const vector<Matrix<T>>& ARef,
+  const string& msg )
+{
+    for( size_t k=0; k<A.size(); ++k )
+    {
+        Matrix<T> E( ARef[k] );
+        Axpy( T(-1), A[k], E );
+        const Base<T> relError =
+          MaxNorm(E) / Max(MaxNorm(ARef[k]),Base<T>(1));
+        if( relError > 10*limits::Epsilon<Base<T>>() )
+            LogicError(msg,": matrix ",k," had a relative error of ",relError);
+    }
+}
+
+template<typename T>
+void TestSequential( mpi::Comm const& comm, Int bucketBytes, mpi::Op op )
+{
+    // A mix of sizes, including a matrix larger than a bucket
+    const vector<std::pair<Int,Int>> sizes =
+      { {7,3}, {0,5}, {40,30}, {1,1}, {16,16}, {3,0}, {100,9} };
+    vector<Matrix<T>> A(sizes.size()), ARef(sizes.size());
+    for( size_t k=0; k<sizes.size(); ++k )
+    {
+        Uniform( A[k], sizes[k].first, sizes[k].second );
+        ARef[k] = A[k];
+        AllReduce( ARef[k], comm, op );
+    }
+
+    // Non-contiguous views into a larger matrix, whose other entries must
+    // be left alone
+    Matrix<T> B, BRef;
+    Uniform( B, 20, 12 );
+    BRef = B;
+    auto BSub = B( IR(2,17), IR(1,11) );
+    auto BRefSub = BRef( IR(2,17), IR(1,11) );
+    AllReduce( BRefSub, comm, op );
+
+    vector<AbstractMatrix<T>*> matrices;
+    for( auto& ASingle : A )
+        matrices.push_back( &ASingle );
+    matrices.push_back( &BSub );
+
+    CoalescedAllReduce<T> reduce( bucketBytes );
+    reduce.Execute( matrices, comm, op );
+    CheckReduced( A, ARef, "CoalescedAllReduce" );
+    CheckReduced<T>( {B}, {BRef}, "CoalescedAllReduce of a view" );
+
+    // Reuse the buffer for a shorter list
+    matrices.resize( 3 );
+    for( Int k=0; k<3; ++k )
+    {
+        Uniform( A[k], sizes[k].first, sizes[k].second );
+        ARef[k] = A[k];
+        AllReduce( ARef[k], comm, op );
+    }
+    reduce.Execute( matrices, comm, op );
+    A.resize( 3 );
+    ARef.resize( 3 );
+    CheckReduced( A, ARef, "Reused CoalescedAllReduce" );
+}
+
+template<typename T>
+void TestDistributed( const Grid& g, Int bucketBytes )
+{
+    DistMatrix<T,STAR,STAR> A(g), B(g), ARef(g), BRef(g);
+    // Processes in the same row of the grid own the same rows of C
+    DistMatrix<T,MC,STAR> C(g), CRef(g);
+    Uniform( A, 30, 20 );
+    Uniform( B, 5, 50 );
+    Uniform( C, 25, 25 );
+    ARef = A;
+    BRef = B;
+    CRef = C;
+    AllReduce( ARef, g.Comm() );
+    AllReduce( BRef, g.Comm() );
+    AllReduce( CRef, g.RowComm() );
+
+    AllReduce( vector<AbstractDistMatrix<T>*>{ &A, &B }, g.Comm() );
+    CheckReduced<T>
+    ( {A.Matrix(),B.Matrix()}, {ARef.Matrix(),BRef.Matrix()},
+      "Distributed AllReduce" );
+
+    CoalescedAllReduce<T> reduce( bucketBytes );
+    reduce.Execute( vector<AbstractDistMatrix<T>*>{ &C }, g.RowComm() );
+    CheckReduced<T>( {C.Matrix()}, {CRef.Matrix()}, "Row AllReduce" );
+}
+
+template<typename T>
+void TestCoalescedAllReduce( const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    PushIndent();
+    // Buckets smaller than several of the matrices, a bucket which holds
+    // every entry, and buckets of a single entry
+    for( const Int bucketBytes :
+         { Int(64*sizeof(T)), Int(1)<<22, Int(sizeof(T)) } )
+    {
+        TestSequential<T>( g.Comm(), bucketBytes, mpi::SUM );
+        TestDistributed<T>( g, bucketBytes );
+        OutputFromRoot(g.Comm(),"bucket size ",bucketBytes," bytes passed");
+    }
+    if( !IsComplex<T>::value )
+    {
+        TestSequential<T>( g.Comm(), 64*sizeof(T), mpi::MAX );
+        OutputFromRoot(g.Comm(),"maximum passed");
+    }
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( mpi::NewWorldComm() );
+        TestCoalescedAllReduce<float>( g );
+        TestCoalescedAllReduce<double>( g );
+        TestCoalescedAllReduce<Complex<double>>( g );
+
+        if( mpi::Rank() == 0 )
+            Output("Passed");
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return EXIT_FAILURE;
+    }
+
+    return 0;
+}
@@ -0,0 +1,218 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+/*
+  Testing the functor overloads of EntrywiseMap and the fused entrywise
+  expressions against the equivalent sequence of Scale, Hadamard, Axpy and
+  (std::function-based) EntrywiseMap calls, for both sequential and
+  conformally distributed matrices.
+*/
+#include <El.hpp>
+using namespace El;
+using expr::Ref;
+
+template<typename T>
+struct Activation
+{
+    T operator()( const T& alpha ) const { return alpha*alpha + T(1); }
+};
+
+template<typename T>
+void CheckEqual
+( const Matrix<T>& A, const Matrix<T>& B, const string& msg )
+{
+    Matrix<T> E( A );
+    Axpy( T(-1), B, E );
+    const Base<T> relError =
+      FrobeniusNorm(E) / Max(FrobeniusNorm(A),Base<T>(1));
+    if( relError > 10*limits::Epsilon<Base<T>>() )
+        LogicError(msg," had a relative error of ",relError);
+}
+
+template<typename T>
+void CheckEqual
+( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B,
+  const string& msg )
+{
+    DistMatrix<T> E( A.Grid() );
+    Copy( A, E );
+    Axpy( T(-1), B, E );
+    const Base<T> relError =
+      FrobeniusNorm(E) / Max(FrobeniusNorm(A),Base<T>(1));
+    if( relError > 10*limits::Epsilon<Base<T>>() )
+        LogicError(msg," had a relative error of ",relError);
+}
+
+// The unfused evaluation of Activation( alpha X + Y o Z )
+template<typename T,typename MatrixType>
+void Unfused
+( T alpha,
+  const MatrixType& X, const MatrixType& Y, const MatrixType& Z,
+  MatrixType& W )
+{
+    MatrixType YZ( Y );
+    Hadamard( Y, Z, YZ );
+    W = X;
+    Scale( alpha, W );
+    Axpy( T(1), YZ, W );
+    EntrywiseMap( W, MakeFunction(Activation<T>()) );
+}
+
+template<typename T>
+void TestSequential( Int m, Int n )
+{
+    Output("Testing Matrix with ",TypeName<T>());
+    PushIndent();
+    Matrix<T> X, Y, Z, W, WFused;
+    Uniform( X, m, n );
+    Uniform( Y, m, n );
+    Uniform( Z, m, n );
+    const T alpha = T(3);
+
+    // The functor overloads of EntrywiseMap
+    Matrix<T> A( X ), B;
+    EntrywiseMap( A, Activation<T>() );
+    EntrywiseMap( X, B, [](const T& beta) { return beta*beta + T(1); } );
+    W = X;
+    EntrywiseMap( W, MakeFunction(Activation<T>()) );
+    CheckEqual( W, A, "In-place functor EntrywiseMap" );
+    CheckEqual( W, B, "Out-of-place functor EntrywiseMap" );
+    Output("functor EntrywiseMap passed");
+
+    // A strided view must only have its own entries updated
+    Matrix<T> C( X ), CFused( X );
+    auto CSub = C( IR(1,m-1), IR(1,n) );
+    auto CFusedSub = CFused( IR(1,m-1), IR(1,n) );
+    EntrywiseMap( CSub, MakeFunction(Activation<T>()) );
+    EntrywiseMap( CFusedSub, Activation<T>() );
+    CheckEqual( C, CFused, "Functor EntrywiseMap of a view" );
+
+    Unfused( alpha, X, Y, Z, W );
+    Evaluate
+    ( Map( alpha*Ref(X) + Hadamard(Ref(Y),Ref(Z)), Activation<T>() ),
+      WFused );
+    CheckEqual( W, WFused, "Fused expression" );
+
+    // Overwrite an operand
+    W = X;
+    Axpy( T(-1), Y, W );
+    Scale( T(2), W );
+    WFused = X;
+    Evaluate( (Ref(WFused) - Ref(Y))*T(2), WFused );
+    CheckEqual( W, WFused, "In-place fused expression" );
+
+    // Operands of different datatypes
+    Matrix<Base<T>> s;
+    Uniform( s, m, n );
+    Matrix<T> sComplex;
+    Copy( s, sComplex );
+    Hadamard( sComplex, X, W );
+    Evaluate
+    ( Map( Ref(s), Ref(X), []( const Base<T>& a, const T& b ) { return a*b; } ),
+      WFused );
+    CheckEqual( W, WFused, "Mixed-datatype expression" );
+
+    bool threw = false;
+    Matrix<T> XShort;
+    Uniform( XShort, m-1, n );
+    try { Evaluate( Ref(X) + Ref(XShort), W ); }
+    catch( std::exception& ) { threw = true; }
+    if( !threw )
+        LogicError("Nonconformal expression was not detected");
+    Output("fused expressions passed");
+    PopIndent();
+}
+
+template<typename T>
+void TestDistributed( const Grid& g, Int m, Int n )
+{
+    OutputFromRoot(g.Comm(),"Testing DistMatrix with ",TypeName<T>());
+    PushIndent();
+    DistMatrix<T> X(g), Y(g), Z(g), W(g), WFused(g);
+    Uniform( X, m, n );
+    Uniform( Y, m, n );
+    Uniform( Z, m, n );
+    const T alpha = T(-2);
+
+    DistMatrix<T> A( X );
+    EntrywiseMap( A, Activation<T>() );
+    W = X;
+    EntrywiseMap( W, MakeFunction(Activation<T>()) );
+    CheckEqual( W, A, "Distributed functor EntrywiseMap" );
+
+    Unfused( alpha, X, Y, Z, W );
+    Evaluate
+    ( Map( alpha*Ref(X) + Hadamard(Ref(Y),Ref(Z)), Activation<T>() ),
+      WFused );
+    CheckEqual( W, WFused, "Distributed fused expression" );
+
+    // The result takes on the alignment of the operands
+    DistMatrix<T> XAligned(g), WAligned(g);
+    XAligned.Align( Min(1,g.Height()-1), Min(1,g.Width()-1) );
+    XAligned = X;
+    W = X;
+    Scale( alpha, W );
+    Evaluate( -(alpha*Ref(XAligned)), WAligned );
+    Scale( T(-1), WAligned );
+    CheckEqual( W, WAligned, "Aligned fused expression" );
+
+    if( g.Size() > 1 )
+    {
+        bool threw = false;
+        try { Evaluate( Ref(X) + Ref(XAligned), W ); }
+        catch( std::exception& ) { threw = true; }
+        if( !threw )
+            LogicError("Differently aligned operands were not detected");
+
+        threw = false;
+        DistMatrix<T,VC,STAR> WVC(g);
+        try { Evaluate( Ref(X) + Ref(Y), WVC ); }
+        catch( std::exception& ) { threw = true; }
+        if( !threw )
+            LogicError("A differently distributed result was not detected");
+    }
+    OutputFromRoot(g.Comm(),"distributed fused expressions passed");
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","height of matrices",100);
+        const Int n = Input("--n","width of matrices",80);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank() == 0 )
+        {
+            TestSequential<float>( m, n );
+            TestSequential<double>( m, n );
+            TestSequential<Complex<double>>( m, n );
+        }
+
+        const Grid g( mpi::NewWorldComm() );
+        TestDistributed<float>( g, m, n );
+        TestDistributed<double>( g, m, n );
+        TestDistributed<Complex<double>>( g, m, n );
+
+        if( mpi::Rank() == 0 )
+            Output("Passed");
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return EXIT_FAILURE;
+    }
+
+    return 0;
+}
@@ -194,6 +194,108 @@ void TestGemm
         flush(std::cout);
     }
 
+    // Test the variant of Gemm that keeps C stationary and overlaps the
+    // panel communication with the local updates
+    if (D == Device::CPU)
+    {
+        for (int ii = 0; ii < 6; ++ii)
+        {
+            C = COrig;
+            OutputFromRoot(g.Comm(),"Pipelined Stationary C Algorithm:");
+            PushIndent();
+            timer.Reset();
+            mpi::Barrier(g.Comm());
+            timer.Start();
+            Gemm(orientA, orientB, alpha, A, B, beta, C,
+                 GEMM_SUMMA_C_PIPELINED);
+            mpi::Barrier(g.Comm());
+            timer.Stop();
+            runTime = timer.GetTime();
+            realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+            gFlops = (IsComplex<T>::value ? 4*realGFlops : realGFlops);
+
+            OutputFromRoot(
+                g.Comm(),"Finished in ",runTime," seconds (",gFlops,
+                " GFlop/s)");
+
+            if (print)
+                Print(C, BuildString("C := ",alpha," A B + ",beta," C"));
+            if (correctness)
+                TestAssociativity
+                    (orientA, orientB, alpha, A, B, beta, COrig, C, print);
+            PopIndent();
+
+            flush(std::cout);
+        }
+    }
+
+    // Test the 2.5D variant of Gemm that replicates the inputs over
+    // GemmReplicationDepth() layers of the grid
+    const Int depth = GemmReplicationDepth();
+    if (depth == 0 || g.Size() % depth == 0)
+    {
+        for (int ii = 0; ii < 6; ++ii)
+        {
+            C = COrig;
+            OutputFromRoot(g.Comm(),"2.5D Algorithm:");
+            PushIndent();
+            timer.Reset();
+            mpi::Barrier(g.Comm());
+            timer.Start();
+            Gemm(orientA, orientB, alpha, A, B, beta, C, GEMM_SUMMA_3D);
+            mpi::Barrier(g.Comm());
+            timer.Stop();
+            runTime = timer.GetTime();
+            realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+            gFlops = (IsComplex<T>::value ? 4*realGFlops : realGFlops);
+
+            OutputFromRoot(
+                g.Comm(),"Finished in ",runTime," seconds (",gFlops,
+                " GFlop/s)");
+
+            if (print)
+                Print(C, BuildString("C := ",alpha," A B + ",beta," C"));
+            if (correctness)
+                TestAssociativity
+                    (orientA, orientB, alpha, A, B, beta, COrig, C, print);
+            PopIndent();
+
+            flush(std::cout);
+        }
+    }
+
+    // Test the default algorithm after tuning it for this problem
+    {
+        const GemmTuningEntry entry =
+            TuneGemm<T>(orientA, orientB, m, n, k, g, D);
+        C = COrig;
+        OutputFromRoot(
+            g.Comm(),"Tuned Default Algorithm (",GemmAlgorithmName(entry.alg),
+            ", nb=",entry.blocksize,"):");
+        PushIndent();
+        timer.Reset();
+        mpi::Barrier(g.Comm());
+        timer.Start();
+        Gemm(orientA, orientB, alpha, A, B, beta, C);
+        mpi::Barrier(g.Comm());
+        timer.Stop();
+        runTime = timer.GetTime();
+        realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+        gFlops = (IsComplex<T>::value ? 4*realGFlops : realGFlops);
+
+        OutputFromRoot(
+            g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+
+        if (print)
+            Print(C, BuildString("C := ",alpha," A B + ",beta," C"));
+        if (correctness)
+            TestAssociativity
+                (orientA, orientB, alpha, A, B, beta, COrig, C, print);
+        PopIndent();
+
+        flush(std::cout);
+    }
+
     if (orientA == NORMAL && orientB == NORMAL)
     {
         for (int ii = 0; ii < 0; ++ii)
@@ -246,6 +348,8 @@ main(int argc, char* argv[])
         const Int n = Input("--n","width of result",100);
         const Int k = Input("--k","inner dimension",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int depth =
+            Input("--depth","replication depth of the 2.5D Gemm",2);
         const bool print = Input("--print","print matrices?",false);
         const bool correctness = Input("--correctness","correctness?",true);
         const Int colAlignA = Input("--colAlignA","column align of A",0);
@@ -267,6 +371,7 @@ main(int argc, char* argv[])
         const Orientation orientA = CharToOrientation(transA);
         const Orientation orientB = CharToOrientation(transB);
         SetBlocksize(nb);
+        SetGemmReplicationDepth(depth);
 
         ComplainIfDebug();
         OutputFromRoot(g.Comm(),"Will test Gemm",transA,transB);
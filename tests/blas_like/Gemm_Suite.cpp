@@ -18,6 +18,7 @@ portion of TestGemm.
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <map>
 #include <regex>
 #include <vector>
 
@@ -57,9 +58,6 @@ std::string FloatTypeToString(FloatType);
 Orientation StringToOrientation(std::string const&);
 std::string OrientationToString(Orientation);
 
-GemmAlgorithm StringToGemmAlgorithm(std::string const&);
-std::string GemmAlgorithmToString(GemmAlgorithm);
-
 struct Experiment
 {
     Experiment(std::string const& dev, std::string const& type,
@@ -87,6 +85,9 @@ ExperimentResults RunExperiments(ExperimentSuite const&, Grid const&);
 void OutputResults(ExperimentSuite const&, ExperimentResults const&,
                    std::string const& output_file, mpi::Comm const&);
 
+void OutputTuningTable(ExperimentSuite const&, ExperimentResults const&,
+                       std::string const& tuning_file, Grid const&);
+
 template<typename T, Device D>
 void TestAssociativity(
     Orientation orientA, Orientation orientB,
@@ -144,7 +145,7 @@ ExperimentResult TestGemm(
         g.Comm(),
         "Testing Gemm",
         OrientationToChar(orientA), OrientationToChar(orientB),
-        "_", GemmAlgorithmToString(alg),
+        "_", GemmAlgorithmName(alg),
         " with ", TypeName<T>(), " on ", DeviceName<D>());
     PushIndent();
     OutputFromRoot(g.Comm(), "M=", m, " N=", n, " K=", k, " NB=", block_size);
@@ -286,6 +287,9 @@ int main(int argc, char* argv[])
                                          std::string("not_a_thing.ext"));
     const std::string output_file = Input("--o", "Output file",
                                           std::string("also_not_a_thing.ext"));
+    const std::string tuning_file =
+        Input("--tuningFile", "Gemm tuning table to write (none if empty)",
+              std::string(""));
     int gridHeight = Input("--gridHeight","height of process grid",0);
     volatile int wait = Input("--waitDebug","wait for debugger",0);
 
@@ -324,6 +328,8 @@ int main(int argc, char* argv[])
 #endif // HYDROGEN_HAVE_CUDA
 
     OutputResults(suite, results, output_file, comm);
+    if (!tuning_file.empty())
+        OutputTuningTable(suite, results, tuning_file, g);
 
     mpi::Barrier(comm);
 #ifdef HYDROGEN_HAVE_CUDA
@@ -427,50 +433,6 @@ std::string OrientationToString(Orientation O)
     return "Unknown orientation";
 }
 
-GemmAlgorithm StringToGemmAlgorithm(std::string const& str)
-{
-    if (str == "DEFAULT")
-        return GEMM_DEFAULT;
-    if (str == "SUMMA_A_MS")
-        return GEMM_SUMMA_A_MS;
-    if (str == "SUMMA_A")
-        return GEMM_SUMMA_A;
-    if (str == "SUMMA_B_MS")
-        return GEMM_SUMMA_B_MS;
-    if (str == "SUMMA_B")
-        return GEMM_SUMMA_B;
-    if (str == "SUMMA_C_MS")
-        return GEMM_SUMMA_C_MS;
-    if (str == "SUMMA_C")
-        return GEMM_SUMMA_C;
-    if (str == "SUMMA_DOT")
-        return GEMM_SUMMA_DOT;
-    if (str == "CANNON")
-        return GEMM_CANNON;
-    //if (str == "COSMA")
-    //    return GEMM_COSMA;
-
-    throw std::runtime_error("Bad Gemm algorithm string");
-}
-
-std::string GemmAlgorithmToString(GemmAlgorithm alg)
-{
-    switch (alg)
-    {
-    case GEMM_DEFAULT:      return "DEFAULT";
-    case GEMM_SUMMA_A_MS:   return "SUMMA_A_MS";
-    case GEMM_SUMMA_A:      return "SUMMA_A";
-    case GEMM_SUMMA_B_MS:   return "SUMMA_B_MS";
-    case GEMM_SUMMA_B:      return "SUMMA_B";
-    case GEMM_SUMMA_C_MS:   return "SUMMA_C_MS";
-    case GEMM_SUMMA_C:      return "SUMMA_C";
-    case GEMM_SUMMA_DOT:    return "SUMMA_DOT";
-    case GEMM_CANNON:       return "CANNON";
-    //case GEMM_COSMA:       return "COSMA";
-    }
-    return "Unknown GEMM Algorithm";// silence compiler warning
-}
-
 Experiment::Experiment(std::string const& dev,
                        std::string const& flt,
                        std::string const& transA,
@@ -484,7 +446,7 @@ Experiment::Experiment(std::string const& dev,
       type{StringToFloatType(flt)},
       orient_A{StringToOrientation(transA)},
       orient_B{StringToOrientation(transB)},
-      alg{StringToGemmAlgorithm(algorithm)},
+      alg{GemmAlgorithmFromName(algorithm)},
       m{std::stoul(mm)},
       n{std::stoul(nn)},
       k{std::stoul(kk)},
@@ -640,7 +602,7 @@ void OutputResults(
             << FloatTypeToString(exp.type) << sep
             << OrientationToString(exp.orient_A) << sep
             << OrientationToString(exp.orient_B) << sep
-            << GemmAlgorithmToString(exp.alg) << sep
+            << GemmAlgorithmName(exp.alg) << sep
             << exp.m << sep
             << exp.n << sep
             << exp.k << sep
@@ -668,3 +630,64 @@ void OutputResults(
         return OutputResults(suite, results, ofs, comm);
     }
 }
+
+std::string TuningTypeName(FloatType F, Device D)
+{
+    switch (F)
+    {
+#ifdef HYDROGEN_HAVE_HALF
+    case FloatType::HALF:
+#if defined HYDROGEN_HAVE_GPU && defined HYDROGEN_GPU_USE_FP16
+        if (D == Device::GPU)
+            return TypeName<gpu_half_type>();
+#endif // defined HYDROGEN_HAVE_GPU && defined HYDROGEN_GPU_USE_FP16
+        return TypeName<cpu_half_type>();
+#endif // HYDROGEN_HAVE_HALF
+    case FloatType::FLOAT:
+        return TypeName<float>();
+    case FloatType::DOUBLE:
+        return TypeName<double>();
+    }
+    return "unknown type"; // silence compiler warning
+}
+
+// Records the fastest (algorithm, blocksize) pair of each problem bucket
+// in the tuning table consulted by GEMM_DEFAULT and writes it to disk.
+void OutputTuningTable(
+    ExperimentSuite const& suite, ExperimentResults const& results,
+    std::string const& tuning_file, Grid const& g)
+{
+    std::map<GemmTuningKey, double> best_times;
+    auto res_it = results.cbegin();
+    for (auto const& exp : suite)
+    {
+        auto const& res = *res_it++;
+        if (exp.alg == GEMM_DEFAULT || res.empty())
+            continue;
+
+        // Decide on the slowest process's mean time
+        long double mean = 0.;
+        for (auto const& r : res)
+            mean += r;
+        double time = double(mean / res.size());
+        time = mpi::AllReduce(time, mpi::MAX, g.Comm(),
+                              SyncInfo<Device::CPU>{});
+
+        auto const key = MakeGemmTuningKey(
+            g, TuningTypeName(exp.type, exp.device), exp.device,
+            exp.orient_A, exp.orient_B, exp.m, exp.n, exp.k);
+        auto it = best_times.find(key);
+        if (it == best_times.end() || time < it->second)
+        {
+            best_times[key] = time;
+            GemmTuningEntry entry;
+            entry.alg = exp.alg;
+            entry.blocksize = (exp.alg == GEMM_SUMMA_DOT
+                               ? GemmHeuristics().blocksizeDot
+                               : Int(exp.nb));
+            SetGemmTuning(key, entry);
+        }
+    }
+    if (g.Comm().Rank() == 0)
+        SaveGemmTuningTable(tuning_file);
+}
@@ -0,0 +1,118 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+/*
+  Testing the out-of-core Gemm, which streams tiles of binary files through
+  memory, against the in-core Gemm for each pair of orientations, with both
+  explicitly chosen tile sizes and tile sizes derived from a memory budget.
+*/
+#include <El.hpp>
+#include <cstdio>
+using namespace El;
+
+template<typename T>
+void TestGemm
+( const Grid& g, Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k, T beta, const OutOfCoreCtrl& ctrl,
+  const string& prefix )
+{
+    const bool normalA = ( orientA == NORMAL );
+    const bool normalB = ( orientB == NORMAL );
+    DistMatrix<T> A(g), B(g), C(g), CEst(g);
+    Uniform( A, ( normalA ? m : k ), ( normalA ? k : m ) );
+    Uniform( B, ( normalB ? k : n ), ( normalB ? n : k ) );
+    Uniform( C, m, n );
+    const T alpha = T(2);
+
+    const string AName=prefix+"-A", BName=prefix+"-B", CName=prefix+"-C";
+    Write( A, AName, BINARY );
+    Write( B, BName, BINARY );
+    if( beta != T(0) )
+        Write( C, CName, BINARY );
+    OutOfCoreGemm
+    ( orientA, orientB,
+      alpha, AName+".bin", BName+".bin", beta, CName+".bin", g, ctrl );
+    Read( CEst, CName+".bin", BINARY );
+
+    Gemm( orientA, orientB, alpha, A, B, beta, C );
+    const Base<T> CNorm = FrobeniusNorm( C );
+    Axpy( T(-1), C, CEst );
+    const Base<T> relError = FrobeniusNorm( CEst ) / CNorm;
+    OutputFromRoot
+    (g.Comm(),"orientations (",OrientationToChar(orientA),",",
+     OrientationToChar(orientB),"), beta=",beta,": ||C - CEst||_F / ||C||_F = ",
+     relError);
+    const Base<T> eps = limits::Epsilon<Base<T>>();
+    if( relError > Base<T>(10)*k*eps )
+        LogicError("Relative error was unacceptably large");
+
+    if( g.Rank() == 0 )
+    {
+        std::remove( (AName+".bin").c_str() );
+        std::remove( (BName+".bin").c_str() );
+        std::remove( (CName+".bin").c_str() );
+    }
+}
+
+template<typename T>
+void TestOutOfCoreGemm
+( const Grid& g, Int m, Int n, Int k, Int tileSize, const string& prefix )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    PushIndent();
+    const Orientation orient2 = ( IsComplex<T>::value ? ADJOINT : TRANSPOSE );
+
+    // Tiles which divide none of the dimensions evenly
+    OutOfCoreCtrl ctrl;
+    ctrl.tileSize = tileSize;
+    TestGemm<T>( g, NORMAL, NORMAL, m, n, k, T(0), ctrl, prefix );
+    TestGemm<T>( g, orient2, NORMAL, m, n, k, T(3), ctrl, prefix );
+    TestGemm<T>( g, NORMAL, orient2, m, n, k, T(0), ctrl, prefix );
+    TestGemm<T>( g, orient2, orient2, m, n, k, T(-1), ctrl, prefix );
+
+    // A budget which only allows for a few tiles in each dimension
+    ctrl.tileSize = 0;
+    ctrl.memoryBudget = 11*sizeof(T)*(m/3)*(m/3)/g.Size();
+    TestGemm<T>( g, NORMAL, NORMAL, m, n, k, T(1), ctrl, prefix );
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","height of C",200);
+        const Int n = Input("--n","width of C",150);
+        const Int k = Input("--k","inner dimension",170);
+        const Int tileSize = Input("--tileSize","tile size",48);
+        const string prefix =
+          Input
+          ("--prefix","prefix of the scratch files",string("OutOfCoreGemm"));
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( mpi::NewWorldComm() );
+        TestOutOfCoreGemm<float>( g, m, n, k, tileSize, prefix );
+        TestOutOfCoreGemm<double>( g, m, n, k, tileSize, prefix );
+        TestOutOfCoreGemm<Complex<double>>( g, m, n, k, tileSize, prefix );
+
+        if( mpi::Rank() == 0 )
+            Output("Passed");
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return EXIT_FAILURE;
+    }
+
+    return 0;
+}
@@ -0,0 +1,151 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+/*
+  Testing the Philox4x32-10 generator against its known answers, and that
+  the counter-based random fills of a distributed matrix do not depend upon
+  the distribution, the grid shape, or the grid ordering.
+*/
+#include <El.hpp>
+using namespace El;
+
+void TestKnownAnswers()
+{
+    // From the Random123 known-answer tests
+    const std::array<std::uint32_t,4> zeros =
+      Philox4x32(0)( 0, 0 );
+    const std::array<std::uint32_t,4> ones =
+      Philox4x32(~std::uint64_t(0))( ~std::uint64_t(0), ~std::uint64_t(0) );
+    const std::array<std::uint32_t,4> pi =
+      Philox4x32(0x299f31d0a4093822ULL)
+      ( 0x85a308d3243f6a88ULL, 0x0370734413198a2eULL );
+    const std::array<std::uint32_t,4> zerosExpected =
+      {{0x6627e8d5,0xe169c58d,0xbc57ac4c,0x9b00dbd8}};
+    const std::array<std::uint32_t,4> onesExpected =
+      {{0x408f276d,0x41c83b0e,0xa20bc7c6,0x6d5451fd}};
+    const std::array<std::uint32_t,4> piExpected =
+      {{0xd16cfe09,0x94fdcceb,0x5001e420,0x24126ea1}};
+    if( zeros != zerosExpected || ones != onesExpected || pi != piExpected )
+        LogicError("Philox4x32 did not match its known answers");
+}
+
+// Restart the sequence of fills and draw twice, so that the second fill
+// depends upon the first having advanced the sequence identically
+template<typename T>
+void Draw( AbstractDistMatrix<T>& A, Int m, Int n )
+{
+    SetCounterBasedSeed( 17 );
+    Uniform( A, m, n, T(3), Base<T>(5) );
+    if constexpr( !IsIntegral<T>::value )
+        Gaussian( A, m, n );
+}
+
+template<typename T,Dist U,Dist V,DistWrap W>
+void TestFills( const Grid& g, Int m, Int n, const Matrix<T>& expected )
+{
+    DistMatrix<T,U,V,W> A(g);
+    Draw( A, m, n );
+
+    // Every local entry, including the redundant copies, must match
+    Base<T> error = 0;
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            error = Max( error, Abs(A.GetLocal(iLoc,jLoc)-
+              expected.Get(A.GlobalRow(iLoc),A.GlobalCol(jLoc))) );
+    mpi::AllReduce
+    ( &error, 1, mpi::MAX, g.ViewingComm(), SyncInfo<Device::CPU>() );
+    if( error != Base<T>(0) )
+        LogicError
+        ("[",DistToString(U),",",DistToString(V),"] on a ",g.Height()," x ",
+         g.Width()," grid differed from the reference");
+}
+
+template<typename T>
+void TestGrid( const Grid& g, Int m, Int n, const Matrix<T>& expected )
+{
+    TestFills<T,MC,MR,ELEMENT>( g, m, n, expected );
+    TestFills<T,MR,MC,ELEMENT>( g, m, n, expected );
+    TestFills<T,MC,STAR,ELEMENT>( g, m, n, expected );
+    TestFills<T,STAR,VR,ELEMENT>( g, m, n, expected );
+    TestFills<T,MD,STAR,ELEMENT>( g, m, n, expected );
+    TestFills<T,CIRC,CIRC,ELEMENT>( g, m, n, expected );
+    TestFills<T,MC,MR,BLOCK>( g, m, n, expected );
+}
+
+template<typename T>
+void TestIndependence( Int m, Int n )
+{
+    const int commSize = mpi::Size();
+
+    // The reference is drawn in full by every process
+    DistMatrix<T,STAR,STAR> reference;
+    Draw( reference, m, n );
+
+    for( int height=1; height<=commSize; ++height )
+    {
+        if( commSize % height != 0 )
+            continue;
+        for( const GridOrder order : { COLUMN_MAJOR, ROW_MAJOR } )
+        {
+            const Grid g( mpi::NewWorldComm(), height, order );
+            TestGrid( g, m, n, reference.LockedMatrix() );
+        }
+    }
+}
+
+void TestMoments( Int m )
+{
+    // The sample mean and variance of m^2 standard normal samples
+    DistMatrix<double> A;
+    Gaussian( A, m, m );
+    DistMatrix<double,STAR,STAR> A_STAR_STAR( A );
+    double mean=0, variance=0;
+    for( Int j=0; j<m; ++j )
+        for( Int i=0; i<m; ++i )
+            mean += A_STAR_STAR.GetLocal(i,j);
+    mean /= m*m;
+    for( Int j=0; j<m; ++j )
+        for( Int i=0; i<m; ++i )
+            variance += Pow(A_STAR_STAR.GetLocal(i,j)-mean,2.);
+    variance /= m*m-1;
+    OutputFromRoot
+    (mpi::COMM_WORLD,"Gaussian sample mean ",mean,", variance ",variance);
+    if( Abs(mean) > 5./m || Abs(variance-1) > 10./m )
+        LogicError("Gaussian samples had implausible moments");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",37);
+        const Int n = Input("--width","width of matrix",29);
+        ProcessInput();
+        PrintInputReport();
+
+        TestKnownAnswers();
+        TestIndependence<Int>( m, n );
+        TestIndependence<double>( m, n );
+        TestIndependence<Complex<float>>( m, n );
+        TestMoments( 300 );
+
+        if( mpi::Rank() == 0 )
+            Output("Passed");
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return EXIT_FAILURE;
+    }
+
+    return 0;
+}
@@ -0,0 +1,222 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+/*
+  Testing that matrices (and the local parts of distributed matrices) can be
+  backed by memory mappings of binary files in the read-only, copy-on-write
+  and shared modes, and that file-backed matrices refuse to grow.
+*/
+#include <El.hpp>
+#include <cstdio>
+#include <fstream>
+using namespace El;
+
+template<typename T>
+T Value( Int i, Int j )
+{ return T(i+1) + T(j)/T(4); }
+
+template<typename T>
+void WriteFile
+( const string& filename, size_t offset, Int numEntries,
+  std::function<T(Int)> entry )
+{
+    std::ofstream file( filename.c_str(), std::ios::binary );
+    const vector<char> header( offset, 'x' );
+    file.write( header.data(), offset );
+    for( Int k=0; k<numEntries; ++k )
+    {
+        const T alpha = entry(k);
+        file.write( reinterpret_cast<const char*>(&alpha), sizeof(T) );
+    }
+    if( !file )
+        RuntimeError("Could not write ",filename);
+}
+
+template<typename T>
+vector<T> ReadFile( const string& filename, size_t offset, Int numEntries )
+{
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    file.seekg( offset );
+    vector<T> buffer( numEntries );
+    file.read( reinterpret_cast<char*>(buffer.data()), numEntries*sizeof(T) );
+    if( !file )
+        RuntimeError("Could not read ",filename);
+    return buffer;
+}
+
+template<typename T>
+void CheckEntries( const Matrix<T>& A, T scale, const string& msg )
+{
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            if( A.Get(i,j) != scale*Value<T>(i,j) )
+                LogicError(msg,": entry (",i,",",j,") was ",A.Get(i,j));
+}
+
+template<typename T>
+void TestSequential( const string& filename, Int m, Int n, Int nb )
+{
+    Output("Testing Matrix with ",TypeName<T>());
+    PushIndent();
+    // Leave a header so that the data does not begin on a page boundary
+    const size_t offset = 40;
+    auto entry = [&]( Int k ) { return Value<T>(k%m,k/m); };
+    WriteFile<T>( filename, offset, m*n, entry );
+
+    {
+        Matrix<T> A;
+        A.MapFile( filename, m, n, FILE_MAP_READ_ONLY, offset );
+        if( !A.FileBacked() || !A.Locked() )
+            LogicError("Read-only mapping was not a locked file-backed matrix");
+        for( Int j=0; j<n; j+=nb )
+        {
+            const Int jb = Min(nb,n-j);
+            A.AdviseFileAccess( FILE_ACCESS_WILL_NEED, j, jb );
+            A.AdviseFileAccess( FILE_ACCESS_SEQUENTIAL, j+jb );
+        }
+        CheckEntries( A, T(1), "Read-only mapping" );
+
+        // Shrinking reuses the mapping while growing is refused
+        A.Resize( m/2, n/2, m );
+        CheckEntries( A, T(1), "Shrunken mapping" );
+        bool grew = true;
+        try { A.Resize( m, n+1 ); }
+        catch( std::exception& ) { grew = false; }
+        if( grew )
+            LogicError("A file-backed matrix was allowed to grow");
+
+        A.Empty();
+        if( A.FileBacked() || A.Locked() )
+            LogicError("Emptying did not release the mapping");
+        Output("read-only mapping passed");
+    }
+
+    {
+        // View the bottom half of the rows through the leading dimension
+        Matrix<T> A;
+        A.MapFile
+        ( filename, m-m/2, n, m, FILE_MAP_READ_ONLY, offset+(m/2)*sizeof(T) );
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<m-m/2; ++i )
+                if( A.Get(i,j) != Value<T>(i+m/2,j) )
+                    LogicError("Row-block mapping was incorrect");
+        Output("leading-dimension mapping passed");
+    }
+
+    {
+        Matrix<T> A;
+        A.MapFile( filename, m, n, FILE_MAP_COPY_ON_WRITE, offset );
+        Scale( T(2), A );
+        CheckEntries( A, T(2), "Copy-on-write mapping" );
+        A.Empty();
+        const auto buffer = ReadFile<T>( filename, offset, m*n );
+        for( Int k=0; k<m*n; ++k )
+            if( buffer[k] != entry(k) )
+                LogicError("Copy-on-write mapping modified the file");
+        Output("copy-on-write mapping passed");
+    }
+
+    {
+        Matrix<T> A;
+        A.MapFile( filename, m, n, FILE_MAP_SHARED, offset );
+        Scale( T(2), A );
+        A.SyncFile();
+        A.Empty();
+        const auto buffer = ReadFile<T>( filename, offset, m*n );
+        for( Int k=0; k<m*n; ++k )
+            if( buffer[k] != T(2)*entry(k) )
+                LogicError("Shared mapping did not update the file");
+        Output("shared mapping passed");
+    }
+
+    {
+        Matrix<T> A;
+        bool mapped = true;
+        try { A.MapFile( filename, m, n+1, FILE_MAP_READ_ONLY, offset ); }
+        catch( std::exception& ) { mapped = false; }
+        if( mapped || A.FileBacked() )
+            LogicError("Mapped past the end of the file");
+        Output("short file detection passed");
+    }
+
+    std::remove( filename.c_str() );
+    PopIndent();
+}
+
+template<typename T>
+void TestDistributed( const Grid& g, const string& prefix, Int m, Int n )
+{
+    OutputFromRoot(g.Comm(),"Testing DistMatrix with ",TypeName<T>());
+    DistMatrix<T> A(g);
+    A.Resize( m, n );
+    auto& ALoc = A.Matrix();
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            ALoc(iLoc,jLoc) =
+              Value<T>( A.GlobalRow(iLoc), A.GlobalCol(jLoc) );
+
+    // Each process writes its local data to its own file
+    const string filename = BuildString(prefix,"-",g.Rank(),".bin");
+    const Int localHeight = A.LocalHeight();
+    WriteFile<T>
+    ( filename, 0, localHeight*A.LocalWidth(),
+      [&]( Int k ) { return ALoc.Get(k%localHeight,k/localHeight); } );
+
+    DistMatrix<T> B(g);
+    B.MapLocalFile( filename, m, n, FILE_MAP_READ_ONLY );
+    if( B.LocalHeight() != localHeight || B.LocalWidth() != A.LocalWidth() )
+        LogicError("Local dimensions of the mapped matrix were incorrect");
+    Axpy( T(-1), B, A );
+    const Base<T> errorNorm = FrobeniusNorm( A );
+    if( errorNorm != Base<T>(0) )
+        LogicError("Mapped distributed matrix differed by ",errorNorm);
+
+    B.Empty();
+    std::remove( filename.c_str() );
+    OutputFromRoot(g.Comm(),"distributed read-only mapping passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int m = Input("--height","height of matrix",300);
+        const Int n = Input("--width","width of matrix",200);
+        const Int nb = Input("--nb","panel width for access hints",32);
+        const string prefix =
+          Input
+          ("--prefix","prefix of the scratch files",
+           string("FileBackedMatrix"));
+        ProcessInput();
+        PrintInputReport();
+
+#ifdef HYDROGEN_HAVE_MMAP
+        if( mpi::Rank(mpi::COMM_WORLD) == 0 )
+        {
+            const string filename = prefix+"-seq.bin";
+            TestSequential<float>( filename, m, n, nb );
+            TestSequential<double>( filename, m, n, nb );
+            TestSequential<Complex<double>>( filename, m, n, nb );
+        }
+        mpi::Barrier( mpi::COMM_WORLD );
+
+        const Grid g( mpi::NewWorldComm() );
+        TestDistributed<double>( g, prefix, m, n );
+        TestDistributed<Complex<float>>( g, prefix, m, n );
+#else
+        if( mpi::Rank(mpi::COMM_WORLD) == 0 )
+            Output("File-backed storage is unavailable; skipping");
+#endif // HYDROGEN_HAVE_MMAP
+    }
+    catch( std::exception& e ) { ReportException(e); return EXIT_FAILURE; }
+
+    return 0;
+}
@@ -0,0 +1,168 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+/*
+  Testing the node-aware (hierarchical) collectives against the flat MPI
+  collectives, both with every process of a node in one group and with the
+  nodes split into groups of two processes (which emulates several nodes
+  with interleaved ranks on a single machine).
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void CheckEqual( const vector<T>& a, const vector<T>& b, const string& msg )
+{
+    const Base<T> eps = limits::Epsilon<Base<T>>();
+    for( size_t i=0; i<a.size(); ++i )
+        if( Abs(a[i]-b[i]) > 10*eps*Max(Abs(b[i]),Base<T>(1)) )
+            LogicError(msg," was wrong at entry ",i);
+}
+
+template<typename T>
+void TestCollectives( mpi::Comm const& comm, int count, mpi::Op op )
+{
+    SyncInfo<Device::CPU> syncInfo;
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    vector<T> send( count*commSize );
+    for( auto& alpha : send )
+        alpha = SampleUniform<T>();
+
+    // AllReduce, both out-of-place and in-place
+    vector<T> flat( count ), hier( count ), inPlace( send.begin(),
+                                                     send.begin()+count );
+    mpi::SetHierarchicalCollectives( false );
+    mpi::AllReduce( send.data(), flat.data(), count, op, comm, syncInfo );
+    mpi::SetHierarchicalCollectives( true );
+    mpi::AllReduce( send.data(), hier.data(), count, op, comm, syncInfo );
+    mpi::AllReduce( inPlace.data(), count, op, comm, syncInfo );
+    CheckEqual( hier, flat, "AllReduce" );
+    CheckEqual( inPlace, flat, "In-place AllReduce" );
+
+    // ReduceScatter, both out-of-place and in-place
+    mpi::SetHierarchicalCollectives( false );
+    mpi::ReduceScatter( send.data(), flat.data(), count, op, comm, syncInfo );
+    mpi::SetHierarchicalCollectives( true );
+    mpi::ReduceScatter( send.data(), hier.data(), count, op, comm, syncInfo );
+    inPlace = send;
+    mpi::ReduceScatter( inPlace.data(), count, op, comm, syncInfo );
+    inPlace.resize( count );
+    CheckEqual( hier, flat, "ReduceScatter" );
+    CheckEqual( inPlace, flat, "In-place ReduceScatter" );
+
+    // AllGather
+    vector<T> flatGather( count*commSize ), hierGather( count*commSize );
+    mpi::SetHierarchicalCollectives( false );
+    mpi::AllGather
+    ( send.data(), count, flatGather.data(), count, comm, syncInfo );
+    mpi::SetHierarchicalCollectives( true );
+    mpi::AllGather
+    ( send.data(), count, hierGather.data(), count, comm, syncInfo );
+    CheckEqual( hierGather, flatGather, "AllGather" );
+
+    // Broadcast from every root
+    for( int root=0; root<commSize; ++root )
+    {
+        vector<T> bufFlat( count, T(0) ), bufHier( count, T(0) );
+        if( commRank == root )
+        {
+            bufFlat.assign( send.begin(), send.begin()+count );
+            bufHier = bufFlat;
+        }
+        mpi::SetHierarchicalCollectives( false );
+        mpi::Broadcast( bufFlat.data(), count, root, comm, syncInfo );
+        mpi::SetHierarchicalCollectives( true );
+        mpi::Broadcast( bufHier.data(), count, root, comm, syncInfo );
+        CheckEqual
+        ( bufHier, bufFlat, "Broadcast from "+std::to_string(root) );
+    }
+}
+
+template<typename T>
+void TestRedistributions( const Grid& g, Int m, Int n )
+{
+    DistMatrix<T> A(g);
+    Uniform( A, m, n );
+
+    mpi::SetHierarchicalCollectives( false );
+    DistMatrix<T,STAR,STAR> AFlat( A );
+    DistMatrix<T,MC,STAR> BFlat(g);
+    Contract( AFlat, BFlat );
+    mpi::SetHierarchicalCollectives( true );
+    DistMatrix<T,STAR,STAR> AHier( A );
+    DistMatrix<T,MC,STAR> BHier(g);
+    Contract( AHier, BHier );
+
+    Axpy( T(-1), AFlat.Matrix(), AHier.Matrix() );
+    Axpy( T(-1), BFlat.Matrix(), BHier.Matrix() );
+    if( MaxNorm(AHier.Matrix()) != Base<T>(0) )
+        LogicError("[MC,MR] -> [STAR,STAR] was wrong");
+    const Base<T> eps = limits::Epsilon<Base<T>>();
+    if( MaxNorm(BHier.Matrix()) >
+        10*g.Size()*eps*Max(MaxNorm(BFlat),Base<T>(1)) )
+        LogicError("Contraction onto [MC,STAR] was wrong");
+}
+
+template<typename T>
+void TestHierarchical( int maxRanksPerNode, Int m, Int n )
+{
+    mpi::SetMaxRanksPerNode( maxRanksPerNode );
+    // The node decomposition is cached by each communicator, so these must
+    // be created after the grouping is chosen
+    mpi::Comm comm = mpi::NewWorldComm();
+    const Grid g( mpi::NewWorldComm() );
+    OutputFromRoot
+    (comm,"Testing with ",TypeName<T>()," and ",mpi::GetNodeComms(comm).
+     NumNodes()," node(s)");
+    PushIndent();
+    for( const int count : { 1, 17, 1000 } )
+    {
+        TestCollectives<T>( comm, count, mpi::SUM );
+        if( !IsComplex<T>::value )
+            TestCollectives<T>( comm, count, mpi::MAX );
+    }
+    OutputFromRoot(comm,"collectives passed");
+    TestRedistributions<T>( g, m, n );
+    OutputFromRoot(comm,"redistributions passed");
+    PopIndent();
+    mpi::SetHierarchicalCollectives( false );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",100);
+        const Int n = Input("--n","width of matrix",70);
+        ProcessInput();
+        PrintInputReport();
+
+        for( const int maxRanksPerNode : { 0, 2 } )
+        {
+            TestHierarchical<float>( maxRanksPerNode, m, n );
+            TestHierarchical<double>( maxRanksPerNode, m, n );
+            TestHierarchical<Complex<double>>( maxRanksPerNode, m, n );
+        }
+        mpi::SetMaxRanksPerNode( 0 );
+
+        if( mpi::Rank() == 0 )
+            Output("Passed");
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return EXIT_FAILURE;
+    }
+
+    return 0;
+}
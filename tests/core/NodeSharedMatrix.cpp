@@ -0,0 +1,165 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+/*
+  Testing [STAR,STAR], [MC,STAR] and [STAR,MR] matrices whose local data is
+  shared by the processes of each node: redistributions into them are
+  compared against privately-stored copies, an update by the writer of a
+  node must be seen by every process of that node, and a SUMMA-style
+  product built from node-shared panels is compared against Gemm. The nodes
+  are also emulated by splitting this machine into groups of two processes.
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+void CheckEqual
+( const ElementalMatrix<T>& A, const ElementalMatrix<T>& B, const string& msg )
+{
+    if( A.Height() != B.Height() || A.Width() != B.Width() ||
+        A.LocalHeight() != B.LocalHeight() || A.LocalWidth() != B.LocalWidth() )
+        LogicError(msg," had the wrong size");
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            if( A.GetLocal(iLoc,jLoc) != B.GetLocal(iLoc,jLoc) )
+                LogicError(msg," was wrong at local entry (",iLoc,",",jLoc,")");
+}
+
+template<typename T>
+void TestRedistributions( const Grid& g, Int m, Int n )
+{
+    DistMatrix<T> A(g);
+    Uniform( A, m, n );
+
+    DistMatrix<T,STAR,STAR> AShared(g);
+    DistMatrix<T,MC,STAR> BShared(g);
+    AShared.SetNodeSharedStorage();
+    BShared.SetNodeSharedStorage();
+    if( !AShared.NodeSharedStorage() || !BShared.NodeSharedStorage() )
+        LogicError("Node-shared storage was not enabled");
+    AShared = A;
+    BShared = A;
+    DistMatrix<T,STAR,STAR> APriv( A );
+    DistMatrix<T,MC,STAR> BPriv( A );
+    CheckEqual( AShared, APriv, "[MC,MR] -> [STAR,STAR]" );
+    CheckEqual( BShared, BPriv, "[MC,MR] -> [MC,STAR]" );
+
+    // Growing the shared storage
+    Uniform( A, 2*m, n+3 );
+    AShared = A;
+    BShared = A;
+    APriv = A;
+    BPriv = A;
+    CheckEqual( AShared, APriv, "Larger [MC,MR] -> [STAR,STAR]" );
+    CheckEqual( BShared, BPriv, "Larger [MC,MR] -> [MC,STAR]" );
+
+    // An update by the writer of each node is seen by the whole node
+    if( AShared.NodeSharedWriter() )
+        AShared.SetLocal( 0, 0, T(42) );
+    AShared.NodeSharedBarrier();
+    if( AShared.GetLocal(0,0) != T(42) )
+        LogicError("An update of node-shared storage was not seen");
+    APriv.SetLocal( 0, 0, T(42) );
+
+    // Returning to private storage keeps the contents
+    AShared.SetNodeSharedStorage( false );
+    BShared.SetNodeSharedStorage( false );
+    if( AShared.NodeSharedStorage() || !AShared.NodeSharedWriter() )
+        LogicError("Node-shared storage was not disabled");
+    CheckEqual( AShared, APriv, "Unshared [STAR,STAR]" );
+    CheckEqual( BShared, BPriv, "Unshared [MC,STAR]" );
+}
+
+template<typename T>
+void TestSUMMA( const Grid& g, Int m, Int n, Int k, Int blocksize )
+{
+    DistMatrix<T> A(g), B(g), C(g), CRef(g);
+    Uniform( A, m, k );
+    Uniform( B, k, n );
+    Zeros( C, m, n );
+    Zeros( CRef, m, n );
+    Gemm( NORMAL, NORMAL, T(1), A, B, T(0), CRef );
+
+    // C := A B as a sequence of rank-blocksize updates from panels which
+    // are stored once per node
+    DistMatrix<T,MC,STAR> A1_MC_STAR(g);
+    DistMatrix<T,STAR,MR> B1_STAR_MR(g);
+    A1_MC_STAR.AlignWith( C );
+    B1_STAR_MR.AlignWith( C );
+    A1_MC_STAR.SetNodeSharedStorage();
+    B1_STAR_MR.SetNodeSharedStorage();
+    for( Int k0=0; k0<k; k0+=blocksize )
+    {
+        const Int nb = Min(blocksize,k-k0);
+        auto A1 = A( ALL, IR(k0,k0+nb) );
+        auto B1 = B( IR(k0,k0+nb), ALL );
+        A1_MC_STAR = A1;
+        B1_STAR_MR = B1;
+        LocalGemm( NORMAL, NORMAL, T(1), A1_MC_STAR, B1_STAR_MR, T(1), C );
+    }
+
+    Axpy( T(-1), CRef, C );
+    const Base<T> eps = limits::Epsilon<Base<T>>();
+    const Base<T> tol = 10*k*eps*Max(MaxNorm(CRef),Base<T>(1));
+    if( MaxNorm(C) > tol )
+        LogicError("SUMMA with node-shared panels was wrong");
+}
+
+template<typename T>
+void TestNodeShared( int maxRanksPerNode, Int m, Int n, Int k, Int blocksize )
+{
+    mpi::SetMaxRanksPerNode( maxRanksPerNode );
+    // The node decomposition is cached by each communicator, so the grid
+    // must be created after the grouping is chosen
+    const Grid g( mpi::NewWorldComm() );
+    OutputFromRoot
+    (g.Comm(),"Testing with ",TypeName<T>()," and ",
+     mpi::GetNodeComms(g.VCComm()).NumNodes()," node(s)");
+    PushIndent();
+    TestRedistributions<T>( g, m, n );
+    OutputFromRoot(g.Comm(),"redistributions passed");
+    TestSUMMA<T>( g, m, n, k, blocksize );
+    OutputFromRoot(g.Comm(),"SUMMA passed");
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","height of C",60);
+        const Int n = Input("--n","width of C",50);
+        const Int k = Input("--k","inner dimension",40);
+        const Int blocksize = Input("--blocksize","algorithmic blocksize",16);
+        ProcessInput();
+        PrintInputReport();
+
+        for( const int maxRanksPerNode : { 0, 2 } )
+        {
+            TestNodeShared<float>( maxRanksPerNode, m, n, k, blocksize );
+            TestNodeShared<double>( maxRanksPerNode, m, n, k, blocksize );
+            TestNodeShared<Complex<double>>
+            ( maxRanksPerNode, m, n, k, blocksize );
+        }
+        mpi::SetMaxRanksPerNode( 0 );
+
+        if( mpi::Rank() == 0 )
+            Output("Passed");
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return EXIT_FAILURE;
+    }
+
+    return 0;
+}
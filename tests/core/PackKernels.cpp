@@ -0,0 +1,189 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+/*
+  Testing the CPU pack and unpack kernels behind the redistributions, both
+  directly (including the cache-tiled transposing case and buffers large
+  enough to be packed in parallel) and through redistributions of a matrix
+  whose entries identify their own indices.
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T>
+T IndexEntry( Int i, Int j, Int m ) { return T(i+j*m); }
+
+template<typename T>
+void TestInterleave( Int m, Int n )
+{
+    Matrix<T> A( m, n ), B( m, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            A(i,j) = IndexEntry<T>( i, j, m );
+
+    // Store B in row-major order
+    SyncInfo<Device::CPU> syncInfo;
+    copy::util::InterleaveMatrix
+    ( m, n,
+      A.LockedBuffer(), 1, A.LDim(),
+      B.Buffer(),       n, 1,
+      syncInfo );
+    const T* BBuf = B.LockedBuffer();
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( BBuf[i*n+j] != A(i,j) )
+                LogicError
+                ("Transposing interleave of a ",m," x ",n," matrix was wrong "
+                 "at (",i,",",j,")");
+
+    // And back into column-major order, through a strided view
+    Matrix<T> C( m+3, n );
+    Zeros( C, m+3, n );
+    copy::util::InterleaveMatrix
+    ( m, n,
+      B.LockedBuffer(), n, 1,
+      C.Buffer(),       1, C.LDim(),
+      syncInfo );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m+3; ++i )
+            if( C(i,j) != ( i < m ? A(i,j) : T(0) ) )
+                LogicError
+                ("Interleave into a view of a ",m," x ",n," matrix was wrong "
+                 "at (",i,",",j,")");
+}
+
+template<typename T>
+void TestStridedPacks( Int m, Int n, Int stride )
+{
+    const Int align = Min(1,stride-1);
+    Matrix<T> A( m, n ), B( m, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            A(i,j) = IndexEntry<T>( i, j, m );
+    SyncInfo<Device::CPU> syncInfo;
+
+    // Each portion should hold the rows (or columns) owned by one rank
+    const Int colPortionSize = MaxLength(m,stride)*n;
+    vector<T> buffer( stride*colPortionSize );
+    copy::util::ColStridedPack
+    ( m, n, align, stride,
+      A.LockedBuffer(), A.LDim(), buffer.data(), colPortionSize, syncInfo );
+    for( Int k=0; k<stride; ++k )
+    {
+        const Int shift = Shift( k, align, stride );
+        const Int localHeight = Length( m, shift, stride );
+        for( Int j=0; j<n; ++j )
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                if( buffer[k*colPortionSize+iLoc+j*localHeight] !=
+                    A(shift+iLoc*stride,j) )
+                    LogicError("ColStridedPack was wrong in portion ",k);
+    }
+    Zeros( B, m, n );
+    copy::util::ColStridedUnpack
+    ( m, n, align, stride,
+      buffer.data(), colPortionSize, B.Buffer(), B.LDim(), syncInfo );
+    Axpy( T(-1), A, B );
+    if( MaxNorm(B) != Base<T>(0) )
+        LogicError("ColStridedUnpack did not invert ColStridedPack");
+
+    const Int rowPortionSize = m*MaxLength(n,stride);
+    buffer.resize( stride*rowPortionSize );
+    copy::util::RowStridedPack
+    ( m, n, align, stride,
+      A.LockedBuffer(), A.LDim(), buffer.data(), rowPortionSize, syncInfo );
+    Zeros( B, m, n );
+    copy::util::RowStridedUnpack
+    ( m, n, align, stride,
+      buffer.data(), rowPortionSize, B.Buffer(), B.LDim(), syncInfo );
+    Axpy( T(-1), A, B );
+    if( MaxNorm(B) != Base<T>(0) )
+        LogicError("RowStridedUnpack did not invert RowStridedPack");
+}
+
+template<typename T,Dist U,Dist V>
+void TestRedist( const DistMatrix<T>& A )
+{
+    const Int m = A.Height();
+    DistMatrix<T,U,V> B( A );
+    for( Int jLoc=0; jLoc<B.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<B.LocalHeight(); ++iLoc )
+            if( B.GetLocal(iLoc,jLoc) !=
+                IndexEntry<T>( B.GlobalRow(iLoc), B.GlobalCol(jLoc), m ) )
+                LogicError
+                ("[MC,MR] -> [",DistToString(U),",",DistToString(V),
+                 "] was wrong");
+
+    DistMatrix<T> C( B );
+    C -= A;
+    if( MaxNorm(C) != Base<T>(0) )
+        LogicError
+        ("[",DistToString(U),",",DistToString(V),"] -> [MC,MR] was wrong");
+}
+
+template<typename T>
+void TestPackKernels( const Grid& g, Int m, Int n )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<T>());
+    PushIndent();
+    if( g.Rank() == 0 )
+    {
+        // Small copies are packed sequentially, large ones in parallel
+        TestInterleave<T>( 7, 5 );
+        TestInterleave<T>( m, n );
+        TestStridedPacks<T>( 7, 5, 3 );
+        TestStridedPacks<T>( m, n, 3 );
+        TestStridedPacks<T>( m, n, 1 );
+        Output("pack kernels passed");
+    }
+
+    DistMatrix<T> A(g);
+    A.Resize( m, n );
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            A.SetLocal
+            ( iLoc, jLoc,
+              IndexEntry<T>( A.GlobalRow(iLoc), A.GlobalCol(jLoc), m ) );
+    TestRedist<T,VC,STAR>( A );
+    TestRedist<T,STAR,VR>( A );
+    TestRedist<T,MR,MC>( A );
+    TestRedist<T,MC,STAR>( A );
+    TestRedist<T,STAR,MR>( A );
+    TestRedist<T,STAR,STAR>( A );
+    OutputFromRoot(g.Comm(),"redistributions passed");
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",301);
+        const Int n = Input("--n","width of matrix",203);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( mpi::NewWorldComm() );
+        TestPackKernels<float>( g, m, n );
+        TestPackKernels<double>( g, m, n );
+        TestPackKernels<Complex<double>>( g, m, n );
+
+        if( mpi::Rank() == 0 )
+            Output("Passed");
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return EXIT_FAILURE;
+    }
+
+    return 0;
+}
@@ -0,0 +1,110 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+/*
+  Testing that queued remote updates (including duplicates) are summed
+  into their owners by ProcessQueues, and that queued pulls return the
+  requested entries, for several distributions and chunk sizes.
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T,Dist U,Dist V>
+void TestQueues( const Grid& g, Int m, Int n, Int numUpdates )
+{
+    mpi::Comm const& comm = g.ViewingComm();
+    const int rank = mpi::Rank( comm );
+
+    // Every process adds small integers to pseudo-random entries, so that
+    // the sums are exact regardless of the order of accumulation
+    DistMatrix<T,U,V> A(g);
+    Zeros( A, m, n );
+    Matrix<T> expected;
+    Zeros( expected, m, n );
+    A.Reserve( numUpdates );
+    std::uint64_t state = 12345 + 977*rank;
+    for( Int k=0; k<numUpdates; ++k )
+    {
+        state = state*6364136223846793005ULL + 1442695040888963407ULL;
+        const Int i = Int((state >> 33) % m);
+        const Int j = Int((state >> 17) % n);
+        const T value = T(1 + k % 5);
+        A.QueueUpdate( i, j, value );
+        expected.Update( i, j, value );
+    }
+    A.ProcessQueues();
+    mpi::AllReduce
+    ( expected.Buffer(), m*n, mpi::SUM, comm, SyncInfo<Device::CPU>() );
+
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+    Axpy( T(-1), expected, A_STAR_STAR.Matrix() );
+    if( MaxNorm( A_STAR_STAR.LockedMatrix() ) != Base<T>(0) )
+        RuntimeError
+        ("[",DistToString(U),",",DistToString(V),"] updates were not summed");
+
+    // Pull the anti-diagonal-ish entries (i,(i*7+rank)%n)
+    A.ReservePulls( m );
+    for( Int i=0; i<m; ++i )
+        A.QueuePull( i, (i*7+rank) % n );
+    vector<T> pulls;
+    A.ProcessPullQueue( pulls );
+    for( Int i=0; i<m; ++i )
+        if( pulls[i] != expected.Get( i, (i*7+rank) % n ) )
+            RuntimeError
+            ("[",DistToString(U),",",DistToString(V),"] pull was incorrect");
+}
+
+template<typename T>
+void TestAllQueues( const Grid& g, Int m, Int n, Int numUpdates )
+{
+    TestQueues<T,MC,MR>( g, m, n, numUpdates );
+    TestQueues<T,MR,MC>( g, m, n, numUpdates );
+    TestQueues<T,MC,STAR>( g, m, n, numUpdates );
+    TestQueues<T,STAR,MR>( g, m, n, numUpdates );
+    TestQueues<T,MD,STAR>( g, m, n, numUpdates );
+    TestQueues<T,VC,STAR>( g, m, n, numUpdates );
+    TestQueues<T,STAR,VR>( g, m, n, numUpdates );
+    TestQueues<T,STAR,STAR>( g, m, n, numUpdates );
+    TestQueues<T,CIRC,CIRC>( g, m, n, numUpdates );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",23);
+        const Int n = Input("--width","width of matrix",31);
+        const Int numUpdates =
+          Input("--numUpdates","number of updates per process",2000);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( mpi::NewWorldComm() );
+        for( const Int chunkSize : { 7, 1000000 } )
+        {
+            SetRedistChunkSize( chunkSize );
+            TestAllQueues<double>( g, m, n, numUpdates );
+            TestAllQueues<Complex<float>>( g, m, n, numUpdates );
+            TestAllQueues<Int>( g, m, n, numUpdates );
+        }
+
+        if( mpi::Rank() == 0 )
+            Output("Passed");
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return EXIT_FAILURE;
+    }
+
+    return 0;
+}
@@ -0,0 +1,95 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+/*
+  Testing that a RedistributionPlan, executed several times, agrees with
+  the general-purpose redistribution, both within a grid and between
+  a grid and a subgrid.
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T,Dist U,Dist V,Dist X,Dist Y>
+void TestPlan
+( const Grid& gridA, const Grid& gridB, Int m, Int n, Int numExecutions )
+{
+    DistMatrix<T,U,V> A(gridA);
+    DistMatrix<T,X,Y> B(gridB), BRef(gridB);
+    A.Resize( m, n );
+
+    RedistributionPlan<T> plan( A.DistData(), B.DistData(), m, n );
+    for( Int k=0; k<numExecutions; ++k )
+    {
+        Uniform( A, m, n );
+        plan.Execute( A, B );
+        copy::GeneralPurpose( A, BRef );
+        if( B.Participating() )
+        {
+            BRef -= B;
+            const Base<T> errNorm = MaxNorm( BRef.LockedMatrix() );
+            if( errNorm != Base<T>(0) )
+                RuntimeError
+                ("[",DistToString(U),",",DistToString(V),"] -> [",
+                 DistToString(X),",",DistToString(Y),"] differed from GeneralPurpose");
+        }
+    }
+}
+
+template<typename T>
+void TestPlans( const Grid& gridA, const Grid& gridB, Int m, Int n )
+{
+    const Int numExecutions = 3;
+    TestPlan<T,MC,MR,MR,MC>( gridA, gridB, m, n, numExecutions );
+    TestPlan<T,MC,MR,STAR,VR>( gridA, gridB, m, n, numExecutions );
+    TestPlan<T,VC,STAR,MC,MR>( gridA, gridB, m, n, numExecutions );
+    TestPlan<T,MD,STAR,STAR,STAR>( gridA, gridB, m, n, numExecutions );
+    TestPlan<T,CIRC,CIRC,MC,STAR>( gridA, gridB, m, n, numExecutions );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::NewWorldComm();
+    const Int commSize = mpi::Size( comm );
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",37);
+        const Int n = Input("--width","width of matrix",29);
+        ProcessInput();
+        PrintInputReport();
+
+        // Create MPI biggest group of squareroot-able size.
+        const Int commSqrt = Int(sqrt(double(commSize)));
+        std::vector<int> sqrtRanks(commSqrt*commSqrt);
+        for( Int i=0; i<commSqrt*commSqrt; ++i )
+            sqrtRanks[i] = i;
+        mpi::Group group, sqrtGroup;
+        mpi::CommGroup( comm, group );
+        mpi::Incl( group, sqrtRanks.size(), sqrtRanks.data(), sqrtGroup );
+
+        const Grid grid( std::move(comm) );
+        const Grid sqrtGrid( mpi::NewWorldComm(), sqrtGroup, commSqrt, COLUMN_MAJOR );
+
+        TestPlans<double>( grid, grid, m, n );
+        TestPlans<Complex<float>>( grid, sqrtGrid, m, n );
+        TestPlans<Int>( sqrtGrid, grid, m, n );
+
+        if( mpi::Rank() == 0 )
+            Output("Passed");
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return EXIT_FAILURE;
+    }
+
+    return 0;
+}
@@ -0,0 +1,157 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+/*
+  Testing the cost model behind topology-aware grids, that such grids keep
+  the requested communicator within a node (with the nodes emulated by
+  splitting this machine into groups of processes), and that Gemm is
+  unaffected by the placement of the processes.
+*/
+#include <El.hpp>
+using namespace El;
+
+void TestCostModel()
+{
+    GridTopologyCtrl ctrl;
+    auto check = [&]( int gridSize, int ranksPerNode, int height )
+    {
+        const int chosen =
+          Grid::TopologyAwareHeight( gridSize, ranksPerNode, ctrl );
+        if( chosen != height )
+            LogicError
+            ("Expected a height of ",height," for ",gridSize," processes with ",
+             ranksPerNode," per node, aspect ratio ",ctrl.aspectRatio,
+             " and ",DistToString(ctrl.onNode)," on-node, but chose ",chosen);
+    };
+
+    // On a single node, the shape is only determined by the aspect ratio
+    check( 16, 16, 4 );
+    check( 8, 8, 2 );
+    ctrl.aspectRatio = 4;
+    check( 16, 16, 8 );
+    ctrl.aspectRatio = 0.25;
+    check( 16, 16, 2 );
+
+    // Keeping the on-node communicator within a node
+    ctrl.aspectRatio = 1;
+    check( 16, 4, 4 );
+    check( 4, 2, 2 );
+    ctrl.onNode = MR;
+    check( 16, 4, 4 );
+    check( 4, 2, 2 );
+    check( 6, 3, 2 );
+    ctrl.onNode = MC;
+    check( 6, 3, 3 );
+}
+
+template<typename T>
+void TestGemm( const Grid& g, Int m, Int n, Int k )
+{
+    DistMatrix<T> A(g), B(g), C(g);
+    Uniform( A, m, k );
+    Uniform( B, k, n );
+    Zeros( C, m, n );
+    Gemm( NORMAL, NORMAL, T(1), A, B, T(0), C );
+
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A ), B_STAR_STAR( B ),
+      C_STAR_STAR( C );
+    Matrix<T> CRef;
+    Zeros( CRef, m, n );
+    Gemm
+    ( NORMAL, NORMAL,
+      T(1), A_STAR_STAR.LockedMatrix(), B_STAR_STAR.LockedMatrix(),
+      T(0), CRef );
+    Axpy( T(-1), CRef, C_STAR_STAR.Matrix() );
+    const Base<T> eps = limits::Epsilon<Base<T>>();
+    const Base<T> tol = 10*k*eps*Max(MaxNorm(CRef),Base<T>(1));
+    if( MaxNorm(C_STAR_STAR.Matrix()) > tol )
+        LogicError("Gemm on a topology-aware grid was wrong");
+}
+
+void TestPlacement
+( int maxRanksPerNode, Dist onNode, double aspectRatio, GridOrder order,
+  Int m, Int n, Int k )
+{
+    mpi::SetMaxRanksPerNode( maxRanksPerNode );
+    GridTopologyCtrl ctrl;
+    ctrl.onNode = onNode;
+    ctrl.aspectRatio = aspectRatio;
+    const Grid g( mpi::NewWorldComm(), ctrl, order );
+
+    // The grid shape follows the cost model for these nodes
+    auto& nodeComms = mpi::GetNodeComms( g.ViewingComm() );
+    int ranksPerNode = 0;
+    for( int node=0; node<nodeComms.NumNodes(); ++node )
+        ranksPerNode =
+          GCD( ranksPerNode,
+               nodeComms.NodeOffsets()[node+1]-nodeComms.NodeOffsets()[node] );
+    if( g.Height() != Grid::TopologyAwareHeight(g.Size(),ranksPerNode,ctrl) )
+        LogicError("The grid shape did not follow the cost model");
+    OutputFromRoot
+    (g.Comm(),g.Height()," x ",g.Width()," grid over ",nodeComms.NumNodes(),
+     " node(s) with ",DistToString(onNode)," on-node and aspect ratio ",
+     aspectRatio);
+
+    // Every process of the on-node communicator should be on the same node
+    mpi::Comm const& localComm = ( onNode == MC ? g.MCComm() : g.MRComm() );
+    const int localSize = mpi::Size( localComm );
+    if( ranksPerNode % localSize == 0 )
+    {
+        const int node = nodeComms.Node();
+        vector<int> nodes( localSize );
+        mpi::AllGather
+        ( &node, 1, nodes.data(), 1, localComm,
+          SyncInfo<Device::CPU>{} );
+        for( const int otherNode : nodes )
+            if( otherNode != node )
+                LogicError
+                ("The ",DistToString(onNode)," communicator spans several "
+                 "nodes");
+    }
+
+    TestGemm<double>( g, m, n, k );
+    TestGemm<Complex<float>>( g, m, n, k );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","height of C",60);
+        const Int n = Input("--n","width of C",50);
+        const Int k = Input("--k","inner dimension",40);
+        ProcessInput();
+        PrintInputReport();
+
+        TestCostModel();
+        OutputFromRoot(mpi::COMM_WORLD,"cost model passed");
+
+        for( const int maxRanksPerNode : { 0, 2 } )
+            for( const Dist onNode : { MC, MR } )
+                for( const double aspectRatio : { 1., 4., 0.25 } )
+                    for( const GridOrder order : { COLUMN_MAJOR, ROW_MAJOR } )
+                        TestPlacement
+                        ( maxRanksPerNode, onNode, aspectRatio, order,
+                          m, n, k );
+        mpi::SetMaxRanksPerNode( 0 );
+
+        if( mpi::Rank() == 0 )
+            Output("Passed");
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return EXIT_FAILURE;
+    }
+
+    return 0;
+}
@@ -0,0 +1,105 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+/*
+  Testing that copying a matrix between two grids preserves it for every
+  distribution, both from a grid onto a subgrid and back.
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T,Dist U,Dist V>
+void TestTranslate( const Grid& grid, const Grid& subGrid, Int m, Int n )
+{
+    DistMatrix<T,U,V> A(grid), ASub(subGrid), ABack(grid);
+    Uniform( A, m, n );
+    ASub = A;
+    ABack = ASub;
+
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A ), ABack_STAR_STAR( ABack );
+    DistMatrix<T,STAR,STAR> ASub_STAR_STAR(subGrid);
+    if( subGrid.InGrid() )
+        ASub_STAR_STAR = ASub;
+
+    ABack_STAR_STAR -= A_STAR_STAR;
+    Base<T> errNorm = MaxNorm( ABack_STAR_STAR.LockedMatrix() );
+    if( ASub_STAR_STAR.Participating() )
+    {
+        Axpy( T(-1), A_STAR_STAR.LockedMatrix(), ASub_STAR_STAR.Matrix() );
+        errNorm += MaxNorm( ASub_STAR_STAR.LockedMatrix() );
+    }
+    if( errNorm != Base<T>(0) )
+        RuntimeError
+        ("[",DistToString(U),",",DistToString(V),
+         "] was not preserved between grids");
+}
+
+template<typename T>
+void TestTranslates( const Grid& grid, const Grid& subGrid, Int m, Int n )
+{
+    TestTranslate<T,CIRC,CIRC>( grid, subGrid, m, n );
+    TestTranslate<T,MC,MR>( grid, subGrid, m, n );
+    TestTranslate<T,MC,STAR>( grid, subGrid, m, n );
+    TestTranslate<T,MD,STAR>( grid, subGrid, m, n );
+    TestTranslate<T,MR,MC>( grid, subGrid, m, n );
+    TestTranslate<T,MR,STAR>( grid, subGrid, m, n );
+    TestTranslate<T,STAR,MC>( grid, subGrid, m, n );
+    TestTranslate<T,STAR,MD>( grid, subGrid, m, n );
+    TestTranslate<T,STAR,MR>( grid, subGrid, m, n );
+    TestTranslate<T,STAR,STAR>( grid, subGrid, m, n );
+    TestTranslate<T,STAR,VC>( grid, subGrid, m, n );
+    TestTranslate<T,STAR,VR>( grid, subGrid, m, n );
+    TestTranslate<T,VC,STAR>( grid, subGrid, m, n );
+    TestTranslate<T,VR,STAR>( grid, subGrid, m, n );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::NewWorldComm();
+    const Int commSize = mpi::Size( comm );
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",37);
+        const Int n = Input("--width","width of matrix",29);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+
+        // The subgrid is owned by the last half of the processes
+        const Int subSize = Max( commSize/2, Int(1) );
+        std::vector<int> subRanks(subSize);
+        for( Int i=0; i<subSize; ++i )
+            subRanks[i] = commSize - subSize + i;
+        mpi::Group group, subGroup;
+        mpi::CommGroup( comm, group );
+        mpi::Incl( group, subRanks.size(), subRanks.data(), subGroup );
+
+        const Grid grid( std::move(comm), order );
+        const Grid subGrid( mpi::NewWorldComm(), subGroup, 1, COLUMN_MAJOR );
+
+        TestTranslates<double>( grid, subGrid, m, n );
+        TestTranslates<Complex<float>>( grid, subGrid, m, n );
+        TestTranslates<Int>( grid, subGrid, m, n );
+
+        if( mpi::Rank() == 0 )
+            Output("Passed");
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return EXIT_FAILURE;
+    }
+
+    return 0;
+}
@@ -0,0 +1,110 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+/*
+  Testing that the distributed lower Cholesky factorization gives the same
+  factor (up to roundoff) for every lookahead depth, and that the factor
+  reproduces the original matrix.
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+Base<F> GlobalMaxNorm( const DistMatrix<F>& A )
+{
+    DistMatrix<F,STAR,STAR> A_STAR_STAR( A );
+    return MaxNorm( A_STAR_STAR.LockedMatrix() );
+}
+
+template<typename F>
+void TestLookahead( const Grid& g, Int m, Int nb, Int maxLookahead )
+{
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+    OutputFromRoot
+    (g.Comm(),"Testing Cholesky lookahead with ",TypeName<F>(),
+     " and blocksize ",nb);
+    PushIndent();
+
+    // A = X X^H + m I is comfortably Hermitian positive-definite
+    DistMatrix<F> X(g), AOrig(g);
+    Uniform( X, m, m );
+    Zeros( AOrig, m, m );
+    Herk( LOWER, NORMAL, Real(1), X, Real(0), AOrig );
+    ShiftDiagonal( AOrig, F(m) );
+
+    PushBlocksizeStack( nb );
+    DistMatrix<F> LRef(g);
+    for( Int lookahead=0; lookahead<=maxLookahead; ++lookahead )
+    {
+        SetCholeskyLookahead( lookahead );
+        DistMatrix<F> L( AOrig );
+        Cholesky( LOWER, L );
+        MakeTrapezoidal( LOWER, L );
+        if( lookahead == 0 )
+        {
+            LRef = L;
+            continue;
+        }
+
+        Axpy( F(-1), LRef, L );
+        const Real relDiff = GlobalMaxNorm( L ) / (eps*m*GlobalMaxNorm(LRef));
+        OutputFromRoot
+        (g.Comm(),"lookahead ",lookahead,": ||L - L_0||_max / "
+         "(eps m ||L_0||_max) = ",relDiff);
+        if( relDiff > Real(10) )
+            LogicError("Lookahead changed the Cholesky factor");
+    }
+    PopBlocksizeStack();
+    SetCholeskyLookahead( 1 );
+
+    // Check the reference factor against the original matrix
+    DistMatrix<F> E( AOrig );
+    Herk( LOWER, NORMAL, Real(1), LRef, Real(-1), E );
+    MakeTrapezoidal( LOWER, E );
+    const Real relErr = GlobalMaxNorm( E ) / (eps*m*GlobalMaxNorm(AOrig));
+    OutputFromRoot
+    (g.Comm(),"||L L^H - A||_max / (eps m ||A||_max) = ",relErr);
+    if( relErr > Real(100) )
+        LogicError("Relative error was unacceptably large");
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",75);
+        const Int maxLookahead =
+          Input("--maxLookahead","largest lookahead depth to test",3);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( mpi::NewWorldComm() );
+        for( const Int nb : { 7, 16, 96 } )
+        {
+            TestLookahead<float>( g, m, nb, maxLookahead );
+            TestLookahead<double>( g, m, nb, maxLookahead );
+            TestLookahead<Complex<double>>( g, m, nb, maxLookahead );
+        }
+
+        if( mpi::Rank() == 0 )
+            Output("Passed");
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return EXIT_FAILURE;
+    }
+
+    return 0;
+}
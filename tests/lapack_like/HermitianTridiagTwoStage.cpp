@@ -0,0 +1,139 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+/*
+  Testing that the two-stage reduction to tridiagonal form satisfies
+  A = Q T Q^H with a unitary Q, for several bandwidths, and that its
+  eigenvalues match those of the one-stage reduction.
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+void TestCorrectness
+( UpperOrLower uplo,
+  const Matrix<Field>& A,
+  const herm_tridiag::TwoStageReflectors<Field>& reflectors,
+  const Matrix<Field>& AOrig )
+{
+    typedef Base<Field> Real;
+    const Int m = AOrig.Height();
+    const Real eps = limits::Epsilon<Real>();
+    const Real oneNormA = HermitianOneNorm( uplo, AOrig );
+
+    // Form the (possibly complex) Hermitian tridiagonal matrix
+    const Int subdiagonal = ( uplo==LOWER ? -1 : +1 );
+    auto d = GetDiagonal( A );
+    auto e = GetDiagonal( A, subdiagonal );
+    Matrix<Field> B, eConj;
+    Zeros( B, m, m );
+    SetDiagonal( B, d );
+    SetDiagonal( B, e, subdiagonal );
+    Conjugate( e, eConj );
+    SetDiagonal( B, eConj, -subdiagonal );
+
+    // || A - Q T Q^H ||
+    herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, reflectors, B );
+    herm_tridiag::ApplyQ( RIGHT, uplo, ADJOINT, A, reflectors, B );
+    Matrix<Field> AFull( AOrig );
+    MakeHermitian( uplo, AFull );
+    Axpy( Field(-1), AFull, B );
+    const Real relError = InfinityNorm( B ) / (eps*m*oneNormA);
+
+    // || I - Q^H Q ||
+    Identity( B, m, m );
+    herm_tridiag::ApplyQ( LEFT, uplo, ADJOINT, A, reflectors, B );
+    herm_tridiag::ApplyQ( RIGHT, uplo, NORMAL, A, reflectors, B );
+    ShiftDiagonal( B, Field(-1) );
+    const Real relOrthogError = InfinityNorm( B ) / (eps*m);
+
+    Output
+    ("bandwidth=",reflectors.bandwidth,
+     ": ||A - Q T Q^H||_oo / (eps m ||A||_1) = ",relError,
+     ", ||I - Q^H Q||_oo / (eps m) = ",relOrthogError);
+    if( relError > Real(10) )
+        LogicError("Relative error was unacceptably large");
+    if( relOrthogError > Real(10) )
+        LogicError("Relative orthogonality error was unacceptably large");
+}
+
+template<typename Field>
+void TestEigenvalues
+( UpperOrLower uplo, const Matrix<Field>& AOrig, Int bandwidth )
+{
+    typedef Base<Field> Real;
+    const Int m = AOrig.Height();
+    const Real eps = limits::Epsilon<Real>();
+
+    HermitianEigCtrl<Field> ctrl;
+    Matrix<Field> A( AOrig );
+    Matrix<Real> w, wTwoStage;
+    HermitianEig( uplo, A, w, ctrl );
+    ctrl.tridiagCtrl.twoStage = true;
+    ctrl.tridiagCtrl.bandwidth = bandwidth;
+    A = AOrig;
+    HermitianEig( uplo, A, wTwoStage, ctrl );
+
+    Axpy( Real(-1), w, wTwoStage );
+    const Real relError =
+      MaxNorm( wTwoStage ) / (eps*m*HermitianOneNorm( uplo, AOrig ));
+    if( relError > Real(10) )
+        LogicError("Two-stage eigenvalues differed from the one-stage ones");
+}
+
+template<typename Field>
+void TestTwoStage( UpperOrLower uplo, Int m )
+{
+    Output
+    ("Testing with ",TypeName<Field>()," and uplo=",UpperOrLowerToChar(uplo));
+    PushIndent();
+    Matrix<Field> AOrig;
+    HermitianUniformSpectrum( AOrig, m, -10, 10 );
+    for( const Int bandwidth : { 1, 2, 5, 16, m } )
+    {
+        Matrix<Field> A( AOrig );
+        herm_tridiag::TwoStageReflectors<Field> reflectors;
+        herm_tridiag::TwoStage( uplo, A, reflectors, bandwidth );
+        TestCorrectness( uplo, A, reflectors, AOrig );
+        TestEigenvalues( uplo, AOrig, bandwidth );
+    }
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",75);
+        ProcessInput();
+        PrintInputReport();
+
+        // The two-stage reduction is sequential, so every process tests it
+        for( const UpperOrLower uplo : { LOWER, UPPER } )
+        {
+            TestTwoStage<float>( uplo, m );
+            TestTwoStage<Complex<float>>( uplo, m );
+            TestTwoStage<double>( uplo, m );
+            TestTwoStage<Complex<double>>( uplo, m );
+        }
+
+        if( mpi::Rank() == 0 )
+            Output("Passed");
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return EXIT_FAILURE;
+    }
+
+    return 0;
+}
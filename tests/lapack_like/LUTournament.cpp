@@ -0,0 +1,126 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+/*
+  Testing that the distributed LU with tournament pivoting satisfies
+  P A = L U on several process grids and blocksizes, that its multipliers
+  stay bounded, and that lu::SolveAfter solves with the factorization.
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+Base<F> GlobalMaxNorm( const AbstractDistMatrix<F>& A )
+{
+    DistMatrix<F,STAR,STAR> A_STAR_STAR( A );
+    return MaxNorm( A_STAR_STAR.LockedMatrix() );
+}
+
+template<typename F>
+void TestTournament( const Grid& g, Int m, Int n, Int nb )
+{
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Int minDim = Min(m,n);
+    OutputFromRoot
+    (g.Comm(),"Testing ",m," x ",n," LU with ",TypeName<F>(),
+     ", blocksize ",nb," and a ",g.Height()," x ",g.Width()," grid");
+    PushIndent();
+
+    DistMatrix<F> AOrig(g);
+    Uniform( AOrig, m, n );
+
+    PushBlocksizeStack( nb );
+    DistMatrix<F> A( AOrig );
+    DistPermutation P(g);
+    LU( A, P );
+    PopBlocksizeStack();
+
+    // || P A - L U ||
+    DistMatrix<F> L(g), U(g);
+    L = A( ALL, IR(0,minDim) );
+    MakeTrapezoidal( LOWER, L );
+    FillDiagonal( L, F(1) );
+    U = A( IR(0,minDim), ALL );
+    MakeTrapezoidal( UPPER, U );
+    const Real maxMultiplier = GlobalMaxNorm( L );
+
+    DistMatrix<F> E( AOrig );
+    P.PermuteRows( E );
+    Gemm( NORMAL, NORMAL, F(-1), L, U, F(1), E );
+    const Real relErr = GlobalMaxNorm( E ) / (eps*m*GlobalMaxNorm(AOrig));
+    OutputFromRoot
+    (g.Comm(),"||P A - L U||_max / (eps m ||A||_max) = ",relErr,
+     ", ||L||_max = ",maxMultiplier);
+    if( relErr > Real(100) )
+        LogicError("Relative error was unacceptably large");
+    // Tournament pivoting only bounds the multipliers loosely, but on a
+    // random matrix they should stay well within a small constant
+    if( maxMultiplier > Real(100) )
+        LogicError("Multipliers were unacceptably large");
+
+    // || A X - B ||
+    if( m == n )
+    {
+        DistMatrix<F> B(g), X(g);
+        Uniform( B, m, 5 );
+        X = B;
+        lu::SolveAfter( NORMAL, A, P, X );
+        Gemm( NORMAL, NORMAL, F(-1), AOrig, X, F(1), B );
+        const Real relResid =
+          GlobalMaxNorm( B ) / (eps*m*GlobalMaxNorm(AOrig)*GlobalMaxNorm(X));
+        OutputFromRoot
+        (g.Comm(),"||A X - B||_max / (eps m ||A||_max ||X||_max) = ",relResid);
+        if( relResid > Real(100) )
+            LogicError("Relative residual was unacceptably large");
+    }
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",75);
+        const Int n = Input("--n","width of the rectangular matrix",50);
+        ProcessInput();
+        PrintInputReport();
+
+        // Exercise the tournament with one, several and all of the
+        // processes in each process column
+        const Int commSize = mpi::Size( mpi::COMM_WORLD );
+        for( const Int gridHeight : { Int(1), Grid::DefaultHeight(commSize),
+                                      commSize } )
+        {
+            const Grid g( mpi::NewWorldComm(), gridHeight );
+            for( const Int nb : { 7, 16, 96 } )
+            {
+                TestTournament<float>( g, m, m, nb );
+                TestTournament<Complex<float>>( g, m, m, nb );
+                TestTournament<double>( g, m, m, nb );
+                TestTournament<Complex<double>>( g, m, m, nb );
+                TestTournament<double>( g, m, n, nb );
+                TestTournament<double>( g, n, m, nb );
+            }
+        }
+
+        if( mpi::Rank() == 0 )
+            Output("Passed");
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return EXIT_FAILURE;
+    }
+
+    return 0;
+}
@@ -0,0 +1,163 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+/*
+  Testing that the mixed-precision LinearSolve and HPDSolve reach a
+  working-precision backward error on matrices of increasing condition
+  number, and that well-conditioned systems need neither GMRES nor a
+  working-precision factorization.
+*/
+#include <El.hpp>
+using namespace El;
+
+// Form a matrix whose singular values are geometrically spaced between one
+// and 1/cond, with random singular vectors (which coincide if 'hermitian')
+template<typename Field>
+void Conditioned( Matrix<Field>& A, Int n, Base<Field> cond, bool hermitian )
+{
+    typedef Base<Field> Real;
+    vector<Field> d( n );
+    for( Int j=0; j<n; ++j )
+        d[j] = Pow( cond, -Real(j)/Real(Max(n-1,Int(1))) );
+    Diagonal( A, d );
+
+    Matrix<Field> Q, t;
+    Matrix<Real> s;
+    ImplicitHaar( Q, t, s, n );
+    qr::ApplyQ( LEFT, NORMAL, Q, t, s, A );
+    if( !hermitian )
+        ImplicitHaar( Q, t, s, n );
+    qr::ApplyQ( RIGHT, ADJOINT, Q, t, s, A );
+    if( hermitian )
+        MakeHermitian( LOWER, A );
+}
+
+template<typename Field>
+void Check
+( bool print,
+  const MixedPrecisionInfo<Base<Field>>& info,
+  Base<Field> cond,
+  Base<Field> relResid )
+{
+    typedef Base<Field> Real;
+    if( print )
+        Output
+        ("cond=",cond,": ",info.refineIts," refinement steps, ",
+         info.gmresRefineIts," GMRES-IR steps (",info.gmresIts,
+         " iterations), fallback=",info.fullPrecisionFallback,
+         ", backward error=",info.backwardError,", recomputed=",relResid);
+    if( !info.converged )
+        LogicError("Mixed-precision refinement did not converge");
+    if( relResid > Real(10)*info.backwardError )
+        LogicError("Reported backward error did not match the residual");
+    if( cond <= Real(100) &&
+        (info.gmresRefineIts != 0 || info.fullPrecisionFallback) )
+        LogicError("Well-conditioned system needed more than refinement");
+}
+
+template<typename Field>
+Base<Field> RelResid
+( Orientation orientation,
+  const DistMatrix<Field>& A,
+  const DistMatrix<Field>& X,
+  const DistMatrix<Field>& B )
+{
+    DistMatrix<Field> R( B );
+    Gemm( orientation, NORMAL, Field(-1), A, X, Field(1), R );
+    return MaxNorm( R ) / (InfinityNorm(A)*MaxNorm(X) + MaxNorm(B));
+}
+
+template<typename Field>
+void TestMixedPrecision( const Grid& g, Int n, Int numRHS )
+{
+    typedef Base<Field> Real;
+    OutputFromRoot
+    (g.Comm(),"Testing with ",TypeName<Field>()," (factored in ",
+     TypeName<Demote<Field>>(),")");
+    PushIndent();
+    for( const bool hermitian : { false, true } )
+    {
+        OutputFromRoot(g.Comm(),(hermitian ? "HPDSolve" : "LinearSolve"));
+        PushIndent();
+        for( const Real cond : { Real(1e2), Real(1e6), Real(1e10) } )
+        {
+            // Build the matrices on the root so that the sequential and
+            // distributed solvers see the same system
+            Matrix<Field> ASeq, BSeq;
+            DistMatrix<Field,CIRC,CIRC> ARoot(g), BRoot(g);
+            if( g.Rank() == 0 )
+            {
+                Conditioned( ASeq, n, cond, hermitian );
+                Uniform( BSeq, n, numRHS );
+                CopyFromRoot( ASeq, ARoot );
+                CopyFromRoot( BSeq, BRoot );
+            }
+            else
+            {
+                CopyFromNonRoot( ARoot );
+                CopyFromNonRoot( BRoot );
+            }
+            DistMatrix<Field> A( ARoot ), B( BRoot ), X( BRoot );
+
+            MixedPrecisionCtrl<Real> ctrl;
+            const Orientation orientation =
+              ( hermitian && IsComplex<Field>::value ? TRANSPOSE : NORMAL );
+            auto info =
+              ( hermitian ?
+                HPDSolve( LOWER, orientation, A, X, ctrl ) :
+                LinearSolve( A, X, ctrl ) );
+            Check<Field>
+            ( g.Rank() == 0, info, cond, RelResid( orientation, A, X, B ) );
+
+            if( g.Rank() == 0 )
+            {
+                Matrix<Field> XSeq( BSeq );
+                auto seqInfo =
+                  ( hermitian ?
+                    HPDSolve( LOWER, NORMAL, ASeq, XSeq, ctrl ) :
+                    LinearSolve( ASeq, XSeq, ctrl ) );
+                Matrix<Field> RSeq( BSeq );
+                Gemm( NORMAL, NORMAL, Field(-1), ASeq, XSeq, Field(1), RSeq );
+                const Real relResid = MaxNorm( RSeq ) /
+                  (InfinityNorm(ASeq)*MaxNorm(XSeq) + MaxNorm(BSeq));
+                Check<Field>( true, seqInfo, cond, relResid );
+            }
+        }
+        PopIndent();
+    }
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int n = Input("--n","size of matrix",100);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",3);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( mpi::NewWorldComm() );
+        TestMixedPrecision<double>( g, n, numRHS );
+        TestMixedPrecision<Complex<double>>( g, n, numRHS );
+
+        if( mpi::Rank() == 0 )
+            Output("Passed");
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return EXIT_FAILURE;
+    }
+
+    return 0;
+}
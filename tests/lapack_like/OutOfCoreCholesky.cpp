@@ -0,0 +1,100 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+/*
+  Testing the left-looking out-of-core Cholesky, which factors a binary file
+  in place one column panel at a time, against the in-core Cholesky.
+*/
+#include <El.hpp>
+#include <cstdio>
+using namespace El;
+
+template<typename F>
+void TestCholesky
+( const Grid& g, Int n, const OutOfCoreCtrl& ctrl, const string& prefix )
+{
+    typedef Base<F> Real;
+    DistMatrix<F> X(g), A(g), AEst(g);
+    Uniform( X, n, n );
+    Zeros( A, n, n );
+    Herk( LOWER, NORMAL, Real(1), X, Real(0), A );
+    ShiftDiagonal( A, F(n) );
+
+    Write( A, prefix, BINARY );
+    const string filename = prefix+".bin";
+    OutOfCoreCholesky<F>( LOWER, filename, g, ctrl );
+    Read( AEst, filename, BINARY );
+
+    // Both factorizations leave the strictly upper triangle untouched
+    Cholesky( LOWER, A );
+    const Real ANorm = FrobeniusNorm( A );
+    Axpy( F(-1), A, AEst );
+    const Real relError = FrobeniusNorm( AEst ) / ANorm;
+    OutputFromRoot
+    (g.Comm(),"tile size ",ctrl.tileSize,", budget ",ctrl.memoryBudget,
+     ": ||L - LEst||_F / ||L||_F = ",relError);
+    const Real eps = limits::Epsilon<Real>();
+    if( relError > Real(10)*n*eps )
+        LogicError("Relative error was unacceptably large");
+
+    if( g.Rank() == 0 )
+        std::remove( filename.c_str() );
+}
+
+template<typename F>
+void TestOutOfCoreCholesky
+( const Grid& g, Int n, Int tileSize, const string& prefix )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+
+    // Panels which do not divide the matrix evenly
+    OutOfCoreCtrl ctrl;
+    ctrl.tileSize = tileSize;
+    TestCholesky<F>( g, n, ctrl, prefix );
+
+    // A budget which only allows for a few panels
+    ctrl.tileSize = 0;
+    ctrl.memoryBudget = 8*sizeof(F)*n*(n/4)/g.Size();
+    TestCholesky<F>( g, n, ctrl, prefix );
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int n = Input("--n","height of matrix",250);
+        const Int tileSize = Input("--tileSize","panel width",48);
+        const string prefix =
+          Input
+          ("--prefix","prefix of the scratch file",
+           string("OutOfCoreCholesky"));
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( mpi::NewWorldComm() );
+        TestOutOfCoreCholesky<float>( g, n, tileSize, prefix );
+        TestOutOfCoreCholesky<double>( g, n, tileSize, prefix );
+        TestOutOfCoreCholesky<Complex<double>>( g, n, tileSize, prefix );
+
+        if( mpi::Rank() == 0 )
+            Output("Passed");
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return EXIT_FAILURE;
+    }
+
+    return 0;
+}
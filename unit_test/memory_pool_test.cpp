@@ -0,0 +1,129 @@
+// MUST include this
+#include <catch2/catch.hpp>
+
+// File being tested
+#include <El/core/MemoryPool.hpp>
+
+// Other includes
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using pool_type = El::MemoryPool<false>;
+
+pool_type make_pool(size_t thread_cache_size, size_t max_cached_bytes = 0)
+{
+    return pool_type(2.0f, 8UL, 1UL << 22, false,
+                     thread_cache_size, max_cached_bytes);
+}
+}// namespace <anon>
+
+TEST_CASE("Testing the host memory pool", "[seq][mempool]")
+{
+    auto const thread_cache_size = GENERATE(size_t{0}, size_t{4});
+    pool_type pool(2.0f, 8UL, 1UL << 22, false, thread_cache_size, 0UL);
+
+    GIVEN("A block that is freed and reallocated")
+    {
+        void* ptr = pool.Allocate(100);
+        std::memset(ptr, 1, 100);
+        pool.Free(ptr);
+        void* new_ptr = pool.Allocate(120);
+
+        THEN("The cached block is reused.")
+        {
+            CHECK(new_ptr == ptr);
+            auto const stats = pool.Statistics();
+            CHECK(stats.hits == 1UL);
+            CHECK(stats.misses == 1UL);
+            CHECK(stats.bytes_in_use == 128UL);
+            CHECK(stats.bytes_requested == 120UL);
+            CHECK(stats.bytes_cached == 0UL);
+            CHECK(stats.fragmentation == Approx(1. - 120./128.));
+        }
+        pool.Free(new_ptr);
+    }
+
+    GIVEN("An allocation larger than every bin")
+    {
+        void* ptr = pool.Allocate((1UL << 22) + 1);
+        pool.Free(ptr);
+
+        THEN("It is not cached.")
+        {
+            auto const stats = pool.Statistics();
+            CHECK(stats.misses == 1UL);
+            CHECK(stats.bytes_cached == 0UL);
+            CHECK(stats.bytes_in_use == 0UL);
+        }
+    }
+
+    GIVEN("Blocks allocated and freed by several threads")
+    {
+        std::vector<std::thread> threads;
+        std::vector<void*> ptrs(64);
+        for (size_t t = 0; t < 4; ++t)
+            threads.emplace_back([&pool, &ptrs, t]()
+            {
+                for (size_t iter = 0; iter < 100; ++iter)
+                {
+                    for (size_t i = t; i < ptrs.size(); i += 4)
+                        ptrs[i] = pool.Allocate(8*(i+1));
+                    for (size_t i = t; i < ptrs.size(); i += 4)
+                        pool.Free(ptrs[i]);
+                }
+            });
+        for (auto& thread : threads)
+            thread.join();
+
+        THEN("Every block is eventually cached and reused.")
+        {
+            auto const stats = pool.Statistics();
+            CHECK(stats.hits + stats.misses == 6400UL);
+            CHECK(stats.misses <= 256UL);
+            CHECK(stats.bytes_in_use == 0UL);
+            CHECK(stats.bytes_requested == 0UL);
+            CHECK(stats.bytes_cached > 0UL);
+            CHECK(stats.bytes_cached <= stats.bytes_allocated);
+        }
+    }
+}
+
+TEST_CASE("Testing memory pool trimming", "[seq][mempool]")
+{
+    auto const thread_cache_size = GENERATE(size_t{0}, size_t{4});
+
+    GIVEN("A pool with a high-water mark on the cached bytes")
+    {
+        auto pool = make_pool(thread_cache_size, 1UL << 22);
+        std::vector<void*> ptrs;
+        for (size_t i = 0; i < 4; ++i)
+            ptrs.push_back(pool.Allocate(1UL << 21));
+        for (auto* ptr : ptrs)
+            pool.Free(ptr);
+
+        THEN("Cached blocks beyond the mark are released.")
+        {
+            auto const stats = pool.Statistics();
+            CHECK(stats.peak_bytes_allocated >= 4*(1UL << 21));
+            CHECK(stats.bytes_cached <= (1UL << 22));
+            CHECK(stats.bytes_in_use == 0UL);
+        }
+    }
+
+    GIVEN("A pool that is trimmed explicitly")
+    {
+        auto pool = make_pool(thread_cache_size);
+        pool.Free(pool.Allocate(1UL << 21));
+        pool.Trim();
+
+        THEN("Nothing is cached in the shared bins.")
+        {
+            auto const stats = pool.Statistics();
+            CHECK(stats.bytes_cached == 0UL);
+            CHECK(stats.bytes_allocated == 0UL);
+        }
+    }
+}